@@ -17,6 +17,10 @@ public class BlueprintAnalyzer : ModuleRules
 			"HTTPServer"
 		});
 
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Projects"
+		});
+
 		if (Target.bBuildEditor)
 		{
 			PrivateDependencyModuleNames.AddRange(new string[] {
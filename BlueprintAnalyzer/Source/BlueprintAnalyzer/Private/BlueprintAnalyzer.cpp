@@ -1,6 +1,11 @@
 #include "BlueprintAnalyzer/Public/BlueprintAnalyzer.h"
 #include "BlueprintAnalyzer/Public/MCPHttpServer.h"
 #include "BlueprintAnalyzer/Public/MCPIntegration.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+#include "BlueprintAnalyzer/Public/BlueprintRegex.h"
+#include "BlueprintAnalyzer/Public/BlueprintResultCache.h"
+#include "BlueprintAnalyzer/Public/BlueprintFragmentCache.h"
+#include "BlueprintAnalyzer/Public/BlueprintResponseCompression.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/CoreDelegates.h"
 
@@ -33,6 +38,9 @@ void FBlueprintAnalyzerModule::StartupModule()
 			UE_LOG(LogTemp, Warning, TEXT("Failed to export initial blueprints data"));
 		}
 		
+		// Start tracking blueprint changes for the search catalog
+		FBlueprintCatalog::Initialize();
+		
 		// Start the HTTP server on port 8080
 		StartHttpServer(8080);
 	});
@@ -54,6 +62,15 @@ void FBlueprintAnalyzerModule::ShutdownModule()
     
 	// Shutdown MCP integration
 	FMCPIntegration::Shutdown();
+	
+	// Stop tracking blueprint changes
+	FBlueprintCatalog::Shutdown();
+	
+	// Drop compiled search patterns, cached results and response counters
+	FBlueprintRegex::Reset();
+	FBlueprintResultCache::Reset();
+	FBlueprintFragmentCache::Reset();
+	FBlueprintResponseCompression::Reset();
 }
 
 bool FBlueprintAnalyzerModule::StartHttpServer(uint32 Port)
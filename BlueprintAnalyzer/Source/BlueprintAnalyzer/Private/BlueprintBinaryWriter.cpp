@@ -0,0 +1,1056 @@
+#include "BlueprintAnalyzer/Public/BlueprintBinaryWriter.h"
+#include "BlueprintAnalyzer/Public/BlueprintUtf8JsonWriter.h"
+#include "BlueprintAnalyzer/Public/BlueprintDataSerializer.h"
+#include "BlueprintAnalyzer/Public/BlueprintDataExtractor.h"
+#include "HAL/IConsoleManager.h"
+
+namespace BlueprintBinaryWriter
+{
+    /** MessagePack containers with fewer elements than this get a one byte header */
+    constexpr uint32 MaxFixCount = 16;
+
+    /** MessagePack containers up to this many bytes are shifted to shrink their header on close */
+    constexpr int32 MaxShrinkBytes = 4096;
+
+    /** Size of the patched MessagePack map32/array32 header */
+    constexpr int32 MessagePackContainerHeaderSize = 5;
+
+    /** Deepest nesting the decoder accepts */
+    constexpr int32 MaxDecodeDepth = 256;
+
+    /**
+     * Encode the header of a string of Length bytes
+     * @param Out Receives up to 9 bytes
+     * @return Number of header bytes
+     */
+    int32 EncodeStringHeader(EBlueprintWireFormat Format, uint64 Length, uint8* Out)
+    {
+        auto StoreBigEndian = [Out](uint64 Value, int32 NumBytes)
+        {
+            for (int32 Index = 0; Index < NumBytes; ++Index)
+            {
+                Out[1 + Index] = static_cast<uint8>(Value >> (8 * (NumBytes - 1 - Index)));
+            }
+            return 1 + NumBytes;
+        };
+
+        if (Format == EBlueprintWireFormat::Cbor)
+        {
+            // Major type 3, text string
+            if (Length < 24)
+            {
+                Out[0] = static_cast<uint8>(0x60 | Length);
+                return 1;
+            }
+            if (Length <= 0xFF)
+            {
+                Out[0] = 0x78;
+                return StoreBigEndian(Length, 1);
+            }
+            if (Length <= 0xFFFF)
+            {
+                Out[0] = 0x79;
+                return StoreBigEndian(Length, 2);
+            }
+            if (Length <= 0xFFFFFFFF)
+            {
+                Out[0] = 0x7A;
+                return StoreBigEndian(Length, 4);
+            }
+            Out[0] = 0x7B;
+            return StoreBigEndian(Length, 8);
+        }
+
+        if (Length < 32)
+        {
+            Out[0] = static_cast<uint8>(0xA0 | Length);
+            return 1;
+        }
+        if (Length <= 0xFF)
+        {
+            Out[0] = 0xD9;
+            return StoreBigEndian(Length, 1);
+        }
+        if (Length <= 0xFFFF)
+        {
+            Out[0] = 0xDA;
+            return StoreBigEndian(Length, 2);
+        }
+        Out[0] = 0xDB;
+        return StoreBigEndian(Length, 4);
+    }
+
+    /** Kind of a decoded item header */
+    enum class EItemKind : uint8
+    {
+        Integer,
+        Double,
+        Bool,
+        Null,
+        String,
+        Array,
+        Map,
+        Break
+    };
+
+    /** Header of one encoded item */
+    struct FItemHead
+    {
+        EItemKind Kind = EItemKind::Null;
+        int64 Integer = 0;
+        double Double = 0.0;
+        bool bBool = false;
+
+        /** Byte length of strings, element count of definite containers */
+        uint64 Length = 0;
+
+        /** Whether the container is closed by a break byte instead of a count */
+        bool bIndefinite = false;
+    };
+
+    /** Decodes a document into a JSON writer, one item at a time */
+    class FDecoder
+    {
+    public:
+        FDecoder(TConstArrayView<uint8> InBytes, EBlueprintWireFormat InFormat, FBlueprintUtf8JsonWriter& InWriter)
+            : Bytes(InBytes)
+            , Format(InFormat)
+            , Writer(InWriter)
+        {
+        }
+
+        /** Decode the single top-level item; fails on trailing bytes */
+        bool Run()
+        {
+            FItemHead Head;
+            return ReadHead(Head) && ReadBody(Head, nullptr, 0) && Position == Bytes.Num();
+        }
+
+    private:
+        bool ReadBigEndian(int32 NumBytes, uint64& OutValue)
+        {
+            if (Bytes.Num() - Position < NumBytes)
+            {
+                return false;
+            }
+
+            OutValue = 0;
+            for (int32 Index = 0; Index < NumBytes; ++Index)
+            {
+                OutValue = (OutValue << 8) | Bytes[Position++];
+            }
+            return true;
+        }
+
+        bool ReadDouble(FItemHead& Head, int32 NumBytes)
+        {
+            uint64 Bits = 0;
+            if (!ReadBigEndian(NumBytes, Bits))
+            {
+                return false;
+            }
+
+            Head.Kind = EItemKind::Double;
+            if (NumBytes == 4)
+            {
+                const uint32 FloatBits = static_cast<uint32>(Bits);
+                float Value;
+                FMemory::Memcpy(&Value, &FloatBits, sizeof(Value));
+                Head.Double = Value;
+            }
+            else
+            {
+                FMemory::Memcpy(&Head.Double, &Bits, sizeof(Head.Double));
+            }
+            return true;
+        }
+
+        bool SetUnsigned(FItemHead& Head, uint64 Value)
+        {
+            if (Value > static_cast<uint64>(MAX_int64))
+            {
+                Head.Kind = EItemKind::Double;
+                Head.Double = static_cast<double>(Value);
+            }
+            else
+            {
+                Head.Kind = EItemKind::Integer;
+                Head.Integer = static_cast<int64>(Value);
+            }
+            return true;
+        }
+
+        bool ReadCborHead(FItemHead& Head)
+        {
+            const uint8 Initial = Bytes[Position++];
+            const uint8 MajorType = Initial >> 5;
+            const uint8 Info = Initial & 0x1F;
+
+            if (MajorType == 7)
+            {
+                switch (Info)
+                {
+                case 20: Head.Kind = EItemKind::Bool; Head.bBool = false; return true;
+                case 21: Head.Kind = EItemKind::Bool; Head.bBool = true; return true;
+                case 22: Head.Kind = EItemKind::Null; return true;
+                case 26: return ReadDouble(Head, 4);
+                case 27: return ReadDouble(Head, 8);
+                case 31: Head.Kind = EItemKind::Break; return true;
+                default: return false;
+                }
+            }
+
+            uint64 Argument = Info;
+            if (Info == 31)
+            {
+                if (MajorType != 4 && MajorType != 5)
+                {
+                    return false;
+                }
+                Head.bIndefinite = true;
+            }
+            else if (Info >= 24)
+            {
+                if (Info > 27 || !ReadBigEndian(1 << (Info - 24), Argument))
+                {
+                    return false;
+                }
+            }
+
+            switch (MajorType)
+            {
+            case 0:
+                return SetUnsigned(Head, Argument);
+
+            case 1:
+                if (Argument > static_cast<uint64>(MAX_int64))
+                {
+                    Head.Kind = EItemKind::Double;
+                    Head.Double = -1.0 - static_cast<double>(Argument);
+                    return true;
+                }
+                Head.Kind = EItemKind::Integer;
+                Head.Integer = -1 - static_cast<int64>(Argument);
+                return true;
+
+            case 3:
+                Head.Kind = EItemKind::String;
+                Head.Length = Argument;
+                return true;
+
+            case 4:
+            case 5:
+                Head.Kind = MajorType == 4 ? EItemKind::Array : EItemKind::Map;
+                Head.Length = Argument;
+                return true;
+
+            default:
+                // Byte strings and tags are never written
+                return false;
+            }
+        }
+
+        bool ReadMessagePackHead(FItemHead& Head)
+        {
+            const uint8 Initial = Bytes[Position++];
+
+            if (Initial < 0x80)
+            {
+                Head.Kind = EItemKind::Integer;
+                Head.Integer = Initial;
+                return true;
+            }
+            if (Initial >= 0xE0)
+            {
+                Head.Kind = EItemKind::Integer;
+                Head.Integer = static_cast<int8>(Initial);
+                return true;
+            }
+            if (Initial >= 0xA0 && Initial <= 0xBF)
+            {
+                Head.Kind = EItemKind::String;
+                Head.Length = Initial & 0x1F;
+                return true;
+            }
+            if (Initial >= 0x80 && Initial <= 0x9F)
+            {
+                Head.Kind = Initial < 0x90 ? EItemKind::Map : EItemKind::Array;
+                Head.Length = Initial & 0x0F;
+                return true;
+            }
+
+            uint64 Value = 0;
+            if (Initial >= 0xCC && Initial <= 0xCF)
+            {
+                // uint8 to uint64
+                return ReadBigEndian(1 << (Initial - 0xCC), Value) && SetUnsigned(Head, Value);
+            }
+            if (Initial >= 0xD0 && Initial <= 0xD3)
+            {
+                // int8 to int64, sign-extended from their width
+                const int32 NumBytes = 1 << (Initial - 0xD0);
+                if (!ReadBigEndian(NumBytes, Value))
+                {
+                    return false;
+                }
+                const int32 Shift = 64 - 8 * NumBytes;
+                Head.Kind = EItemKind::Integer;
+                Head.Integer = static_cast<int64>(Value << Shift) >> Shift;
+                return true;
+            }
+
+            switch (Initial)
+            {
+            case 0xC0: Head.Kind = EItemKind::Null; return true;
+            case 0xC2: Head.Kind = EItemKind::Bool; Head.bBool = false; return true;
+            case 0xC3: Head.Kind = EItemKind::Bool; Head.bBool = true; return true;
+            case 0xCA: return ReadDouble(Head, 4);
+            case 0xCB: return ReadDouble(Head, 8);
+            case 0xD9: Head.Kind = EItemKind::String; return ReadBigEndian(1, Head.Length);
+            case 0xDA: Head.Kind = EItemKind::String; return ReadBigEndian(2, Head.Length);
+            case 0xDB: Head.Kind = EItemKind::String; return ReadBigEndian(4, Head.Length);
+            case 0xDC: Head.Kind = EItemKind::Array; return ReadBigEndian(2, Head.Length);
+            case 0xDD: Head.Kind = EItemKind::Array; return ReadBigEndian(4, Head.Length);
+            case 0xDE: Head.Kind = EItemKind::Map; return ReadBigEndian(2, Head.Length);
+            case 0xDF: Head.Kind = EItemKind::Map; return ReadBigEndian(4, Head.Length);
+            default:
+                // Binary, extension types and the reserved byte are never written
+                return false;
+            }
+        }
+
+        bool ReadHead(FItemHead& Head)
+        {
+            if (Position >= Bytes.Num())
+            {
+                return false;
+            }
+            return Format == EBlueprintWireFormat::Cbor ? ReadCborHead(Head) : ReadMessagePackHead(Head);
+        }
+
+        bool ReadString(uint64 Length, FString& OutText)
+        {
+            if (Length > static_cast<uint64>(Bytes.Num() - Position))
+            {
+                return false;
+            }
+
+            const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Bytes.GetData() + Position), static_cast<int32>(Length));
+            OutText = FString(Converter.Length(), Converter.Get());
+            Position += static_cast<int32>(Length);
+            return true;
+        }
+
+        template <typename ValueType>
+        void Emit(const FString* Identifier, ValueType Value)
+        {
+            if (Identifier)
+            {
+                Writer.WriteValue(*Identifier, Value);
+            }
+            else
+            {
+                Writer.WriteValue(Value);
+            }
+        }
+
+        bool ReadBody(const FItemHead& Head, const FString* Identifier, int32 Depth)
+        {
+            switch (Head.Kind)
+            {
+            case EItemKind::Integer:
+                Emit(Identifier, Head.Integer);
+                return true;
+
+            case EItemKind::Double:
+                Emit(Identifier, Head.Double);
+                return true;
+
+            case EItemKind::Bool:
+                Emit(Identifier, Head.bBool);
+                return true;
+
+            case EItemKind::Null:
+                if (Identifier)
+                {
+                    Writer.WriteNull(*Identifier);
+                }
+                else
+                {
+                    Writer.WriteNull();
+                }
+                return true;
+
+            case EItemKind::String:
+            {
+                FString Text;
+                if (!ReadString(Head.Length, Text))
+                {
+                    return false;
+                }
+                Emit(Identifier, Text);
+                return true;
+            }
+
+            case EItemKind::Array:
+            case EItemKind::Map:
+                return ReadContainer(Head, Identifier, Depth + 1);
+
+            default:
+                return false;
+            }
+        }
+
+        bool ReadContainer(const FItemHead& Head, const FString* Identifier, int32 Depth)
+        {
+            if (Depth > MaxDecodeDepth)
+            {
+                return false;
+            }
+
+            const bool bMap = Head.Kind == EItemKind::Map;
+            if (bMap && Identifier)
+            {
+                Writer.WriteObjectStart(*Identifier);
+            }
+            else if (bMap)
+            {
+                Writer.WriteObjectStart();
+            }
+            else if (Identifier)
+            {
+                Writer.WriteArrayStart(*Identifier);
+            }
+            else
+            {
+                Writer.WriteArrayStart();
+            }
+
+            for (uint64 Index = 0; Head.bIndefinite || Index < Head.Length; ++Index)
+            {
+                FItemHead Item;
+                if (!ReadHead(Item))
+                {
+                    return false;
+                }
+
+                if (Item.Kind == EItemKind::Break)
+                {
+                    if (!Head.bIndefinite)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+
+                if (bMap)
+                {
+                    // Only string keys map back to JSON fields
+                    FString Key;
+                    FItemHead Value;
+                    if (Item.Kind != EItemKind::String || !ReadString(Item.Length, Key) || !ReadHead(Value) || !ReadBody(Value, &Key, Depth))
+                    {
+                        return false;
+                    }
+                }
+                else if (!ReadBody(Item, nullptr, Depth))
+                {
+                    return false;
+                }
+            }
+
+            if (bMap)
+            {
+                Writer.WriteObjectEnd();
+            }
+            else
+            {
+                Writer.WriteArrayEnd();
+            }
+            return true;
+        }
+
+        TConstArrayView<uint8> Bytes;
+        int32 Position = 0;
+        EBlueprintWireFormat Format;
+        FBlueprintUtf8JsonWriter& Writer;
+    };
+
+    /** Encode data as JSON bytes */
+    TArray<uint8> EncodeJson(const FBlueprintData& BlueprintData)
+    {
+        FBlueprintUtf8JsonWriter Writer;
+        FBlueprintDataSerializer::WriteBlueprint(Writer, BlueprintData);
+        Writer.Close();
+        return Writer.MoveBytes();
+    }
+
+    /** Encode data in a binary format */
+    TArray<uint8> EncodeBinary(const FBlueprintData& BlueprintData, EBlueprintWireFormat Format)
+    {
+        FBlueprintBinaryWriter Writer(Format);
+        FBlueprintDataSerializer::WriteBlueprint(Writer, BlueprintData);
+        Writer.Close();
+        return Writer.MoveBytes();
+    }
+
+    /** Blueprint exercising what real project data rarely does: escapes, non-ASCII text, negative and large numbers */
+    FBlueprintData MakeEdgeCaseBlueprint()
+    {
+        FBlueprintData BlueprintData;
+        BlueprintData.Name = TEXT("BP_Conformance");
+        BlueprintData.Path = TEXT("/Game/Conformance/BP_Conformance.BP_Conformance");
+        BlueprintData.ParentClass = TEXT("Actor");
+        BlueprintData.Description = TEXT("Quotes \" backslashes \\ tabs \t newlines \n and \x01 control characters");
+        BlueprintData.Metadata.Add(TEXT("Unicode"), TEXT("Gr\u00FC\u00DFe \u65E5\u672C \U0001F600"));
+        BlueprintData.Metadata.Add(TEXT("Empty"), FString());
+
+        FBlueprintVariableData& Variable = BlueprintData.Variables.AddDefaulted_GetRef();
+        Variable.Name = TEXT("Health");
+        Variable.Type = TEXT("float");
+        Variable.DefaultValue = TEXT("100.0");
+        Variable.IsExposed = true;
+
+        FBlueprintGraphData& Graph = BlueprintData.Graphs.AddDefaulted_GetRef();
+        Graph.Name = TEXT("EventGraph");
+        Graph.GraphType = TEXT("Ubergraph");
+
+        // Positions cover every integer width either format picks
+        const int32 Positions[] = { 0, 1, -1, 23, 24, -24, -25, 31, -32, -33, 127, 128, 255, 256, 65535, 65536, -129, -32769, MAX_int32, MIN_int32 };
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(Positions); ++Index)
+        {
+            FBlueprintNodeData& Node = Graph.Nodes.AddDefaulted_GetRef();
+            Node.NodeId = FString::Printf(TEXT("Node%d"), Index);
+            Node.NodeType = TEXT("K2Node_CallFunction");
+            Node.Title = FString::ChrN(Index * 3, TEXT('x'));
+            Node.PositionX = Positions[Index];
+            Node.PositionY = -Positions[Index];
+
+            FBlueprintPinData& Pin = Node.InputPins.AddDefaulted_GetRef();
+            Pin.PinId = FString::Printf(TEXT("Pin%d"), Index);
+            Pin.Name = TEXT("execute");
+            Pin.IsExecution = true;
+            Pin.DataType = TEXT("exec");
+
+            // Enough properties to cross the small container header sizes
+            for (int32 Property = 0; Property < Index; ++Property)
+            {
+                Node.Properties.Add(FString::Printf(TEXT("Key%d"), Property), FString::ChrN(Property * 20, TEXT('v')));
+            }
+        }
+
+        return BlueprintData;
+    }
+
+    /**
+     * Encode blueprints in every binary format, decode them back to JSON and compare with the JSON response
+     * Usage: BlueprintAnalyzer.CheckWireFormats [MaxBlueprints]
+     */
+    void CheckWireFormats(const TArray<FString>& Args)
+    {
+        const int32 MaxBlueprints = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 20;
+
+        TArray<FBlueprintData> Blueprints;
+        Blueprints.Add(MakeEdgeCaseBlueprint());
+
+        const TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetailLevel::Basic);
+        for (int32 Index = 0; Index < AllBlueprints.Num() && Index < MaxBlueprints; ++Index)
+        {
+            TOptional<FBlueprintData> BlueprintData = FBlueprintDataExtractor::GetBlueprintByPath(AllBlueprints[Index].Path, EBlueprintDetailLevel::Graph);
+            if (BlueprintData.IsSet())
+            {
+                Blueprints.Add(MoveTemp(BlueprintData.GetValue()));
+            }
+        }
+
+        static const TCHAR* FormatNames[] = { TEXT("JSON"), TEXT("CBOR"), TEXT("MessagePack") };
+
+        int64 JsonBytes = 0;
+        int64 EncodedBytes[3] = {};
+        int32 Failures = 0;
+
+        for (const FBlueprintData& BlueprintData : Blueprints)
+        {
+            const TArray<uint8> Json = EncodeJson(BlueprintData);
+            JsonBytes += Json.Num();
+
+            for (EBlueprintWireFormat Format : { EBlueprintWireFormat::Cbor, EBlueprintWireFormat::MessagePack })
+            {
+                const TArray<uint8> Encoded = EncodeBinary(BlueprintData, Format);
+                EncodedBytes[static_cast<int32>(Format)] += Encoded.Num();
+
+                FBlueprintUtf8JsonWriter Decoded;
+                const bool bDecoded = FBlueprintBinaryWriter::DecodeToJson(Encoded, Format, Decoded) && Decoded.Close();
+                if (!bDecoded || Decoded.MoveBytes() != Json)
+                {
+                    ++Failures;
+                    UE_LOG(LogTemp, Error, TEXT("%s round trip of %s does not match the JSON response%s"),
+                        FormatNames[static_cast<int32>(Format)], *BlueprintData.Path, bDecoded ? TEXT("") : TEXT(" (decode failed)"));
+                }
+            }
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Wire format conformance over %d blueprints: %d failures. JSON %lld bytes, CBOR %lld bytes (%.0f%%), MessagePack %lld bytes (%.0f%%)"),
+            Blueprints.Num(), Failures, JsonBytes,
+            EncodedBytes[static_cast<int32>(EBlueprintWireFormat::Cbor)], JsonBytes > 0 ? 100.0 * EncodedBytes[static_cast<int32>(EBlueprintWireFormat::Cbor)] / JsonBytes : 0.0,
+            EncodedBytes[static_cast<int32>(EBlueprintWireFormat::MessagePack)], JsonBytes > 0 ? 100.0 * EncodedBytes[static_cast<int32>(EBlueprintWireFormat::MessagePack)] / JsonBytes : 0.0);
+    }
+
+    FAutoConsoleCommand CheckWireFormatsCommand(
+        TEXT("BlueprintAnalyzer.CheckWireFormats"),
+        TEXT("Check that CBOR and MessagePack responses decode to the JSON response. Usage: BlueprintAnalyzer.CheckWireFormats [MaxBlueprints]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CheckWireFormats));
+}
+
+FBlueprintBinaryWriter::FBlueprintBinaryWriter(EBlueprintWireFormat InFormat, int32 InitialCapacity)
+    : Format(InFormat)
+{
+    check(Format == EBlueprintWireFormat::Cbor || Format == EBlueprintWireFormat::MessagePack);
+    Bytes.Reserve(InitialCapacity);
+}
+
+void FBlueprintBinaryWriter::WriteObjectStart()
+{
+    BeginValue();
+    OpenScope(true);
+}
+
+void FBlueprintBinaryWriter::WriteObjectStart(FStringView Identifier)
+{
+    WriteKey(Identifier);
+    OpenScope(true);
+}
+
+void FBlueprintBinaryWriter::WriteObjectEnd()
+{
+    CloseScope(true);
+}
+
+void FBlueprintBinaryWriter::WriteArrayStart()
+{
+    BeginValue();
+    OpenScope(false);
+}
+
+void FBlueprintBinaryWriter::WriteArrayStart(FStringView Identifier)
+{
+    WriteKey(Identifier);
+    OpenScope(false);
+}
+
+void FBlueprintBinaryWriter::WriteArrayEnd()
+{
+    CloseScope(false);
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Value)
+{
+    BeginValue();
+    AppendString(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(const FString& Value)
+{
+    WriteValue(FStringView(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(const TCHAR* Value)
+{
+    WriteValue(FStringView(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(bool Value)
+{
+    BeginValue();
+    AppendBool(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(int32 Value)
+{
+    WriteValue(static_cast<int64>(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(int64 Value)
+{
+    BeginValue();
+    AppendInteger(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(double Value)
+{
+    BeginValue();
+    AppendDouble(Value);
+}
+
+void FBlueprintBinaryWriter::WriteNull()
+{
+    BeginValue();
+    AppendNull();
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, FStringView Value)
+{
+    WriteKey(Identifier);
+    AppendString(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, const FString& Value)
+{
+    WriteValue(Identifier, FStringView(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, const TCHAR* Value)
+{
+    WriteValue(Identifier, FStringView(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, bool Value)
+{
+    WriteKey(Identifier);
+    AppendBool(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, int32 Value)
+{
+    WriteValue(Identifier, static_cast<int64>(Value));
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, int64 Value)
+{
+    WriteKey(Identifier);
+    AppendInteger(Value);
+}
+
+void FBlueprintBinaryWriter::WriteValue(FStringView Identifier, double Value)
+{
+    WriteKey(Identifier);
+    AppendDouble(Value);
+}
+
+void FBlueprintBinaryWriter::WriteNull(FStringView Identifier)
+{
+    WriteKey(Identifier);
+    AppendNull();
+}
+
+void FBlueprintBinaryWriter::WriteRawValue(TConstArrayView<uint8> Encoded)
+{
+    BeginValue();
+    Bytes.Append(Encoded.GetData(), Encoded.Num());
+}
+
+bool FBlueprintBinaryWriter::Close()
+{
+    return Scopes.Num() == 0 && Bytes.Num() > 0;
+}
+
+TArray<uint8> FBlueprintBinaryWriter::MoveBytes()
+{
+    Scopes.Reset();
+    return MoveTemp(Bytes);
+}
+
+bool FBlueprintBinaryWriter::DecodeToJson(TConstArrayView<uint8> Bytes, EBlueprintWireFormat Format, FBlueprintUtf8JsonWriter& Writer)
+{
+    if (Format != EBlueprintWireFormat::Cbor && Format != EBlueprintWireFormat::MessagePack)
+    {
+        return false;
+    }
+
+    BlueprintBinaryWriter::FDecoder Decoder(Bytes, Format, Writer);
+    return Decoder.Run();
+}
+
+const TCHAR* FBlueprintBinaryWriter::GetContentType(EBlueprintWireFormat Format)
+{
+    switch (Format)
+    {
+    case EBlueprintWireFormat::Cbor:
+        return TEXT("application/cbor");
+    case EBlueprintWireFormat::MessagePack:
+        return TEXT("application/msgpack");
+    default:
+        return TEXT("application/json");
+    }
+}
+
+EBlueprintWireFormat FBlueprintBinaryWriter::NegotiateFormat(FStringView AcceptHeader)
+{
+    EBlueprintWireFormat BestFormat = EBlueprintWireFormat::Json;
+    float BestQuality = 0.0f;
+
+    TArray<FString> MediaRanges;
+    FString(AcceptHeader).ParseIntoArray(MediaRanges, TEXT(","), true);
+
+    for (const FString& MediaRange : MediaRanges)
+    {
+        TArray<FString> Parts;
+        MediaRange.ParseIntoArray(Parts, TEXT(";"), true);
+        if (Parts.Num() == 0)
+        {
+            continue;
+        }
+
+        const FString MediaType = Parts[0].TrimStartAndEnd();
+        EBlueprintWireFormat Format;
+        if (MediaType.Equals(TEXT("application/cbor"), ESearchCase::IgnoreCase))
+        {
+            Format = EBlueprintWireFormat::Cbor;
+        }
+        else if (MediaType.Equals(TEXT("application/msgpack"), ESearchCase::IgnoreCase)
+            || MediaType.Equals(TEXT("application/x-msgpack"), ESearchCase::IgnoreCase)
+            || MediaType.Equals(TEXT("application/vnd.msgpack"), ESearchCase::IgnoreCase))
+        {
+            Format = EBlueprintWireFormat::MessagePack;
+        }
+        else if (MediaType.Equals(TEXT("application/json"), ESearchCase::IgnoreCase))
+        {
+            Format = EBlueprintWireFormat::Json;
+        }
+        else
+        {
+            continue;
+        }
+
+        float Quality = 1.0f;
+        for (int32 Index = 1; Index < Parts.Num(); ++Index)
+        {
+            const FString Parameter = Parts[Index].TrimStartAndEnd();
+            if (Parameter.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+            {
+                Quality = FCString::Atof(*Parameter + 2);
+            }
+        }
+
+        // Earlier entries win ties
+        if (Quality > BestQuality)
+        {
+            BestFormat = Format;
+            BestQuality = Quality;
+        }
+    }
+
+    return BestFormat;
+}
+
+void FBlueprintBinaryWriter::BeginValue()
+{
+    if (Scopes.Num() > 0)
+    {
+        ++Scopes.Last().Count;
+    }
+}
+
+void FBlueprintBinaryWriter::WriteKey(FStringView Identifier)
+{
+    // A field counts once, as one map entry
+    BeginValue();
+    AppendString(Identifier);
+}
+
+void FBlueprintBinaryWriter::OpenScope(bool bObject)
+{
+    FScope& Scope = Scopes.AddDefaulted_GetRef();
+    Scope.HeaderOffset = Bytes.Num();
+    Scope.bObject = bObject;
+
+    if (Format == EBlueprintWireFormat::Cbor)
+    {
+        // Indefinite-length map or array, closed by a break byte
+        Bytes.Add(bObject ? 0xBF : 0x9F);
+    }
+    else
+    {
+        // map32 or array32, count patched on close
+        Bytes.Add(bObject ? 0xDF : 0xDD);
+        Bytes.AddZeroed(BlueprintBinaryWriter::MessagePackContainerHeaderSize - 1);
+    }
+}
+
+void FBlueprintBinaryWriter::CloseScope(bool bObject)
+{
+    if (!ensureMsgf(Scopes.Num() > 0 && Scopes.Last().bObject == bObject, TEXT("Unbalanced binary writer end")))
+    {
+        return;
+    }
+
+    const FScope Scope = Scopes.Pop(EAllowShrinking::No);
+
+    if (Format == EBlueprintWireFormat::Cbor)
+    {
+        Bytes.Add(0xFF);
+        return;
+    }
+
+    const int32 ContentOffset = Scope.HeaderOffset + BlueprintBinaryWriter::MessagePackContainerHeaderSize;
+    if (Scope.Count < BlueprintBinaryWriter::MaxFixCount && Bytes.Num() - ContentOffset <= BlueprintBinaryWriter::MaxShrinkBytes)
+    {
+        // fixmap or fixarray; most pins, nodes and property maps end up here
+        Bytes[Scope.HeaderOffset] = static_cast<uint8>((bObject ? 0x80 : 0x90) | Scope.Count);
+        Bytes.RemoveAt(Scope.HeaderOffset + 1, BlueprintBinaryWriter::MessagePackContainerHeaderSize - 1, EAllowShrinking::No);
+        return;
+    }
+
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Bytes[Scope.HeaderOffset + 1 + Index] = static_cast<uint8>(Scope.Count >> (8 * (3 - Index)));
+    }
+}
+
+void FBlueprintBinaryWriter::AppendString(FStringView Value)
+{
+    // UTF-8 is at least as long as UTF-16 in code units, so size the header for that and widen it if needed
+    uint8 Header[9];
+    const int32 Start = Bytes.Num();
+    const int32 ReservedHeaderSize = BlueprintBinaryWriter::EncodeStringHeader(Format, Value.Len(), Header);
+    Bytes.AddUninitialized(ReservedHeaderSize);
+
+    FBlueprintUtf8JsonWriter::AppendUtf8(Bytes, Value);
+
+    const int32 Length = Bytes.Num() - Start - ReservedHeaderSize;
+    const int32 HeaderSize = BlueprintBinaryWriter::EncodeStringHeader(Format, Length, Header);
+    if (HeaderSize > ReservedHeaderSize)
+    {
+        Bytes.InsertUninitialized(Start, HeaderSize - ReservedHeaderSize);
+    }
+    FMemory::Memcpy(Bytes.GetData() + Start, Header, HeaderSize);
+}
+
+void FBlueprintBinaryWriter::AppendBool(bool Value)
+{
+    if (Format == EBlueprintWireFormat::Cbor)
+    {
+        Bytes.Add(Value ? 0xF5 : 0xF4);
+    }
+    else
+    {
+        Bytes.Add(Value ? 0xC3 : 0xC2);
+    }
+}
+
+void FBlueprintBinaryWriter::AppendInteger(int64 Value)
+{
+    if (Format == EBlueprintWireFormat::Cbor)
+    {
+        // Major type 0 for non-negative values, 1 for negative ones encoded as -1 - Value
+        if (Value >= 0)
+        {
+            AppendCborHead(0, static_cast<uint64>(Value));
+        }
+        else
+        {
+            AppendCborHead(1, ~static_cast<uint64>(Value));
+        }
+        return;
+    }
+
+    if (Value >= 0)
+    {
+        if (Value < 0x80)
+        {
+            Bytes.Add(static_cast<uint8>(Value));
+        }
+        else if (Value <= 0xFF)
+        {
+            Bytes.Add(0xCC);
+            AppendBigEndian(Value, 1);
+        }
+        else if (Value <= 0xFFFF)
+        {
+            Bytes.Add(0xCD);
+            AppendBigEndian(Value, 2);
+        }
+        else if (Value <= 0xFFFFFFFF)
+        {
+            Bytes.Add(0xCE);
+            AppendBigEndian(Value, 4);
+        }
+        else
+        {
+            Bytes.Add(0xCF);
+            AppendBigEndian(Value, 8);
+        }
+    }
+    else if (Value >= -32)
+    {
+        // Negative fixint
+        Bytes.Add(static_cast<uint8>(Value));
+    }
+    else if (Value >= MIN_int8)
+    {
+        Bytes.Add(0xD0);
+        AppendBigEndian(static_cast<uint64>(Value), 1);
+    }
+    else if (Value >= MIN_int16)
+    {
+        Bytes.Add(0xD1);
+        AppendBigEndian(static_cast<uint64>(Value), 2);
+    }
+    else if (Value >= MIN_int32)
+    {
+        Bytes.Add(0xD2);
+        AppendBigEndian(static_cast<uint64>(Value), 4);
+    }
+    else
+    {
+        Bytes.Add(0xD3);
+        AppendBigEndian(static_cast<uint64>(Value), 8);
+    }
+}
+
+void FBlueprintBinaryWriter::AppendDouble(double Value)
+{
+    // Same as the JSON writers, which have no spelling for NaN or infinity
+    if (!FMath::IsFinite(Value))
+    {
+        AppendNull();
+        return;
+    }
+
+    uint64 Bits;
+    FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+    Bytes.Add(Format == EBlueprintWireFormat::Cbor ? 0xFB : 0xCB);
+    AppendBigEndian(Bits, 8);
+}
+
+void FBlueprintBinaryWriter::AppendNull()
+{
+    Bytes.Add(Format == EBlueprintWireFormat::Cbor ? 0xF6 : 0xC0);
+}
+
+void FBlueprintBinaryWriter::AppendCborHead(uint8 MajorType, uint64 Argument)
+{
+    const uint8 Major = static_cast<uint8>(MajorType << 5);
+    if (Argument < 24)
+    {
+        Bytes.Add(static_cast<uint8>(Major | Argument));
+    }
+    else if (Argument <= 0xFF)
+    {
+        Bytes.Add(Major | 24);
+        AppendBigEndian(Argument, 1);
+    }
+    else if (Argument <= 0xFFFF)
+    {
+        Bytes.Add(Major | 25);
+        AppendBigEndian(Argument, 2);
+    }
+    else if (Argument <= 0xFFFFFFFF)
+    {
+        Bytes.Add(Major | 26);
+        AppendBigEndian(Argument, 4);
+    }
+    else
+    {
+        Bytes.Add(Major | 27);
+        AppendBigEndian(Argument, 8);
+    }
+}
+
+void FBlueprintBinaryWriter::AppendBigEndian(uint64 Value, int32 NumBytes)
+{
+    for (int32 Index = NumBytes - 1; Index >= 0; --Index)
+    {
+        Bytes.Add(static_cast<uint8>(Value >> (8 * Index)));
+    }
+}
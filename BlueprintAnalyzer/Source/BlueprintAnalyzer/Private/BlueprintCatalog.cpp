@@ -0,0 +1,1272 @@
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+#include "BlueprintAnalyzer/Public/BlueprintDataExtractor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_ComponentBoundEvent.h"
+#include "UObject/Package.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UObjectHash.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/BinarySearch.h"
+
+// Initialize static members
+TArray<FBlueprintCatalogEntry> FBlueprintCatalog::Entries;
+TArray<int32> FBlueprintCatalog::FreeEntryIds;
+TMap<FString, int32> FBlueprintCatalog::PathToEntryId;
+FBlueprintTrigramIndex FBlueprintCatalog::TrigramIndex;
+FBlueprintNameArena FBlueprintCatalog::NameArena;
+FBlueprintSignatureIndex FBlueprintCatalog::SignatureIndex;
+FBlueprintCompletionTrie FBlueprintCatalog::CompletionTrie;
+FBlueprintPathTree FBlueprintCatalog::PathTree;
+FBlueprintLeaderboard FBlueprintCatalog::Leaderboards[static_cast<int32>(EBlueprintLeaderboardMetric::Count)];
+TMap<FName, int32> FBlueprintCatalog::IncomingReferenceCounts;
+TMap<FName, int32> FBlueprintCatalog::PackageToEntryId;
+FBlueprintRankedIndex FBlueprintCatalog::RankedIndex;
+TArray<FBlueprintGraphText> FBlueprintCatalog::GraphTexts;
+TArray<int32> FBlueprintCatalog::FreeGraphTextIds;
+FBlueprintTrigramIndex FBlueprintCatalog::GraphTextIndex;
+TMap<FString, TArray<FBlueprintGraphRef>> FBlueprintCatalog::NodeClassPostings;
+TMap<FString, TArray<FBlueprintGraphRef>> FBlueprintCatalog::EventPostings;
+uint64 FBlueprintCatalog::Generation = 0;
+bool FBlueprintCatalog::bBuilt = false;
+FDelegateHandle FBlueprintCatalog::AssetAddedHandle;
+FDelegateHandle FBlueprintCatalog::AssetRemovedHandle;
+FDelegateHandle FBlueprintCatalog::AssetUpdatedHandle;
+FDelegateHandle FBlueprintCatalog::AssetRenamedHandle;
+FDelegateHandle FBlueprintCatalog::PackageSavedHandle;
+
+namespace BlueprintCatalog
+{
+    /**
+     * Group an entry's graphs by the normalized node classes and event names they contain
+     * Graph indices come out ascending, so they can be spliced into the sorted posting lists as is.
+     */
+    void CollectGraphKeys(const FBlueprintCatalogEntry& Entry, TMap<FString, TArray<int32>>& OutNodeClassGraphs, TMap<FString, TArray<int32>>& OutEventGraphs)
+    {
+        for (int32 GraphIndex = 0; GraphIndex < Entry.GraphSummaries.Num(); ++GraphIndex)
+        {
+            for (const FBlueprintGraphSummaryNode& Node : Entry.GraphSummaries[GraphIndex].Nodes)
+            {
+                TArray<int32>& ClassGraphs = OutNodeClassGraphs.FindOrAdd(FBlueprintCatalog::NormalizeNodeClass(Node.NodeClass));
+                if (ClassGraphs.Num() == 0 || ClassGraphs.Last() != GraphIndex)
+                {
+                    ClassGraphs.Add(GraphIndex);
+                }
+
+                if (!Node.EventName.IsEmpty())
+                {
+                    TArray<int32>& EventGraphs = OutEventGraphs.FindOrAdd(FBlueprintCatalog::NormalizeEventName(Node.EventName));
+                    if (EventGraphs.Num() == 0 || EventGraphs.Last() != GraphIndex)
+                    {
+                        EventGraphs.Add(GraphIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Count the summarized graph nodes of an entry
+     */
+    int32 GetNodeCount(const FBlueprintCatalogEntry& Entry)
+    {
+        int32 NodeCount = 0;
+        for (const FBlueprintGraphSummary& Summary : Entry.GraphSummaries)
+        {
+            NodeCount += Summary.Nodes.Num();
+        }
+        return NodeCount;
+    }
+
+    /**
+     * Get the package name of an entry from its object path
+     */
+    FName GetPackageName(const FBlueprintCatalogEntry& Entry)
+    {
+        return FName(*FPackageName::ObjectPathToPackageName(Entry.Data.Path));
+    }
+
+    /**
+     * Get an entry's value for a leaderboard metric
+     * @param ReferenceCount Number of blueprints referencing the entry's package
+     */
+    int64 GetLeaderboardValue(const FBlueprintCatalogEntry& Entry, EBlueprintLeaderboardMetric Metric, int32 ReferenceCount)
+    {
+        switch (Metric)
+        {
+        case EBlueprintLeaderboardMetric::NodeCount:
+            return GetNodeCount(Entry);
+
+        case EBlueprintLeaderboardMetric::GraphCount:
+            return Entry.GraphSummaries.Num();
+
+        case EBlueprintLeaderboardMetric::VariableCount:
+            return Entry.Data.Variables.Num();
+
+        case EBlueprintLeaderboardMetric::ReferenceCount:
+            return ReferenceCount;
+
+        case EBlueprintLeaderboardMetric::PackageSize:
+            return Entry.PackageSize;
+
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Visit the completion terms of an entry with the score each contributes
+     * Names and paths score by graph size so larger blueprints rank first; members score one per blueprint.
+     */
+    void ForEachCompletionTerm(const FBlueprintCatalogEntry& Entry, TFunctionRef<void(EBlueprintCompletionKind, const FString&, int32)> Visit)
+    {
+        const int32 NodeCount = GetNodeCount(Entry);
+
+        Visit(EBlueprintCompletionKind::Name, Entry.Data.Name, 1 + NodeCount);
+        Visit(EBlueprintCompletionKind::Path, Entry.Data.Path, 1 + NodeCount);
+
+        for (const FBlueprintFunctionData& Function : Entry.Data.Functions)
+        {
+            Visit(Function.IsEvent ? EBlueprintCompletionKind::Event : EBlueprintCompletionKind::Function, Function.Name, 1);
+        }
+    }
+
+    /**
+     * Splice an entry's graphs into posting lists sorted by entry id and graph index
+     */
+    void AddGraphPostings(TMap<FString, TArray<FBlueprintGraphRef>>& Postings, int32 EntryId, const TMap<FString, TArray<int32>>& GraphsByKey)
+    {
+        for (const TPair<FString, TArray<int32>>& KeyGraphs : GraphsByKey)
+        {
+            TArray<FBlueprintGraphRef>& PostingList = Postings.FindOrAdd(KeyGraphs.Key);
+
+            int32 InsertIndex = Algo::LowerBoundBy(PostingList, EntryId, &FBlueprintGraphRef::EntryId);
+            for (int32 GraphIndex : KeyGraphs.Value)
+            {
+                PostingList.Insert(FBlueprintGraphRef{ EntryId, GraphIndex }, InsertIndex++);
+            }
+        }
+    }
+
+    /**
+     * Cut an entry's graphs out of posting lists sorted by entry id and graph index
+     */
+    void RemoveGraphPostings(TMap<FString, TArray<FBlueprintGraphRef>>& Postings, int32 EntryId, const TMap<FString, TArray<int32>>& GraphsByKey)
+    {
+        for (const TPair<FString, TArray<int32>>& KeyGraphs : GraphsByKey)
+        {
+            TArray<FBlueprintGraphRef>* PostingList = Postings.Find(KeyGraphs.Key);
+            if (!PostingList)
+            {
+                continue;
+            }
+
+            const int32 First = Algo::LowerBoundBy(*PostingList, EntryId, &FBlueprintGraphRef::EntryId);
+            const int32 Last = Algo::UpperBoundBy(*PostingList, EntryId, &FBlueprintGraphRef::EntryId);
+            PostingList->RemoveAt(First, Last - First, EAllowShrinking::No);
+
+            if (PostingList->Num() == 0)
+            {
+                Postings.Remove(KeyGraphs.Key);
+            }
+        }
+    }
+}
+
+void FBlueprintCatalog::Initialize()
+{
+#if WITH_EDITOR
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    // Listen for asset changes so the catalog stays current without rescans
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FBlueprintCatalog::OnAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FBlueprintCatalog::OnAssetRemoved);
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddStatic(&FBlueprintCatalog::OnAssetUpdated);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FBlueprintCatalog::OnAssetRenamed);
+
+    // Saves are where functions and variables change, so refresh member data on save
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddStatic(&FBlueprintCatalog::OnPackageSaved);
+
+    UE_LOG(LogTemp, Log, TEXT("Blueprint catalog initialized"));
+#endif
+}
+
+void FBlueprintCatalog::Shutdown()
+{
+#if WITH_EDITOR
+    if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+#endif
+
+    // Drop all cached data
+    Entries.Empty();
+    FreeEntryIds.Empty();
+    PathToEntryId.Empty();
+    TrigramIndex.Reset();
+    NameArena.Reset();
+    SignatureIndex.Reset();
+    CompletionTrie.Reset();
+    PathTree.Reset();
+    for (FBlueprintLeaderboard& Leaderboard : Leaderboards)
+    {
+        Leaderboard.Reset();
+    }
+    IncomingReferenceCounts.Empty();
+    PackageToEntryId.Empty();
+    RankedIndex.Reset();
+    GraphTexts.Empty();
+    FreeGraphTextIds.Empty();
+    GraphTextIndex.Reset();
+    NodeClassPostings.Empty();
+    EventPostings.Empty();
+    bBuilt = false;
+    ++Generation;
+}
+
+void FBlueprintCatalog::EnsureBuilt()
+{
+    if (bBuilt)
+    {
+        return;
+    }
+
+#if WITH_EDITOR
+    // Get the asset registry module
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    // Make sure the asset registry is loaded
+    TArray<FString> ContentPaths;
+    ContentPaths.Add(TEXT("/Game"));
+    AssetRegistry.ScanPathsSynchronous(ContentPaths);
+
+    // Query for all blueprint assets
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+
+    TArray<FAssetData> AssetData;
+    AssetRegistry.GetAssets(Filter, AssetData);
+
+    // Set the flag first so AddOrUpdateAsset doesn't recurse into EnsureBuilt
+    bBuilt = true;
+
+    Entries.Reserve(AssetData.Num());
+    for (const FAssetData& Asset : AssetData)
+    {
+        AddOrUpdateAsset(Asset);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Blueprint catalog built with %d blueprints"), PathToEntryId.Num());
+#endif
+}
+
+uint64 FBlueprintCatalog::GetGeneration()
+{
+    return Generation;
+}
+
+void FBlueprintCatalog::GetAllEntryIds(TArray<int32>& OutIds)
+{
+    EnsureBuilt();
+
+    OutIds.Reset(PathToEntryId.Num());
+    for (int32 EntryId = 0; EntryId < Entries.Num(); ++EntryId)
+    {
+        if (Entries[EntryId].bIsValid)
+        {
+            OutIds.Add(EntryId);
+        }
+    }
+}
+
+int32 FBlueprintCatalog::GetNumEntries()
+{
+    EnsureBuilt();
+
+    return PathToEntryId.Num();
+}
+
+int32 FBlueprintCatalog::GetNumEntriesWithMemberData()
+{
+    int32 Count = 0;
+    for (const FBlueprintCatalogEntry& Entry : Entries)
+    {
+        if (Entry.bIsValid && Entry.bHasMemberData)
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+const FBlueprintCatalogEntry* FBlueprintCatalog::GetEntry(int32 EntryId)
+{
+    if (Entries.IsValidIndex(EntryId) && Entries[EntryId].bIsValid)
+    {
+        return &Entries[EntryId];
+    }
+    return nullptr;
+}
+
+int32 FBlueprintCatalog::FindEntryId(const FString& Path)
+{
+    EnsureBuilt();
+
+    const int32* EntryId = PathToEntryId.Find(Path);
+    return EntryId ? *EntryId : INDEX_NONE;
+}
+
+bool FBlueprintCatalog::HasUnsavedChanges(const FString& Path)
+{
+    const UPackage* Package = FindPackage(nullptr, *FPackageName::ObjectPathToPackageName(Path));
+    return Package && Package->IsDirty();
+}
+
+void FBlueprintCatalog::EnsureMemberData(TConstArrayView<int32> EntryIds)
+{
+#if WITH_EDITOR
+    // Collect the entries that still need member data
+    TArray<int32> MissingIds;
+    for (int32 EntryId : EntryIds)
+    {
+        const FBlueprintCatalogEntry* Entry = GetEntry(EntryId);
+        if (Entry && !Entry->bHasMemberData)
+        {
+            MissingIds.Add(EntryId);
+        }
+    }
+
+    if (MissingIds.Num() == 0)
+    {
+        return;
+    }
+
+    // Member data needs the blueprints loaded; load them in one batch, after this it's maintained on save
+    TArray<UBlueprint*> Blueprints;
+    LoadBlueprints(MissingIds, Blueprints);
+
+    int32 LoadedCount = 0;
+    for (int32 i = 0; i < MissingIds.Num(); ++i)
+    {
+        if (Blueprints[i])
+        {
+            RefreshMemberData(MissingIds[i], Blueprints[i]);
+            ++LoadedCount;
+        }
+    }
+
+    if (LoadedCount > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Blueprint catalog extracted member data for %d blueprints"), LoadedCount);
+    }
+#endif
+}
+
+void FBlueprintCatalog::LoadBlueprints(TConstArrayView<int32> EntryIds, TArray<UBlueprint*>& OutBlueprints)
+{
+    OutBlueprints.Reset(EntryIds.Num());
+
+#if WITH_EDITOR
+    // Use blueprints that are already in memory and gather the paths of the rest
+    TArray<FSoftObjectPath> PathsToLoad;
+    for (int32 EntryId : EntryIds)
+    {
+        const FBlueprintCatalogEntry* Entry = GetEntry(EntryId);
+        UBlueprint* Blueprint = Entry ? FindObject<UBlueprint>(nullptr, *Entry->Data.Path) : nullptr;
+        if (Entry && !Blueprint)
+        {
+            PathsToLoad.Emplace(Entry->Data.Path);
+        }
+        OutBlueprints.Add(Blueprint);
+    }
+
+    if (PathsToLoad.Num() == 0)
+    {
+        return;
+    }
+
+    // A single request lets the loader batch package reads instead of loading one asset at a time.
+    // Created on first use since it registers with the garbage collector.
+    static FStreamableManager StreamableManager;
+    TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestSyncLoad(PathsToLoad);
+
+    for (int32 i = 0; i < EntryIds.Num(); ++i)
+    {
+        const FBlueprintCatalogEntry* Entry = GetEntry(EntryIds[i]);
+        if (Entry && !OutBlueprints[i])
+        {
+            OutBlueprints[i] = Cast<UBlueprint>(FSoftObjectPath(Entry->Data.Path).ResolveObject());
+        }
+    }
+
+    if (Handle.IsValid())
+    {
+        Handle->ReleaseHandle();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Blueprint catalog batch loaded %d blueprints"), PathsToLoad.Num());
+#else
+    OutBlueprints.SetNumZeroed(EntryIds.Num());
+#endif
+}
+
+void FBlueprintCatalog::FindSubstring(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutIds)
+{
+    EnsureBuilt();
+
+    OutIds.Reset();
+
+    // Try the trigram index first and only verify its candidates
+    TArray<int32> Candidates;
+    if (!TrigramIndex.Query(Field, Needle, Candidates))
+    {
+        if (!Needle.IsEmpty())
+        {
+            // Needle too short for trigrams, scan the packed arena instead of every entry's strings
+            NameArena.Find(Field, Needle, OutIds);
+            return;
+        }
+
+        GetAllEntryIds(Candidates);
+    }
+
+    for (int32 EntryId : Candidates)
+    {
+        const FBlueprintCatalogEntry* Entry = GetEntry(EntryId);
+        if (Entry && FieldContains(*Entry, Field, Needle))
+        {
+            OutIds.Add(EntryId);
+        }
+    }
+}
+
+void FBlueprintCatalog::ScanSubstring(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutIds)
+{
+    EnsureBuilt();
+
+    NameArena.Find(Field, Needle, OutIds);
+}
+
+void FBlueprintCatalog::RankedSearch(const FString& Query, int32 MaxResults, TArray<FBlueprintRankedHit>& OutHits, int32* OutTotalMatches)
+{
+    EnsureBuilt();
+
+    RankedIndex.Search(Query, MaxResults, OutHits, OutTotalMatches);
+}
+
+void FBlueprintCatalog::FindSignature(const FBlueprintSignatureQuery& Query, TArray<FBlueprintSignatureMatch>& OutMatches)
+{
+    EnsureBuilt();
+
+    SignatureIndex.Find(Query, OutMatches);
+}
+
+void FBlueprintCatalog::FindEntriesWithNodeClass(const FString& NodeClass, TArray<int32>& OutIds)
+{
+    EnsureBuilt();
+
+    OutIds.Reset();
+    if (const TArray<FBlueprintGraphRef>* PostingList = NodeClassPostings.Find(NormalizeNodeClass(NodeClass)))
+    {
+        // Graphs of one entry are adjacent, so skipping repeats leaves the entry ids sorted and unique
+        for (const FBlueprintGraphRef& GraphRef : *PostingList)
+        {
+            if (OutIds.Num() == 0 || OutIds.Last() != GraphRef.EntryId)
+            {
+                OutIds.Add(GraphRef.EntryId);
+            }
+        }
+    }
+}
+
+void FBlueprintCatalog::FindGraphsWithNodeClass(const FString& NodeClass, TArray<FBlueprintGraphRef>& OutGraphs)
+{
+    EnsureBuilt();
+
+    OutGraphs.Reset();
+    if (const TArray<FBlueprintGraphRef>* PostingList = NodeClassPostings.Find(NormalizeNodeClass(NodeClass)))
+    {
+        OutGraphs = *PostingList;
+    }
+}
+
+void FBlueprintCatalog::FindGraphsWithEvent(const FString& EventName, TArray<FBlueprintGraphRef>& OutGraphs)
+{
+    EnsureBuilt();
+
+    OutGraphs.Reset();
+    if (const TArray<FBlueprintGraphRef>* PostingList = EventPostings.Find(NormalizeEventName(EventName)))
+    {
+        OutGraphs = *PostingList;
+    }
+}
+
+FString FBlueprintCatalog::NormalizeNodeClass(const FString& NodeClass)
+{
+    FString Normalized = NodeClass.ToLower();
+    Normalized.RemoveFromStart(TEXT("k2node_"));
+    return Normalized;
+}
+
+FString FBlueprintCatalog::NormalizeEventName(const FString& EventName)
+{
+    FString Normalized = EventName.ToLower().Replace(TEXT(" "), TEXT(""));
+
+    // Native events are ReceiveX in code and "Event X" in the editor, people usually just type X
+    if (!Normalized.RemoveFromStart(TEXT("receive")))
+    {
+        Normalized.RemoveFromStart(TEXT("event"));
+    }
+    return Normalized;
+}
+
+void FBlueprintCatalog::Complete(const FString& Prefix, int32 MaxResults, TOptional<EBlueprintCompletionKind> Kind, TArray<FBlueprintCompletion>& OutCompletions)
+{
+    EnsureBuilt();
+
+    CompletionTrie.Complete(Prefix, MaxResults, Kind, OutCompletions);
+}
+
+bool FBlueprintCatalog::GetFolderListing(const FString& PackagePath, FBlueprintFolderListing& OutListing)
+{
+    EnsureBuilt();
+
+    return PathTree.GetListing(PackagePath, OutListing);
+}
+
+void FBlueprintCatalog::GetTop(EBlueprintLeaderboardMetric Metric, int32 MaxResults, TArray<FBlueprintLeaderboardSlot>& OutSlots)
+{
+    EnsureBuilt();
+
+    Leaderboards[static_cast<int32>(Metric)].GetTop(MaxResults, OutSlots);
+}
+
+void FBlueprintCatalog::FindGraphText(const FString& Needle, TArray<int32>& OutIds)
+{
+    EnsureBuilt();
+
+    OutIds.Reset();
+
+    // Try the trigram index first and only verify its candidates
+    TArray<int32> Candidates;
+    const bool bUsedIndex = GraphTextIndex.Query(EBlueprintSearchField::GraphText, Needle, Candidates);
+
+    const int32 NumToCheck = bUsedIndex ? Candidates.Num() : GraphTexts.Num();
+    for (int32 i = 0; i < NumToCheck; ++i)
+    {
+        // Needle too short for trigrams, fall back to checking every graph text
+        const int32 GraphTextId = bUsedIndex ? Candidates[i] : i;
+        const FBlueprintGraphText* GraphText = GetGraphText(GraphTextId);
+        if (GraphText && GraphText->Text.Contains(Needle, ESearchCase::IgnoreCase))
+        {
+            OutIds.Add(GraphTextId);
+        }
+    }
+}
+
+const FBlueprintGraphText* FBlueprintCatalog::GetGraphText(int32 GraphTextId)
+{
+    if (GraphTexts.IsValidIndex(GraphTextId) && GraphTexts[GraphTextId].EntryId != INDEX_NONE)
+    {
+        return &GraphTexts[GraphTextId];
+    }
+    return nullptr;
+}
+
+int32 FBlueprintCatalog::EstimateSubstring(EBlueprintSearchField Field, const FString& Needle)
+{
+    EnsureBuilt();
+
+    return TrigramIndex.EstimateCandidates(Field, Needle);
+}
+
+bool FBlueprintCatalog::FieldContains(const FBlueprintCatalogEntry& Entry, EBlueprintSearchField Field, const FString& Needle)
+{
+    switch (Field)
+    {
+    case EBlueprintSearchField::Name:
+        return Entry.Data.Name.Contains(Needle, ESearchCase::IgnoreCase);
+
+    case EBlueprintSearchField::Path:
+        return Entry.Data.Path.Contains(Needle, ESearchCase::IgnoreCase);
+
+    case EBlueprintSearchField::ParentClass:
+        return Entry.Data.ParentClass.Contains(Needle, ESearchCase::IgnoreCase);
+
+    case EBlueprintSearchField::Function:
+        for (const FBlueprintFunctionData& Function : Entry.Data.Functions)
+        {
+            if (Function.Name.Contains(Needle, ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return false;
+
+    case EBlueprintSearchField::Variable:
+        for (const FBlueprintVariableData& Variable : Entry.Data.Variables)
+        {
+            if (Variable.Name.Contains(Needle, ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return false;
+
+    case EBlueprintSearchField::VariableType:
+        for (const FBlueprintVariableData& Variable : Entry.Data.Variables)
+        {
+            if (Variable.Type.Contains(Needle, ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return false;
+
+    case EBlueprintSearchField::GraphText:
+        for (int32 GraphTextId : Entry.GraphTextIds)
+        {
+            if (GraphTexts[GraphTextId].Text.Contains(Needle, ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    return false;
+}
+
+void FBlueprintCatalog::OnAssetAdded(const FAssetData& AssetData)
+{
+    // Assets discovered before the first build are picked up by the build itself
+    if (!bBuilt || !AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        return;
+    }
+
+    AddOrUpdateAsset(AssetData);
+}
+
+void FBlueprintCatalog::OnAssetRemoved(const FAssetData& AssetData)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    const int32* EntryId = PathToEntryId.Find(AssetData.GetObjectPathString());
+    if (EntryId)
+    {
+        RemoveEntry(*EntryId);
+    }
+}
+
+void FBlueprintCatalog::OnAssetUpdated(const FAssetData& AssetData)
+{
+    // The registry rescans saved packages, which brings new dependencies and package sizes
+    if (!bBuilt || !PathToEntryId.Contains(AssetData.GetObjectPathString()))
+    {
+        return;
+    }
+
+    AddOrUpdateAsset(AssetData);
+}
+
+void FBlueprintCatalog::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    const int32* EntryId = PathToEntryId.Find(OldObjectPath);
+    if (EntryId)
+    {
+        RemoveEntry(*EntryId);
+    }
+
+    if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        AddOrUpdateAsset(AssetData);
+    }
+}
+
+void FBlueprintCatalog::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+#if WITH_EDITOR
+    if (!bBuilt || !Package)
+    {
+        return;
+    }
+
+    // Find the blueprints in the saved package and refresh them while they are loaded
+    ForEachObjectWithPackage(Package, [](UObject* Object)
+    {
+        UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+        if (Blueprint)
+        {
+            const int32 EntryId = AddOrUpdateAsset(FAssetData(Blueprint));
+            RefreshMemberData(EntryId, Blueprint);
+        }
+        return true;
+    }, false);
+#endif
+}
+
+int32 FBlueprintCatalog::AddOrUpdateAsset(const FAssetData& AssetData)
+{
+    FBlueprintData BasicData = FBlueprintDataExtractor::ExtractBasicData(AssetData);
+
+    int32 EntryId = INDEX_NONE;
+    if (const int32* ExistingId = PathToEntryId.Find(BasicData.Path))
+    {
+        // Update in place, keeping member data until the next refresh replaces it
+        EntryId = *ExistingId;
+        UnindexEntry(EntryId);
+
+        FBlueprintCatalogEntry& Entry = Entries[EntryId];
+        Entry.Data.Name = BasicData.Name;
+        Entry.Data.ParentClass = BasicData.ParentClass;
+    }
+    else
+    {
+        // Reuse a free slot if one is available
+        if (FreeEntryIds.Num() > 0)
+        {
+            EntryId = FreeEntryIds.Pop(EAllowShrinking::No);
+        }
+        else
+        {
+            EntryId = Entries.AddDefaulted();
+        }
+
+        FBlueprintCatalogEntry& Entry = Entries[EntryId];
+        Entry = FBlueprintCatalogEntry();
+        Entry.Data = MoveTemp(BasicData);
+        Entry.bIsValid = true;
+
+        PathToEntryId.Add(Entry.Data.Path, EntryId);
+        PackageToEntryId.Add(BlueprintCatalog::GetPackageName(Entry), EntryId);
+    }
+
+    // Keep the registry tags so tag queries never need to load the asset
+    FBlueprintCatalogEntry& Entry = Entries[EntryId];
+    Entry.AssetTags.Reset();
+    for (const auto& TagAndValue : AssetData.TagsAndValues)
+    {
+        Entry.AssetTags.Add(TagAndValue.Key, TagAndValue.Value.AsString());
+    }
+
+#if WITH_EDITOR
+    // Dependencies and package size for the leaderboards, also straight from the registry
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    TArray<FName> Dependencies;
+    AssetRegistry.GetDependencies(AssetData.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+    Entry.Dependencies.Reset();
+    for (const FName& Dependency : Dependencies)
+    {
+        if (Dependency != AssetData.PackageName && !FPackageName::IsScriptPackage(Dependency.ToString()))
+        {
+            Entry.Dependencies.AddUnique(Dependency);
+        }
+    }
+
+    TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(AssetData.PackageName);
+    Entry.PackageSize = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+#endif
+
+    IndexEntry(EntryId);
+    ++Generation;
+    Entry.Revision = Generation;
+
+    return EntryId;
+}
+
+void FBlueprintCatalog::RemoveEntry(int32 EntryId)
+{
+    if (!GetEntry(EntryId))
+    {
+        return;
+    }
+
+    UnindexEntry(EntryId);
+    ClearGraphTexts(EntryId);
+
+    PathToEntryId.Remove(Entries[EntryId].Data.Path);
+    PackageToEntryId.Remove(BlueprintCatalog::GetPackageName(Entries[EntryId]));
+    Entries[EntryId] = FBlueprintCatalogEntry();
+    FreeEntryIds.Add(EntryId);
+
+    ++Generation;
+}
+
+void FBlueprintCatalog::RefreshMemberData(int32 EntryId, UBlueprint* Blueprint)
+{
+#if WITH_EDITOR
+    if (!GetEntry(EntryId) || !Blueprint)
+    {
+        return;
+    }
+
+    UnindexEntry(EntryId);
+    ClearGraphTexts(EntryId);
+
+    // Medium detail matches what the searchers used to load for function and variable queries
+    FBlueprintCatalogEntry& Entry = Entries[EntryId];
+    FBlueprintData MemberData = FBlueprintDataExtractor::ExtractBlueprintData(Blueprint, EBlueprintDetailLevel::Medium);
+    Entry.Data.Functions = MoveTemp(MemberData.Functions);
+    Entry.Data.Variables = MoveTemp(MemberData.Variables);
+    Entry.Data.Description = MoveTemp(MemberData.Description);
+    Entry.bHasMemberData = true;
+
+    // Graph texts and structure aren't part of Medium data, so collect them here while the blueprint is loaded
+    CollectGraphTexts(EntryId, Blueprint);
+    CollectGraphSummaries(EntryId, Blueprint);
+
+    // Member data is derived from the asset as it already is, so results computed without it stay valid
+    // and the generation only moves when an asset is added, removed, updated, renamed or saved
+    IndexEntry(EntryId);
+#endif
+}
+
+void FBlueprintCatalog::CollectGraphTexts(int32 EntryId, UBlueprint* Blueprint)
+{
+#if WITH_EDITOR
+    TArray<FBlueprintGraphText> NewTexts;
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        const FString GraphName = Graph->GetName();
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            FBlueprintGraphText NodeText;
+            NodeText.EntryId = EntryId;
+            NodeText.GraphName = GraphName;
+            NodeText.NodeId = FString::Printf(TEXT("%lld"), (int64)Node);
+            NodeText.NodeTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+
+            // A comment box's title is its comment, so only index it once
+            if (Node->IsA<UEdGraphNode_Comment>())
+            {
+                FBlueprintGraphText& CommentText = NewTexts.Add_GetRef(NodeText);
+                CommentText.Field = EBlueprintGraphTextField::CommentBox;
+                CommentText.Text = Node->NodeComment;
+                continue;
+            }
+
+            FBlueprintGraphText& TitleText = NewTexts.Add_GetRef(NodeText);
+            TitleText.Field = EBlueprintGraphTextField::NodeTitle;
+            TitleText.Text = NodeText.NodeTitle;
+
+            if (Node->NodeComment.Len() > 0)
+            {
+                FBlueprintGraphText& CommentText = NewTexts.Add_GetRef(NodeText);
+                CommentText.Field = EBlueprintGraphTextField::NodeComment;
+                CommentText.Text = Node->NodeComment;
+            }
+
+            // Literals typed into unconnected input pins
+            for (UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin && Pin->Direction == EEdGraphPinDirection::EGPD_Input && Pin->LinkedTo.Num() == 0 && Pin->DefaultValue.Len() > 0)
+                {
+                    FBlueprintGraphText& PinText = NewTexts.Add_GetRef(NodeText);
+                    PinText.Field = EBlueprintGraphTextField::PinDefaultValue;
+                    PinText.PinName = Pin->PinName.ToString();
+                    PinText.Text = Pin->DefaultValue;
+                }
+            }
+        }
+    }
+
+    // Store the texts, reusing free slots, and index them
+    FBlueprintCatalogEntry& Entry = Entries[EntryId];
+    Entry.GraphTextIds.Reset(NewTexts.Num());
+
+    for (FBlueprintGraphText& NewText : NewTexts)
+    {
+        int32 GraphTextId = INDEX_NONE;
+        if (FreeGraphTextIds.Num() > 0)
+        {
+            GraphTextId = FreeGraphTextIds.Pop(EAllowShrinking::No);
+            GraphTexts[GraphTextId] = MoveTemp(NewText);
+        }
+        else
+        {
+            GraphTextId = GraphTexts.Add(MoveTemp(NewText));
+        }
+
+        GraphTextIndex.AddDocument(GraphTextId, EBlueprintSearchField::GraphText, MakeArrayView(&GraphTexts[GraphTextId].Text, 1));
+        Entry.GraphTextIds.Add(GraphTextId);
+    }
+#endif
+}
+
+void FBlueprintCatalog::ClearGraphTexts(int32 EntryId)
+{
+    FBlueprintCatalogEntry& Entry = Entries[EntryId];
+
+    for (int32 GraphTextId : Entry.GraphTextIds)
+    {
+        GraphTextIndex.RemoveDocument(GraphTextId, EBlueprintSearchField::GraphText, MakeArrayView(&GraphTexts[GraphTextId].Text, 1));
+        GraphTexts[GraphTextId] = FBlueprintGraphText();
+        FreeGraphTextIds.Add(GraphTextId);
+    }
+
+    Entry.GraphTextIds.Reset();
+}
+
+void FBlueprintCatalog::CollectGraphSummaries(int32 EntryId, UBlueprint* Blueprint)
+{
+#if WITH_EDITOR
+    FBlueprintCatalogEntry& Entry = Entries[EntryId];
+    Entry.GraphSummaries.Reset();
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        FBlueprintGraphSummary& Summary = Entry.GraphSummaries.AddDefaulted_GetRef();
+        Summary.GraphName = Graph->GetName();
+
+        // Number the nodes first so edges can refer to them by index
+        TMap<const UEdGraphNode*, int32> NodeIndices;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || Node->IsA<UEdGraphNode_Comment>())
+            {
+                continue;
+            }
+
+            NodeIndices.Add(Node, Summary.Nodes.Num());
+
+            FBlueprintGraphSummaryNode& SummaryNode = Summary.Nodes.AddDefaulted_GetRef();
+            SummaryNode.NodeId = FString::Printf(TEXT("%lld"), (int64)Node);
+            SummaryNode.NodeClass = Node->GetClass()->GetName();
+            SummaryNode.Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+
+            if (const UK2Node_ComponentBoundEvent* BoundEventNode = Cast<UK2Node_ComponentBoundEvent>(Node))
+            {
+                // Bound events reference the delegate signature, the delegate name is what people look for
+                SummaryNode.EventName = BoundEventNode->DelegatePropertyName.ToString();
+            }
+            else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+            {
+                // Overridden events have a member reference, custom events only their own name
+                const FName MemberName = EventNode->EventReference.GetMemberName();
+                SummaryNode.EventName = (MemberName != NAME_None ? MemberName : EventNode->CustomFunctionName).ToString();
+            }
+        }
+
+        // Edges always run from an output pin to the input pins it is linked to
+        for (const TPair<const UEdGraphNode*, int32>& NodeIndex : NodeIndices)
+        {
+            FBlueprintGraphSummaryNode& SummaryNode = Summary.Nodes[NodeIndex.Value];
+
+            for (const UEdGraphPin* Pin : NodeIndex.Key->Pins)
+            {
+                if (!Pin || Pin->Direction != EGPD_Output)
+                {
+                    continue;
+                }
+
+                TArray<int32>& Successors = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec ? SummaryNode.ExecSuccessors : SummaryNode.DataSuccessors;
+                for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                {
+                    const int32* TargetIndex = LinkedPin ? NodeIndices.Find(LinkedPin->GetOwningNode()) : nullptr;
+                    if (TargetIndex)
+                    {
+                        Successors.AddUnique(*TargetIndex);
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+void FBlueprintCatalog::IndexEntry(int32 EntryId)
+{
+    const FBlueprintCatalogEntry& Entry = Entries[EntryId];
+
+    TArray<FString> Texts;
+    for (EBlueprintSearchField Field : { EBlueprintSearchField::Name, EBlueprintSearchField::Path, EBlueprintSearchField::ParentClass,
+                                         EBlueprintSearchField::Function, EBlueprintSearchField::Variable, EBlueprintSearchField::VariableType })
+    {
+        GetFieldTexts(Entry, Field, Texts);
+        TrigramIndex.AddDocument(EntryId, Field, Texts);
+        NameArena.AddDocument(EntryId, Field, Texts);
+    }
+
+    SignatureIndex.AddDocument(EntryId, Entry.Data.Functions);
+
+    // Node class and event postings, kept sorted so several classes can be intersected
+    TMap<FString, TArray<int32>> NodeClassGraphs;
+    TMap<FString, TArray<int32>> EventGraphs;
+    BlueprintCatalog::CollectGraphKeys(Entry, NodeClassGraphs, EventGraphs);
+    BlueprintCatalog::AddGraphPostings(NodeClassPostings, EntryId, NodeClassGraphs);
+    BlueprintCatalog::AddGraphPostings(EventPostings, EntryId, EventGraphs);
+
+    BlueprintCatalog::ForEachCompletionTerm(Entry, [](EBlueprintCompletionKind Kind, const FString& Text, int32 Score)
+    {
+        CompletionTrie.Add(Kind, Text, Score);
+    });
+
+    PathTree.AddEntry(EntryId, FBlueprintPathTree::GetPackagePath(Entry.Data.Path), BlueprintCatalog::GetNodeCount(Entry), Entry.bHasMemberData);
+
+    // Leaderboards; the entry's own reference count was accumulated by the blueprints indexed so far
+    const int32 ReferenceCount = IncomingReferenceCounts.FindRef(BlueprintCatalog::GetPackageName(Entry));
+    for (int32 MetricIndex = 0; MetricIndex < static_cast<int32>(EBlueprintLeaderboardMetric::Count); ++MetricIndex)
+    {
+        const EBlueprintLeaderboardMetric Metric = static_cast<EBlueprintLeaderboardMetric>(MetricIndex);
+        Leaderboards[MetricIndex].Add(EntryId, BlueprintCatalog::GetLeaderboardValue(Entry, Metric, ReferenceCount));
+    }
+
+    for (const FName& Dependency : Entry.Dependencies)
+    {
+        AdjustReferenceCount(Dependency, 1);
+    }
+
+    // Ranked index: names weigh most, then member identifiers, then free text
+    TArray<FString> MemberTexts;
+    GetFieldTexts(Entry, EBlueprintSearchField::Function, MemberTexts);
+    GetFieldTexts(Entry, EBlueprintSearchField::Variable, Texts);
+    MemberTexts.Append(Texts);
+
+    TArray<FString> FreeTexts;
+    for (int32 GraphTextId : Entry.GraphTextIds)
+    {
+        const FBlueprintGraphText& GraphText = GraphTexts[GraphTextId];
+        if (GraphText.Field == EBlueprintGraphTextField::NodeComment || GraphText.Field == EBlueprintGraphTextField::CommentBox)
+        {
+            FreeTexts.Add(GraphText.Text);
+        }
+    }
+    if (!Entry.Data.Description.IsEmpty())
+    {
+        FreeTexts.Add(Entry.Data.Description);
+    }
+
+    RankedIndex.AddDocument(EntryId, EBlueprintRankedField::Name, MakeArrayView(&Entry.Data.Name, 1));
+    RankedIndex.AddDocument(EntryId, EBlueprintRankedField::Member, MemberTexts);
+    RankedIndex.AddDocument(EntryId, EBlueprintRankedField::Text, FreeTexts);
+}
+
+void FBlueprintCatalog::UnindexEntry(int32 EntryId)
+{
+    const FBlueprintCatalogEntry& Entry = Entries[EntryId];
+
+    TArray<FString> Texts;
+    for (EBlueprintSearchField Field : { EBlueprintSearchField::Name, EBlueprintSearchField::Path, EBlueprintSearchField::ParentClass,
+                                         EBlueprintSearchField::Function, EBlueprintSearchField::Variable, EBlueprintSearchField::VariableType })
+    {
+        GetFieldTexts(Entry, Field, Texts);
+        TrigramIndex.RemoveDocument(EntryId, Field, Texts);
+        NameArena.RemoveDocument(EntryId, Field);
+    }
+
+    SignatureIndex.RemoveDocument(EntryId);
+
+    TMap<FString, TArray<int32>> NodeClassGraphs;
+    TMap<FString, TArray<int32>> EventGraphs;
+    BlueprintCatalog::CollectGraphKeys(Entry, NodeClassGraphs, EventGraphs);
+    BlueprintCatalog::RemoveGraphPostings(NodeClassPostings, EntryId, NodeClassGraphs);
+    BlueprintCatalog::RemoveGraphPostings(EventPostings, EntryId, EventGraphs);
+
+    BlueprintCatalog::ForEachCompletionTerm(Entry, [](EBlueprintCompletionKind Kind, const FString& Text, int32 Score)
+    {
+        CompletionTrie.Remove(Kind, Text, Score);
+    });
+
+    PathTree.RemoveEntry(EntryId, FBlueprintPathTree::GetPackagePath(Entry.Data.Path), BlueprintCatalog::GetNodeCount(Entry), Entry.bHasMemberData);
+
+    const int32 ReferenceCount = IncomingReferenceCounts.FindRef(BlueprintCatalog::GetPackageName(Entry));
+    for (int32 MetricIndex = 0; MetricIndex < static_cast<int32>(EBlueprintLeaderboardMetric::Count); ++MetricIndex)
+    {
+        const EBlueprintLeaderboardMetric Metric = static_cast<EBlueprintLeaderboardMetric>(MetricIndex);
+        Leaderboards[MetricIndex].Remove(EntryId, BlueprintCatalog::GetLeaderboardValue(Entry, Metric, ReferenceCount));
+    }
+
+    for (const FName& Dependency : Entry.Dependencies)
+    {
+        AdjustReferenceCount(Dependency, -1);
+    }
+
+    RankedIndex.RemoveDocument(EntryId);
+}
+
+void FBlueprintCatalog::AdjustReferenceCount(FName PackageName, int32 Delta)
+{
+    // Counts are kept for packages without an entry too, so a blueprint added later starts with its referencers
+    const int32* EntryId = PackageToEntryId.Find(PackageName);
+    FBlueprintLeaderboard& Leaderboard = Leaderboards[static_cast<int32>(EBlueprintLeaderboardMetric::ReferenceCount)];
+
+    int32& Count = IncomingReferenceCounts.FindOrAdd(PackageName);
+    if (EntryId)
+    {
+        Leaderboard.Remove(*EntryId, Count);
+    }
+
+    Count += Delta;
+    if (EntryId)
+    {
+        Leaderboard.Add(*EntryId, Count);
+    }
+
+    if (Count == 0)
+    {
+        IncomingReferenceCounts.Remove(PackageName);
+    }
+}
+
+void FBlueprintCatalog::GetFieldTexts(const FBlueprintCatalogEntry& Entry, EBlueprintSearchField Field, TArray<FString>& OutTexts)
+{
+    OutTexts.Reset();
+
+    switch (Field)
+    {
+    case EBlueprintSearchField::Name:
+        OutTexts.Add(Entry.Data.Name);
+        break;
+
+    case EBlueprintSearchField::Path:
+        OutTexts.Add(Entry.Data.Path);
+        break;
+
+    case EBlueprintSearchField::ParentClass:
+        OutTexts.Add(Entry.Data.ParentClass);
+        break;
+
+    case EBlueprintSearchField::Function:
+        for (const FBlueprintFunctionData& Function : Entry.Data.Functions)
+        {
+            OutTexts.Add(Function.Name);
+        }
+        break;
+
+    case EBlueprintSearchField::Variable:
+        for (const FBlueprintVariableData& Variable : Entry.Data.Variables)
+        {
+            OutTexts.Add(Variable.Name);
+        }
+        break;
+
+    case EBlueprintSearchField::VariableType:
+        for (const FBlueprintVariableData& Variable : Entry.Data.Variables)
+        {
+            OutTexts.Add(Variable.Type);
+        }
+        break;
+
+    case EBlueprintSearchField::GraphText:
+        for (int32 GraphTextId : Entry.GraphTextIds)
+        {
+            OutTexts.Add(GraphTexts[GraphTextId].Text);
+        }
+        break;
+    }
+}
+
+namespace BlueprintCatalog
+{
+    /**
+     * Time the packed arena scan against the per-entry Contains loops the searcher used to run
+     * Usage: BlueprintAnalyzer.BenchmarkSubstring <Needle> [Iterations]
+     */
+    void BenchmarkSubstring(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Usage: BlueprintAnalyzer.BenchmarkSubstring <Needle> [Iterations]"));
+            return;
+        }
+
+        const FString& Needle = Args[0];
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 100;
+
+        TArray<int32> AllEntryIds;
+        FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+
+        UE_LOG(LogTemp, Log, TEXT("Substring benchmark for '%s' over %d blueprints (%d with member data), %d iterations"),
+            *Needle, AllEntryIds.Num(), FBlueprintCatalog::GetNumEntriesWithMemberData(), Iterations);
+
+        static const TCHAR* FieldNames[] = { TEXT("Name"), TEXT("Path"), TEXT("ParentClass"), TEXT("Function"), TEXT("Variable"), TEXT("VariableType") };
+
+        for (EBlueprintSearchField Field : { EBlueprintSearchField::Name, EBlueprintSearchField::Path, EBlueprintSearchField::ParentClass,
+                                             EBlueprintSearchField::Function, EBlueprintSearchField::Variable, EBlueprintSearchField::VariableType })
+        {
+            TArray<int32> LoopIds;
+            const double LoopStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                LoopIds.Reset();
+                for (int32 EntryId : AllEntryIds)
+                {
+                    const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+                    if (Entry && FBlueprintCatalog::FieldContains(*Entry, Field, Needle))
+                    {
+                        LoopIds.Add(EntryId);
+                    }
+                }
+            }
+            const double LoopSeconds = (FPlatformTime::Seconds() - LoopStart) / Iterations;
+
+            TArray<int32> ArenaIds;
+            const double ArenaStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                FBlueprintCatalog::ScanSubstring(Field, Needle, ArenaIds);
+            }
+            const double ArenaSeconds = (FPlatformTime::Seconds() - ArenaStart) / Iterations;
+
+            UE_LOG(LogTemp, Log, TEXT("  %-12s loop %8.3f ms (%d hits)  arena %8.3f ms (%d hits)  %.1fx%s"),
+                FieldNames[static_cast<int32>(Field)], LoopSeconds * 1000.0, LoopIds.Num(), ArenaSeconds * 1000.0, ArenaIds.Num(),
+                ArenaSeconds > 0.0 ? LoopSeconds / ArenaSeconds : 0.0,
+                LoopIds == ArenaIds ? TEXT("") : TEXT("  MISMATCH"));
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkSubstringCommand(
+        TEXT("BlueprintAnalyzer.BenchmarkSubstring"),
+        TEXT("Compare the packed name arena scan with per-string Contains loops. Usage: BlueprintAnalyzer.BenchmarkSubstring <Needle> [Iterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSubstring));
+}
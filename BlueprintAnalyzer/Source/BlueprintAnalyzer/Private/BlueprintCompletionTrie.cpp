@@ -0,0 +1,255 @@
+#include "BlueprintAnalyzer/Public/BlueprintCompletionTrie.h"
+#include "Algo/BinarySearch.h"
+
+namespace BlueprintCompletionTrie
+{
+    /**
+     * Data structure representing an entry of the best-first expansion queue: either a node,
+     * ranked by the best score below it, or a term, ranked by its own score
+     */
+    struct FCandidate
+    {
+        int32 Score;
+        int32 Index;
+        bool bIsTerm;
+    };
+
+    /** Max-heap order; on equal scores terms come out before nodes so they are emitted first */
+    struct FCandidateOrder
+    {
+        bool operator()(const FCandidate& A, const FCandidate& B) const
+        {
+            return A.Score > B.Score || (A.Score == B.Score && A.bIsTerm && !B.bIsTerm);
+        }
+    };
+}
+
+void FBlueprintCompletionTrie::Add(EBlueprintCompletionKind Kind, const FString& Text, int32 Score)
+{
+    if (Text.IsEmpty() || Score <= 0)
+    {
+        return;
+    }
+
+    const int32 NodeIndex = FindNode(Text.ToLower(), true);
+
+    // One term per kind and node; repeated adds only add references
+    int32 TermId = INDEX_NONE;
+    for (int32 ExistingId : Nodes[NodeIndex].TermIds)
+    {
+        if (Terms[ExistingId].Kind == Kind)
+        {
+            TermId = ExistingId;
+            break;
+        }
+    }
+
+    if (TermId == INDEX_NONE)
+    {
+        if (FreeTermIds.Num() > 0)
+        {
+            TermId = FreeTermIds.Pop(EAllowShrinking::No);
+        }
+        else
+        {
+            TermId = Terms.AddDefaulted();
+        }
+
+        FTerm& Term = Terms[TermId];
+        Term = FTerm();
+        Term.Text = Text;
+        Term.Kind = Kind;
+        Term.NodeIndex = NodeIndex;
+        Nodes[NodeIndex].TermIds.Add(TermId);
+    }
+
+    FTerm& Term = Terms[TermId];
+    Term.Score += Score;
+    ++Term.RefCount;
+
+    UpdateMaxScores(NodeIndex);
+}
+
+void FBlueprintCompletionTrie::Remove(EBlueprintCompletionKind Kind, const FString& Text, int32 Score)
+{
+    if (Text.IsEmpty() || Score <= 0)
+    {
+        return;
+    }
+
+    const int32 NodeIndex = FindNode(Text.ToLower(), false);
+    if (NodeIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FNode& Node = Nodes[NodeIndex];
+    for (int32 i = 0; i < Node.TermIds.Num(); ++i)
+    {
+        const int32 TermId = Node.TermIds[i];
+        FTerm& Term = Terms[TermId];
+        if (Term.Kind != Kind)
+        {
+            continue;
+        }
+
+        Term.Score -= Score;
+        if (--Term.RefCount <= 0)
+        {
+            // Nodes stay in place; a node without terms below it has a MaxScore of 0 and is never expanded
+            Node.TermIds.RemoveAtSwap(i, 1, EAllowShrinking::No);
+            Term = FTerm();
+            FreeTermIds.Add(TermId);
+        }
+
+        UpdateMaxScores(NodeIndex);
+        return;
+    }
+}
+
+void FBlueprintCompletionTrie::Complete(const FString& Prefix, int32 MaxResults, TOptional<EBlueprintCompletionKind> Kind, TArray<FBlueprintCompletion>& OutCompletions) const
+{
+    using namespace BlueprintCompletionTrie;
+
+    OutCompletions.Reset();
+
+    const int32 PrefixNode = FindNode(Prefix.ToLower());
+    if (PrefixNode == INDEX_NONE || MaxResults <= 0 || Nodes[PrefixNode].MaxScore <= 0)
+    {
+        return;
+    }
+
+    // Best-first: a node is only expanded once its bound beats every term still queued
+    TArray<FCandidate> Queue;
+    Queue.HeapPush(FCandidate{ Nodes[PrefixNode].MaxScore, PrefixNode, false }, FCandidateOrder());
+
+    while (Queue.Num() > 0 && OutCompletions.Num() < MaxResults)
+    {
+        FCandidate Candidate;
+        Queue.HeapPop(Candidate, FCandidateOrder(), EAllowShrinking::No);
+
+        if (Candidate.bIsTerm)
+        {
+            const FTerm& Term = Terms[Candidate.Index];
+
+            FBlueprintCompletion& Completion = OutCompletions.AddDefaulted_GetRef();
+            Completion.Text = Term.Text;
+            Completion.Kind = Term.Kind;
+            Completion.Score = Term.Score;
+            continue;
+        }
+
+        const FNode& Node = Nodes[Candidate.Index];
+        for (int32 TermId : Node.TermIds)
+        {
+            if (!Kind.IsSet() || Terms[TermId].Kind == Kind.GetValue())
+            {
+                Queue.HeapPush(FCandidate{ Terms[TermId].Score, TermId, true }, FCandidateOrder());
+            }
+        }
+
+        for (const TPair<TCHAR, int32>& Child : Node.Children)
+        {
+            const int32 ChildScore = Nodes[Child.Value].MaxScore;
+            if (ChildScore > 0)
+            {
+                Queue.HeapPush(FCandidate{ ChildScore, Child.Value, false }, FCandidateOrder());
+            }
+        }
+    }
+}
+
+void FBlueprintCompletionTrie::Reset()
+{
+    Nodes.Empty();
+    Terms.Empty();
+    FreeTermIds.Empty();
+}
+
+int32 FBlueprintCompletionTrie::FindNode(const FString& Key, bool bCreate)
+{
+    if (Nodes.Num() == 0)
+    {
+        if (!bCreate)
+        {
+            return INDEX_NONE;
+        }
+        Nodes.AddDefaulted();
+    }
+
+    int32 NodeIndex = 0;
+    for (TCHAR Char : Key)
+    {
+        TArray<TPair<TCHAR, int32>, TInlineAllocator<2>>& Children = Nodes[NodeIndex].Children;
+        const int32 ChildPosition = Algo::LowerBoundBy(Children, Char, &TPair<TCHAR, int32>::Key);
+
+        if (ChildPosition < Children.Num() && Children[ChildPosition].Key == Char)
+        {
+            NodeIndex = Children[ChildPosition].Value;
+            continue;
+        }
+
+        if (!bCreate)
+        {
+            return INDEX_NONE;
+        }
+
+        // Add the node first; growing Nodes would invalidate the Children reference
+        const int32 NewIndex = Nodes.AddDefaulted();
+        Nodes[NewIndex].Parent = NodeIndex;
+        Nodes[NodeIndex].Children.Insert(TPair<TCHAR, int32>(Char, NewIndex), ChildPosition);
+        NodeIndex = NewIndex;
+    }
+
+    return NodeIndex;
+}
+
+int32 FBlueprintCompletionTrie::FindNode(const FString& Key) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 NodeIndex = 0;
+    for (TCHAR Char : Key)
+    {
+        const TArray<TPair<TCHAR, int32>, TInlineAllocator<2>>& Children = Nodes[NodeIndex].Children;
+        const int32 ChildPosition = Algo::LowerBoundBy(Children, Char, &TPair<TCHAR, int32>::Key);
+
+        if (ChildPosition >= Children.Num() || Children[ChildPosition].Key != Char)
+        {
+            return INDEX_NONE;
+        }
+        NodeIndex = Children[ChildPosition].Value;
+    }
+
+    return NodeIndex;
+}
+
+void FBlueprintCompletionTrie::UpdateMaxScores(int32 NodeIndex)
+{
+    // Walk up until a node's bound doesn't change; the path is as long as the term at most
+    while (NodeIndex != INDEX_NONE)
+    {
+        FNode& Node = Nodes[NodeIndex];
+
+        int32 MaxScore = 0;
+        for (int32 TermId : Node.TermIds)
+        {
+            MaxScore = FMath::Max(MaxScore, Terms[TermId].Score);
+        }
+        for (const TPair<TCHAR, int32>& Child : Node.Children)
+        {
+            MaxScore = FMath::Max(MaxScore, Nodes[Child.Value].MaxScore);
+        }
+
+        if (MaxScore == Node.MaxScore)
+        {
+            return;
+        }
+
+        Node.MaxScore = MaxScore;
+        NodeIndex = Node.Parent;
+    }
+}
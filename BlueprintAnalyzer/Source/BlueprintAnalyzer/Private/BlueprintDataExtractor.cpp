@@ -6,6 +6,7 @@
 #include "EdGraph/EdGraphPin.h"
 #include "EdGraphSchema_K2.h"
 #include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
 #include "K2Node_Event.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
@@ -35,7 +36,7 @@ TArray<FBlueprintData> FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetai
     
     // Query for all blueprint assets
     FARFilter Filter;
-    Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
     Filter.bRecursiveClasses = true;
     
     TArray<FAssetData> AssetData;
@@ -47,43 +48,11 @@ TArray<FBlueprintData> FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetai
         // For basic detail level, we can extract minimal data from asset data without loading the asset
         if (DetailLevel == EBlueprintDetailLevel::Basic)
         {
-            FBlueprintData BlueprintData;
-            BlueprintData.Name = Asset.AssetName.ToString();
-            BlueprintData.Path = Asset.ObjectPath.ToString();
-            
-            // Explicitly ensure functions and variables are empty for Basic detail level
-            BlueprintData.Functions.Empty();
-            BlueprintData.Variables.Empty();
-            BlueprintData.Description.Empty();
+            FBlueprintData BlueprintData = ExtractBasicData(Asset);
             
             // Log that we're using basic detail level
             UE_LOG(LogTemp, Log, TEXT("GetAllBlueprints: Using basic detail level for blueprint %s"), *BlueprintData.Name);
             
-            // We can try to get parent class from asset data tags
-            FString ParentClassName;
-            if (Asset.GetTagValue(FName("ParentClass"), ParentClassName))
-            {
-                // Clean up the parent class string (remove prefix like "Class'/Script/Engine.")
-                FString CleanParentClass = ParentClassName;
-                CleanParentClass.RemoveFromStart(TEXT("Class'/Script/"));
-                int32 QuoteIndex;
-                if (CleanParentClass.FindChar('\'', QuoteIndex))
-                {
-                    CleanParentClass = CleanParentClass.Left(QuoteIndex);
-                }
-                
-                // Remove the module prefix if any
-                int32 DotIndex;
-                if (CleanParentClass.FindChar('.', DotIndex))
-                {
-                    BlueprintData.ParentClass = CleanParentClass.Mid(DotIndex + 1);
-                }
-                else
-                {
-                    BlueprintData.ParentClass = CleanParentClass;
-                }
-            }
-            
             Results.Add(BlueprintData);
         }
         else
@@ -115,43 +84,12 @@ TOptional<FBlueprintData> FBlueprintDataExtractor::GetBlueprintByPath(const FStr
     {
         // Try to find asset data without loading the asset
         FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-        FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FName(*Path));
+        FAssetData AssetData = AssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(Path));
         
         if (AssetData.IsValid())
         {
             // Create basic blueprint data from asset data
-            FBlueprintData BlueprintData;
-            BlueprintData.Name = AssetData.AssetName.ToString();
-            BlueprintData.Path = AssetData.ObjectPath.ToString();
-            
-            // Explicitly ensure these arrays are empty for basic detail level
-            BlueprintData.Functions.Empty();
-            BlueprintData.Variables.Empty();
-            BlueprintData.Description.Empty();
-            
-            // Try to get parent class from asset data tags
-            FString ParentClassName;
-            if (AssetData.GetTagValue(FName("ParentClass"), ParentClassName))
-            {
-                // Clean up the parent class string
-                FString CleanParentClass = ParentClassName;
-                CleanParentClass.RemoveFromStart(TEXT("Class'/Script/"));
-                int32 QuoteIndex;
-                if (CleanParentClass.FindChar('\'', QuoteIndex))
-                {
-                    CleanParentClass = CleanParentClass.Left(QuoteIndex);
-                }
-                
-                int32 DotIndex;
-                if (CleanParentClass.FindChar('.', DotIndex))
-                {
-                    BlueprintData.ParentClass = CleanParentClass.Mid(DotIndex + 1);
-                }
-                else
-                {
-                    BlueprintData.ParentClass = CleanParentClass;
-                }
-            }
+            FBlueprintData BlueprintData = ExtractBasicData(AssetData);
             
             return BlueprintData;
         }
@@ -170,6 +108,40 @@ TOptional<FBlueprintData> FBlueprintDataExtractor::GetBlueprintByPath(const FStr
     return TOptional<FBlueprintData>();
 }
 
+FBlueprintData FBlueprintDataExtractor::ExtractBasicData(const FAssetData& AssetData)
+{
+    FBlueprintData BlueprintData;
+    BlueprintData.Name = AssetData.AssetName.ToString();
+    BlueprintData.Path = AssetData.GetObjectPathString();
+    
+    // Try to get parent class from asset data tags
+    FString ParentClassName;
+    if (AssetData.GetTagValue(FName("ParentClass"), ParentClassName))
+    {
+        // Clean up the parent class string (remove prefix like "Class'/Script/Engine.")
+        FString CleanParentClass = ParentClassName;
+        CleanParentClass.RemoveFromStart(TEXT("Class'/Script/"));
+        int32 QuoteIndex;
+        if (CleanParentClass.FindChar('\'', QuoteIndex))
+        {
+            CleanParentClass = CleanParentClass.Left(QuoteIndex);
+        }
+        
+        // Remove the module prefix if any
+        int32 DotIndex;
+        if (CleanParentClass.FindChar('.', DotIndex))
+        {
+            BlueprintData.ParentClass = CleanParentClass.Mid(DotIndex + 1);
+        }
+        else
+        {
+            BlueprintData.ParentClass = CleanParentClass;
+        }
+    }
+    
+    return BlueprintData;
+}
+
 FBlueprintData FBlueprintDataExtractor::ExtractBlueprintData(UBlueprint* Blueprint,
                                                             EBlueprintDetailLevel DetailLevel,
                                                             const FString& GraphName,
@@ -308,6 +280,60 @@ FBlueprintData FBlueprintDataExtractor::ExtractBlueprintData(UBlueprint* Bluepri
     return Data;
 }
 
+FString FBlueprintDataExtractor::GetFullPinType(const FEdGraphPinType& PinType)
+{
+#if WITH_EDITOR
+    // Name a terminal type after what it references, falling back to its category
+    auto GetTerminalName = [](const FName& Category, const UObject* SubCategoryObject) -> FString
+    {
+        // Blueprints show single and double precision alike as float
+        if (Category == UEdGraphSchema_K2::PC_Real)
+        {
+            return TEXT("float");
+        }
+        
+        if (!SubCategoryObject)
+        {
+            return Category.ToString();
+        }
+        
+        const FString ObjectName = SubCategoryObject->GetName();
+        if (Category == UEdGraphSchema_K2::PC_Class)
+        {
+            return FString::Printf(TEXT("Class<%s>"), *ObjectName);
+        }
+        if (Category == UEdGraphSchema_K2::PC_SoftClass)
+        {
+            return FString::Printf(TEXT("SoftClass<%s>"), *ObjectName);
+        }
+        if (Category == UEdGraphSchema_K2::PC_SoftObject)
+        {
+            return FString::Printf(TEXT("SoftObject<%s>"), *ObjectName);
+        }
+        return ObjectName;
+    };
+    
+    const FString ElementType = GetTerminalName(PinType.PinCategory, PinType.PinSubCategoryObject.Get());
+    
+    if (PinType.IsArray())
+    {
+        return FString::Printf(TEXT("Array<%s>"), *ElementType);
+    }
+    if (PinType.IsSet())
+    {
+        return FString::Printf(TEXT("Set<%s>"), *ElementType);
+    }
+    if (PinType.IsMap())
+    {
+        const FString ValueType = GetTerminalName(PinType.PinValueType.TerminalCategory, PinType.PinValueType.TerminalSubCategoryObject.Get());
+        return FString::Printf(TEXT("Map<%s,%s>"), *ElementType, *ValueType);
+    }
+    return ElementType;
+#else
+    return FString();
+#endif
+}
+
 TArray<FBlueprintFunctionData> FBlueprintDataExtractor::ExtractFunctions(UBlueprint* Blueprint)
 {
     TArray<FBlueprintFunctionData> Functions;
@@ -340,22 +366,54 @@ TArray<FBlueprintFunctionData> FBlueprintDataExtractor::ExtractFunctions(UBluepr
             // Get input parameters
             for (UEdGraphPin* Pin : EntryNode->Pins)
             {
-                if (Pin->Direction == EGPD_Output && Pin->PinName != TEXT("then"))
+                if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
                 {
                     FBlueprintParamData ParamData;
                     ParamData.Name = Pin->PinName.ToString();
                     ParamData.Type = Pin->PinType.PinCategory.ToString();
+                    ParamData.FullType = GetFullPinType(Pin->PinType);
                     ParamData.IsOutput = false;
                     
                     FunctionData.Params.Add(ParamData);
                 }
             }
             
-            // Try to determine return type if any
-            UEdGraphPin* ReturnPin = EntryNode->FindPin(TEXT("ReturnValue"), EGPD_Input);
-            if (ReturnPin)
+            const int32 FunctionFlags = EntryNode->GetFunctionFlags();
+            FunctionData.IsCallable = (FunctionFlags & FUNC_BlueprintCallable) != 0;
+            FunctionData.IsPure = (FunctionFlags & FUNC_BlueprintPure) != 0;
+        }
+        
+        // Outputs live on the result node; there can be several, or none at all
+        UK2Node_FunctionResult* ResultNode = nullptr;
+        for (UEdGraphNode* Node : FunctionGraph->Nodes)
+        {
+            ResultNode = Cast<UK2Node_FunctionResult>(Node);
+            if (ResultNode)
+            {
+                break;
+            }
+        }
+        
+        if (ResultNode)
+        {
+            for (UEdGraphPin* Pin : ResultNode->Pins)
             {
-                FunctionData.ReturnType = ReturnPin->PinType.PinCategory.ToString();
+                if (Pin->Direction == EGPD_Input && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+                {
+                    FBlueprintParamData ParamData;
+                    ParamData.Name = Pin->PinName.ToString();
+                    ParamData.Type = Pin->PinType.PinCategory.ToString();
+                    ParamData.FullType = GetFullPinType(Pin->PinType);
+                    ParamData.IsOutput = true;
+                    
+                    // The conventional return value, or the only output, is the function's return type
+                    if (Pin->PinName == UEdGraphSchema_K2::PN_ReturnValue || FunctionData.ReturnType.IsEmpty())
+                    {
+                        FunctionData.ReturnType = ParamData.Type;
+                    }
+                    
+                    FunctionData.Params.Add(ParamData);
+                }
             }
         }
         
@@ -378,11 +436,13 @@ TArray<FBlueprintFunctionData> FBlueprintDataExtractor::ExtractFunctions(UBluepr
                 // Add event parameters if any
                 for (UEdGraphPin* Pin : EventNode->Pins)
                 {
-                    if (Pin->Direction == EGPD_Output && Pin->PinName != TEXT("then"))
+                    if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec &&
+                        Pin->PinName != UK2Node_Event::DelegateOutputName)
                     {
                         FBlueprintParamData ParamData;
                         ParamData.Name = Pin->PinName.ToString();
                         ParamData.Type = Pin->PinType.PinCategory.ToString();
+                        ParamData.FullType = GetFullPinType(Pin->PinType);
                         ParamData.IsOutput = false;
                         
                         EventData.Params.Add(ParamData);
@@ -604,7 +664,7 @@ TArray<FBlueprintReferenceData> FBlueprintDataExtractor::ExtractInheritanceRefer
     // For child classes (incoming references)
     TArray<FAssetData> ChildAssets;
     FARFilter Filter;
-    Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
     AssetRegistry.GetAssets(Filter, ChildAssets);
     
     for (const FAssetData& ChildAsset : ChildAssets)
@@ -0,0 +1,79 @@
+#include "BlueprintAnalyzer/Public/BlueprintFragmentCache.h"
+
+// Initialize static members
+TLruCache<FString, FBlueprintFragmentCache::FFragment> FBlueprintFragmentCache::Fragments(FBlueprintFragmentCache::MaxEntries);
+int64 FBlueprintFragmentCache::NumBytes = 0;
+int64 FBlueprintFragmentCache::Hits = 0;
+int64 FBlueprintFragmentCache::Misses = 0;
+
+TSharedPtr<const TArray<uint8>> FBlueprintFragmentCache::Find(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options, uint64 Revision)
+{
+    const FFragment* Fragment = Fragments.FindAndTouch(MakeKey(Path, DetailLevel, Format, Options));
+    if (Fragment && Fragment->Revision == Revision)
+    {
+        ++Hits;
+        return Fragment->Bytes;
+    }
+
+    // A stale fragment stays until Add replaces it or it ages out
+    ++Misses;
+    return nullptr;
+}
+
+void FBlueprintFragmentCache::Add(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options, uint64 Revision, const TSharedRef<const TArray<uint8>>& Fragment)
+{
+    const int64 FragmentSize = Fragment->Num();
+    if (FragmentSize > MaxBytes)
+    {
+        return;
+    }
+
+    const FString Key = MakeKey(Path, DetailLevel, Format, Options);
+    Remove(Key);
+
+    // Evict by hand rather than letting the LRU cache drop entries, so the byte total stays right
+    while (Fragments.Num() > 0 && (Fragments.Num() >= MaxEntries || NumBytes + FragmentSize > MaxBytes))
+    {
+        const FFragment Evicted = Fragments.RemoveLeastRecent();
+        NumBytes -= Evicted.Bytes->Num();
+    }
+
+    FFragment NewFragment;
+    NewFragment.Revision = Revision;
+    NewFragment.Bytes = Fragment;
+    Fragments.Add(Key, MoveTemp(NewFragment));
+    NumBytes += FragmentSize;
+}
+
+FBlueprintFragmentCacheStats FBlueprintFragmentCache::GetStats()
+{
+    FBlueprintFragmentCacheStats Stats;
+    Stats.Hits = Hits;
+    Stats.Misses = Misses;
+    Stats.NumEntries = Fragments.Num();
+    Stats.NumBytes = NumBytes;
+    Stats.MaxBytes = MaxBytes;
+    return Stats;
+}
+
+void FBlueprintFragmentCache::Reset()
+{
+    Fragments.Empty(MaxEntries);
+    NumBytes = 0;
+    Hits = 0;
+    Misses = 0;
+}
+
+FString FBlueprintFragmentCache::MakeKey(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options)
+{
+    return FString::Printf(TEXT("%d:%d:%d:%s"), static_cast<int32>(DetailLevel), static_cast<int32>(Format), Options.bOmitDefaults ? 1 : 0, *Path);
+}
+
+void FBlueprintFragmentCache::Remove(const FString& Key)
+{
+    if (const FFragment* Existing = Fragments.Find(Key))
+    {
+        NumBytes -= Existing->Bytes->Num();
+        Fragments.Remove(Key);
+    }
+}
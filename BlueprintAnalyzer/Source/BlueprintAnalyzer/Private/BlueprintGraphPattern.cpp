@@ -0,0 +1,252 @@
+#include "BlueprintAnalyzer/Public/BlueprintGraphPattern.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+
+namespace BlueprintGraphPattern
+{
+    /**
+     * Data structure mapping an edge token to its edge kind
+     */
+    struct FEdgeToken
+    {
+        const TCHAR* Text;
+        EBlueprintPatternEdge Edge;
+    };
+
+    /** Edge tokens, longest first so "-exec*->" isn't read as "-exec" */
+    const FEdgeToken EdgeTokens[] = {
+        { TEXT("-exec*->"), EBlueprintPatternEdge::ExecReachable },
+        { TEXT("-exec->"), EBlueprintPatternEdge::Exec },
+        { TEXT("-data->"), EBlueprintPatternEdge::Data },
+        { TEXT("->"), EBlueprintPatternEdge::Exec }
+    };
+
+    /**
+     * Single-pass parser over a pattern expression
+     */
+    class FParser
+    {
+    public:
+        explicit FParser(const FString& InExpression)
+            : Expression(InExpression)
+        {
+        }
+
+        TSharedPtr<FBlueprintGraphPattern> ParsePattern(FString& OutError)
+        {
+            TSharedPtr<FBlueprintGraphPattern> Pattern = MakeShareable(new FBlueprintGraphPattern);
+
+            if (!ParseStep(*Pattern))
+            {
+                OutError = Error;
+                return nullptr;
+            }
+
+            while (SkipWhitespace())
+            {
+                if (!ParseEdge(*Pattern) || !ParseStep(*Pattern))
+                {
+                    OutError = Error;
+                    return nullptr;
+                }
+            }
+
+            return Pattern;
+        }
+
+    private:
+        /** Skip whitespace and report whether anything is left */
+        bool SkipWhitespace()
+        {
+            while (Position < Expression.Len() && FChar::IsWhitespace(Expression[Position]))
+            {
+                ++Position;
+            }
+            return Position < Expression.Len();
+        }
+
+        bool ParseStep(FBlueprintGraphPattern& Pattern)
+        {
+            if (!SkipWhitespace())
+            {
+                Error = FString::Printf(TEXT("Expected a node at position %d"), Position);
+                return false;
+            }
+
+            FBlueprintPatternStep& Step = Pattern.Steps.AddDefaulted_GetRef();
+
+            if (Expression[Position] == TEXT('*'))
+            {
+                ++Position;
+            }
+            else
+            {
+                const int32 Start = Position;
+                while (Position < Expression.Len() && (FChar::IsAlnum(Expression[Position]) || Expression[Position] == TEXT('_')))
+                {
+                    ++Position;
+                }
+
+                if (Position == Start)
+                {
+                    Error = FString::Printf(TEXT("Expected a node class or * at position %d"), Start);
+                    return false;
+                }
+
+                Step.NodeClass = FBlueprintCatalog::NormalizeNodeClass(Expression.Mid(Start, Position - Start));
+            }
+
+            // Optional title filter in brackets
+            if (SkipWhitespace() && Expression[Position] == TEXT('['))
+            {
+                const int32 Close = Expression.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Position);
+                if (Close == INDEX_NONE)
+                {
+                    Error = FString::Printf(TEXT("Missing ']' for the title starting at position %d"), Position);
+                    return false;
+                }
+
+                Step.Title = Expression.Mid(Position + 1, Close - Position - 1).TrimStartAndEnd();
+                Position = Close + 1;
+            }
+
+            return true;
+        }
+
+        bool ParseEdge(FBlueprintGraphPattern& Pattern)
+        {
+            for (const FEdgeToken& Token : EdgeTokens)
+            {
+                const int32 TokenLength = FCString::Strlen(Token.Text);
+                if (Expression.Mid(Position, TokenLength).Equals(Token.Text, ESearchCase::IgnoreCase))
+                {
+                    Pattern.Edges.Add(Token.Edge);
+                    Position += TokenLength;
+                    return true;
+                }
+            }
+
+            Error = FString::Printf(TEXT("Expected -exec->, -exec*->, -data-> or -> at position %d"), Position);
+            return false;
+        }
+
+        const FString& Expression;
+        int32 Position = 0;
+        FString Error;
+    };
+}
+
+TSharedPtr<FBlueprintGraphPattern> FBlueprintPatternMatcher::Parse(const FString& Expression, FString& OutError)
+{
+    BlueprintGraphPattern::FParser Parser(Expression);
+    return Parser.ParsePattern(OutError);
+}
+
+void FBlueprintPatternMatcher::Match(const FBlueprintGraphSummary& Graph, const FBlueprintGraphPattern& Pattern, int32 MaxMatches, TArray<TArray<int32>>& OutMatches)
+{
+    if (Pattern.Steps.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<int32> Current;
+    Current.Reserve(Pattern.Steps.Num());
+
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+    {
+        if (!StepMatches(Pattern.Steps[0], Graph.Nodes[NodeIndex]))
+        {
+            continue;
+        }
+
+        Current.Add(NodeIndex);
+        const bool bContinue = Extend(Graph, Pattern, MaxMatches, Current, OutMatches);
+        Current.Pop(EAllowShrinking::No);
+
+        if (!bContinue)
+        {
+            return;
+        }
+    }
+}
+
+bool FBlueprintPatternMatcher::StepMatches(const FBlueprintPatternStep& Step, const FBlueprintGraphSummaryNode& Node)
+{
+    if (!Step.NodeClass.IsEmpty() && FBlueprintCatalog::NormalizeNodeClass(Node.NodeClass) != Step.NodeClass)
+    {
+        return false;
+    }
+
+    return Step.Title.IsEmpty() || Node.Title.Contains(Step.Title, ESearchCase::IgnoreCase);
+}
+
+bool FBlueprintPatternMatcher::Extend(const FBlueprintGraphSummary& Graph, const FBlueprintGraphPattern& Pattern, int32 MaxMatches,
+                                      TArray<int32>& Current, TArray<TArray<int32>>& OutMatches)
+{
+    const int32 StepIndex = Current.Num();
+    if (StepIndex == Pattern.Steps.Num())
+    {
+        OutMatches.Add(Current);
+        return MaxMatches <= 0 || OutMatches.Num() < MaxMatches;
+    }
+
+    TArray<int32> Successors;
+    GetSuccessors(Graph, Current.Last(), Pattern.Edges[StepIndex - 1], Successors);
+
+    for (int32 Successor : Successors)
+    {
+        // Every node of a match is a different node
+        if (Current.Contains(Successor) || !StepMatches(Pattern.Steps[StepIndex], Graph.Nodes[Successor]))
+        {
+            continue;
+        }
+
+        Current.Add(Successor);
+        const bool bContinue = Extend(Graph, Pattern, MaxMatches, Current, OutMatches);
+        Current.Pop(EAllowShrinking::No);
+
+        if (!bContinue)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FBlueprintPatternMatcher::GetSuccessors(const FBlueprintGraphSummary& Graph, int32 NodeIndex, EBlueprintPatternEdge Edge, TArray<int32>& OutSuccessors)
+{
+    OutSuccessors.Reset();
+
+    switch (Edge)
+    {
+    case EBlueprintPatternEdge::Exec:
+        OutSuccessors = Graph.Nodes[NodeIndex].ExecSuccessors;
+        break;
+
+    case EBlueprintPatternEdge::Data:
+        OutSuccessors = Graph.Nodes[NodeIndex].DataSuccessors;
+        break;
+
+    case EBlueprintPatternEdge::ExecReachable:
+    {
+        // Breadth-first over exec wires; loops back to the start node are not successors
+        TBitArray<> Visited(false, Graph.Nodes.Num());
+        Visited[NodeIndex] = true;
+
+        TArray<int32> Queue = Graph.Nodes[NodeIndex].ExecSuccessors;
+        for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+        {
+            const int32 Reached = Queue[QueueIndex];
+            if (Visited[Reached])
+            {
+                continue;
+            }
+
+            Visited[Reached] = true;
+            OutSuccessors.Add(Reached);
+            Queue.Append(Graph.Nodes[Reached].ExecSuccessors);
+        }
+        break;
+    }
+    }
+}
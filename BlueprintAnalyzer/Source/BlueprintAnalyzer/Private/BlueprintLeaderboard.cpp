@@ -0,0 +1,59 @@
+#include "BlueprintAnalyzer/Public/BlueprintLeaderboard.h"
+#include "Algo/BinarySearch.h"
+
+namespace BlueprintLeaderboard
+{
+    /** Descending by value, then ascending by entry id */
+    struct FSlotOrder
+    {
+        bool operator()(const FBlueprintLeaderboardSlot& A, const FBlueprintLeaderboardSlot& B) const
+        {
+            return A.Value > B.Value || (A.Value == B.Value && A.EntryId < B.EntryId);
+        }
+    };
+}
+
+void FBlueprintLeaderboard::Add(int32 EntryId, int64 Value)
+{
+    if (Value == 0)
+    {
+        return;
+    }
+
+    Slots.Insert(FBlueprintLeaderboardSlot{ EntryId, Value }, LowerBound(EntryId, Value));
+}
+
+void FBlueprintLeaderboard::Remove(int32 EntryId, int64 Value)
+{
+    if (Value == 0)
+    {
+        return;
+    }
+
+    const int32 Index = LowerBound(EntryId, Value);
+    if (Index < Slots.Num() && Slots[Index].EntryId == EntryId && Slots[Index].Value == Value)
+    {
+        Slots.RemoveAt(Index, 1, EAllowShrinking::No);
+    }
+}
+
+void FBlueprintLeaderboard::GetTop(int32 MaxResults, TArray<FBlueprintLeaderboardSlot>& OutSlots) const
+{
+    OutSlots.Reset();
+    OutSlots.Append(Slots.GetData(), FMath::Clamp(MaxResults, 0, Slots.Num()));
+}
+
+int32 FBlueprintLeaderboard::Num() const
+{
+    return Slots.Num();
+}
+
+void FBlueprintLeaderboard::Reset()
+{
+    Slots.Empty();
+}
+
+int32 FBlueprintLeaderboard::LowerBound(int32 EntryId, int64 Value) const
+{
+    return Algo::LowerBound(Slots, FBlueprintLeaderboardSlot{ EntryId, Value }, BlueprintLeaderboard::FSlotOrder());
+}
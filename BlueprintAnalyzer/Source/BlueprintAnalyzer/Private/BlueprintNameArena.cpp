@@ -0,0 +1,248 @@
+#include "BlueprintAnalyzer/Public/BlueprintNameArena.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+
+#if PLATFORM_CPU_X86_FAMILY && defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#include <immintrin.h>
+#define BLUEPRINT_NAME_ARENA_AVX2 1
+#define BLUEPRINT_NAME_ARENA_SSE 0
+#elif PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#define BLUEPRINT_NAME_ARENA_AVX2 0
+#define BLUEPRINT_NAME_ARENA_SSE 1
+#else
+#define BLUEPRINT_NAME_ARENA_AVX2 0
+#define BLUEPRINT_NAME_ARENA_SSE 0
+#endif
+
+namespace BlueprintNameArena
+{
+    /**
+     * Check the candidate positions flagged in a block mask against the full needle
+     * @return Offset within the block of the first confirmed match, or INDEX_NONE
+     */
+    FORCEINLINE int32 ConfirmCandidates(uint32 Mask, const uint8* Block, const uint8* Needle, int32 NeedleLength)
+    {
+        while (Mask != 0)
+        {
+            const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros(Mask));
+
+            // First and last bytes already matched, only the middle is left
+            if (NeedleLength <= 2 || FMemory::Memcmp(Block + Bit + 1, Needle + 1, NeedleLength - 2) == 0)
+            {
+                return Bit;
+            }
+
+            Mask &= Mask - 1;
+        }
+
+        return INDEX_NONE;
+    }
+}
+
+void FBlueprintNameArena::FoldText(const FString& Text, TArray<uint8>& OutBytes)
+{
+    FString Folded = Text.ToLower();
+
+    const FTCHARToUTF8 Converted(*Folded, Folded.Len());
+    OutBytes.Reset(Converted.Length());
+    OutBytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+int32 FBlueprintNameArena::FindBytes(const uint8* Haystack, int32 HaystackLength, const uint8* Needle, int32 NeedleLength)
+{
+    if (NeedleLength <= 0 || NeedleLength > HaystackLength)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 Index = 0;
+
+    // Compare a block of start positions at once: a position is only a candidate if both the
+    // first and the last needle byte line up, which rejects almost everything in identifier text
+#if BLUEPRINT_NAME_ARENA_AVX2
+    const __m256i First = _mm256_set1_epi8(static_cast<char>(Needle[0]));
+    const __m256i Last = _mm256_set1_epi8(static_cast<char>(Needle[NeedleLength - 1]));
+
+    for (; Index + NeedleLength - 1 + 32 <= HaystackLength; Index += 32)
+    {
+        const __m256i BlockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Haystack + Index));
+        const __m256i BlockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Haystack + Index + NeedleLength - 1));
+        const __m256i Matches = _mm256_and_si256(_mm256_cmpeq_epi8(First, BlockFirst), _mm256_cmpeq_epi8(Last, BlockLast));
+
+        const int32 Found = BlueprintNameArena::ConfirmCandidates(static_cast<uint32>(_mm256_movemask_epi8(Matches)), Haystack + Index, Needle, NeedleLength);
+        if (Found != INDEX_NONE)
+        {
+            return Index + Found;
+        }
+    }
+#elif BLUEPRINT_NAME_ARENA_SSE
+    const __m128i First = _mm_set1_epi8(static_cast<char>(Needle[0]));
+    const __m128i Last = _mm_set1_epi8(static_cast<char>(Needle[NeedleLength - 1]));
+
+    for (; Index + NeedleLength - 1 + 16 <= HaystackLength; Index += 16)
+    {
+        const __m128i BlockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Haystack + Index));
+        const __m128i BlockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Haystack + Index + NeedleLength - 1));
+        const __m128i Matches = _mm_and_si128(_mm_cmpeq_epi8(First, BlockFirst), _mm_cmpeq_epi8(Last, BlockLast));
+
+        const int32 Found = BlueprintNameArena::ConfirmCandidates(static_cast<uint32>(_mm_movemask_epi8(Matches)), Haystack + Index, Needle, NeedleLength);
+        if (Found != INDEX_NONE)
+        {
+            return Index + Found;
+        }
+    }
+#endif
+
+    // Scalar fallback for the tail and for platforms without the vector path
+    for (; Index + NeedleLength <= HaystackLength; ++Index)
+    {
+        if (Haystack[Index] == Needle[0] &&
+            Haystack[Index + NeedleLength - 1] == Needle[NeedleLength - 1] &&
+            (NeedleLength <= 2 || FMemory::Memcmp(Haystack + Index + 1, Needle + 1, NeedleLength - 2) == 0))
+        {
+            return Index;
+        }
+    }
+
+    return INDEX_NONE;
+}
+
+void FBlueprintNameArena::AddDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts)
+{
+    FFieldArena& Arena = Arenas[static_cast<int32>(Field)];
+
+    TArray<uint8> Folded;
+    for (const FString& Text : Texts)
+    {
+        if (Text.IsEmpty())
+        {
+            continue;
+        }
+
+        FoldText(Text, Folded);
+
+        FRecord Record;
+        Record.Offset = Arena.Bytes.Num();
+        Record.Length = Folded.Num();
+        Record.DocumentId = DocumentId;
+
+        Arena.Bytes.Append(Folded);
+        Arena.Bytes.Add(0);
+
+        Arena.DocumentRecords.FindOrAdd(DocumentId).Add(Arena.Records.Add(Record));
+    }
+}
+
+void FBlueprintNameArena::RemoveDocument(int32 DocumentId, EBlueprintSearchField Field)
+{
+    FFieldArena& Arena = Arenas[static_cast<int32>(Field)];
+
+    TArray<int32> RecordIndices;
+    if (!Arena.DocumentRecords.RemoveAndCopyValue(DocumentId, RecordIndices))
+    {
+        return;
+    }
+
+    // Zero the bytes so scans skip them without checking liveness, and reclaim them later in bulk
+    for (int32 RecordIndex : RecordIndices)
+    {
+        FRecord& Record = Arena.Records[RecordIndex];
+        FMemory::Memzero(Arena.Bytes.GetData() + Record.Offset, Record.Length);
+        Record.DocumentId = INDEX_NONE;
+        Arena.DeadBytes += Record.Length + 1;
+    }
+
+    if (Arena.DeadBytes > Arena.Bytes.Num() / 2)
+    {
+        Compact(Arena);
+    }
+}
+
+void FBlueprintNameArena::Find(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutDocumentIds) const
+{
+    OutDocumentIds.Reset();
+
+    const FFieldArena& Arena = Arenas[static_cast<int32>(Field)];
+
+    TArray<uint8> FoldedNeedle;
+    FoldText(Needle, FoldedNeedle);
+    if (FoldedNeedle.Num() == 0)
+    {
+        return;
+    }
+
+    const uint8* Bytes = Arena.Bytes.GetData();
+    const int32 NumBytes = Arena.Bytes.Num();
+
+    int32 Position = 0;
+    while (Position < NumBytes)
+    {
+        const int32 Found = FindBytes(Bytes + Position, NumBytes - Position, FoldedNeedle.GetData(), FoldedNeedle.Num());
+        if (Found == INDEX_NONE)
+        {
+            break;
+        }
+
+        // Map the byte offset back to its record; separators guarantee the match lies inside it
+        const int32 MatchOffset = Position + Found;
+        const int32 RecordIndex = Algo::UpperBoundBy(Arena.Records, MatchOffset, &FRecord::Offset) - 1;
+        const FRecord& Record = Arena.Records[RecordIndex];
+
+        OutDocumentIds.Add(Record.DocumentId);
+
+        // One hit per string is enough, continue after its separator
+        Position = Record.Offset + Record.Length + 1;
+    }
+
+    // A document can own several strings of the same field
+    OutDocumentIds.Sort();
+    OutDocumentIds.SetNum(Algo::Unique(OutDocumentIds));
+}
+
+void FBlueprintNameArena::Reset()
+{
+    for (FFieldArena& Arena : Arenas)
+    {
+        Arena = FFieldArena();
+    }
+}
+
+SIZE_T FBlueprintNameArena::GetAllocatedSize() const
+{
+    SIZE_T Size = 0;
+    for (const FFieldArena& Arena : Arenas)
+    {
+        Size += Arena.Bytes.GetAllocatedSize() + Arena.Records.GetAllocatedSize() + Arena.DocumentRecords.GetAllocatedSize();
+    }
+    return Size;
+}
+
+void FBlueprintNameArena::Compact(FFieldArena& Arena)
+{
+    TArray<uint8> Bytes;
+    Bytes.Reserve(Arena.Bytes.Num() - Arena.DeadBytes);
+
+    TArray<FRecord> Records;
+    Records.Reserve(Arena.Records.Num());
+
+    Arena.DocumentRecords.Reset();
+
+    for (const FRecord& Record : Arena.Records)
+    {
+        if (Record.DocumentId == INDEX_NONE)
+        {
+            continue;
+        }
+
+        FRecord& Moved = Records.Add_GetRef(Record);
+        Moved.Offset = Bytes.Num();
+
+        Bytes.Append(Arena.Bytes.GetData() + Record.Offset, Record.Length + 1);
+        Arena.DocumentRecords.FindOrAdd(Record.DocumentId).Add(Records.Num() - 1);
+    }
+
+    Arena.Bytes = MoveTemp(Bytes);
+    Arena.Records = MoveTemp(Records);
+    Arena.DeadBytes = 0;
+}
@@ -0,0 +1,172 @@
+#include "BlueprintAnalyzer/Public/BlueprintPathTree.h"
+#include "Algo/BinarySearch.h"
+
+void FBlueprintPathTree::AddEntry(int32 EntryId, const FString& PackagePath, int32 NodeCount, bool bHasGraphData)
+{
+    const int32 FolderIndex = FindFolder(PackagePath, true);
+
+    TArray<int32>& EntryIds = Folders[FolderIndex].EntryIds;
+    EntryIds.Insert(EntryId, Algo::LowerBound(EntryIds, EntryId));
+
+    // Every ancestor up to the root counts the blueprint
+    for (int32 Index = FolderIndex; Index != INDEX_NONE; Index = Folders[Index].Parent)
+    {
+        FFolder& Folder = Folders[Index];
+        ++Folder.BlueprintCount;
+        Folder.BlueprintsWithGraphData += bHasGraphData ? 1 : 0;
+        Folder.NodeCount += NodeCount;
+    }
+}
+
+void FBlueprintPathTree::RemoveEntry(int32 EntryId, const FString& PackagePath, int32 NodeCount, bool bHasGraphData)
+{
+    const int32 FolderIndex = FindFolder(PackagePath, false);
+    if (FolderIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    TArray<int32>& EntryIds = Folders[FolderIndex].EntryIds;
+    const int32 Found = Algo::BinarySearch(EntryIds, EntryId);
+    if (Found == INDEX_NONE)
+    {
+        return;
+    }
+    EntryIds.RemoveAt(Found, 1, EAllowShrinking::No);
+
+    // Folders that become empty stay in the tree and are simply not listed
+    for (int32 Index = FolderIndex; Index != INDEX_NONE; Index = Folders[Index].Parent)
+    {
+        FFolder& Folder = Folders[Index];
+        --Folder.BlueprintCount;
+        Folder.BlueprintsWithGraphData -= bHasGraphData ? 1 : 0;
+        Folder.NodeCount -= NodeCount;
+    }
+}
+
+bool FBlueprintPathTree::GetListing(const FString& PackagePath, FBlueprintFolderListing& OutListing) const
+{
+    OutListing = FBlueprintFolderListing();
+
+    const int32 FolderIndex = FindFolder(PackagePath);
+    if (FolderIndex == INDEX_NONE || Folders[FolderIndex].BlueprintCount == 0)
+    {
+        return false;
+    }
+
+    const FFolder& Folder = Folders[FolderIndex];
+    MakeInfo(Folder, OutListing.Folder);
+    OutListing.EntryIds = Folder.EntryIds;
+
+    for (const TPair<FString, int32>& Child : Folder.Children)
+    {
+        const FFolder& ChildFolder = Folders[Child.Value];
+        if (ChildFolder.BlueprintCount > 0)
+        {
+            MakeInfo(ChildFolder, OutListing.Subfolders.AddDefaulted_GetRef());
+        }
+    }
+
+    OutListing.Subfolders.Sort([](const FBlueprintFolderInfo& A, const FBlueprintFolderInfo& B)
+    {
+        return A.Path < B.Path;
+    });
+
+    return true;
+}
+
+void FBlueprintPathTree::Reset()
+{
+    Folders.Empty();
+}
+
+FString FBlueprintPathTree::GetPackagePath(const FString& ObjectPath)
+{
+    // /Game/Characters/BP_Hero.BP_Hero -> /Game/Characters/BP_Hero -> /Game/Characters
+    FString PackageName = ObjectPath;
+    int32 DotIndex = INDEX_NONE;
+    if (PackageName.FindChar(TEXT('.'), DotIndex))
+    {
+        PackageName.LeftInline(DotIndex, EAllowShrinking::No);
+    }
+
+    int32 SlashIndex = INDEX_NONE;
+    if (PackageName.FindLastChar(TEXT('/'), SlashIndex))
+    {
+        return PackageName.Left(SlashIndex);
+    }
+    return FString();
+}
+
+int32 FBlueprintPathTree::FindFolder(const FString& PackagePath, bool bCreate)
+{
+    if (Folders.Num() == 0)
+    {
+        if (!bCreate)
+        {
+            return INDEX_NONE;
+        }
+        Folders.AddDefaulted();
+    }
+
+    TArray<FString> Segments;
+    PackagePath.ParseIntoArray(Segments, TEXT("/"));
+
+    int32 FolderIndex = 0;
+    for (const FString& Segment : Segments)
+    {
+        if (const int32* ChildIndex = Folders[FolderIndex].Children.Find(Segment))
+        {
+            FolderIndex = *ChildIndex;
+            continue;
+        }
+
+        if (!bCreate)
+        {
+            return INDEX_NONE;
+        }
+
+        // Add the folder first; growing Folders would invalidate references into it
+        const int32 NewIndex = Folders.AddDefaulted();
+        Folders[NewIndex].Name = Segment;
+        Folders[NewIndex].Path = Folders[FolderIndex].Path + TEXT("/") + Segment;
+        Folders[NewIndex].Parent = FolderIndex;
+        Folders[FolderIndex].Children.Add(Segment, NewIndex);
+        FolderIndex = NewIndex;
+    }
+
+    return FolderIndex;
+}
+
+int32 FBlueprintPathTree::FindFolder(const FString& PackagePath) const
+{
+    if (Folders.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    TArray<FString> Segments;
+    PackagePath.ParseIntoArray(Segments, TEXT("/"));
+
+    int32 FolderIndex = 0;
+    for (const FString& Segment : Segments)
+    {
+        const int32* ChildIndex = Folders[FolderIndex].Children.Find(Segment);
+        if (!ChildIndex)
+        {
+            return INDEX_NONE;
+        }
+        FolderIndex = *ChildIndex;
+    }
+
+    return FolderIndex;
+}
+
+void FBlueprintPathTree::MakeInfo(const FFolder& Folder, FBlueprintFolderInfo& OutInfo)
+{
+    OutInfo.Name = Folder.Name;
+    OutInfo.Path = Folder.Path.IsEmpty() ? TEXT("/") : Folder.Path;
+    OutInfo.BlueprintCount = Folder.BlueprintCount;
+    OutInfo.BlueprintsWithGraphData = Folder.BlueprintsWithGraphData;
+    OutInfo.NodeCount = Folder.NodeCount;
+}
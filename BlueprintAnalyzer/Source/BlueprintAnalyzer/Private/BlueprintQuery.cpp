@@ -0,0 +1,716 @@
+#include "BlueprintAnalyzer/Public/BlueprintQuery.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+
+namespace BlueprintQuery
+{
+    /** Relative cost of checking one blueprint against an in-memory predicate */
+    constexpr double ScanCost = 1.0;
+
+    /** Relative cost of looking up an asset registry tag */
+    constexpr double TagCost = 2.0;
+
+    /** Relative cost of loading a blueprint to extract its functions and variables */
+    constexpr double LoadCost = 200.0;
+
+    /**
+     * Data structure representing one token of a query expression
+     */
+    struct FToken
+    {
+        enum class EType : uint8 { End, LeftParen, RightParen, And, Or, Not, Term };
+
+        EType Type = EType::End;
+        FString Text;
+    };
+
+    /**
+     * Recursive descent parser over a query expression
+     */
+    class FParser
+    {
+    public:
+        explicit FParser(const FString& InExpression)
+            : Expression(InExpression)
+        {
+            Advance();
+        }
+
+        TSharedPtr<FBlueprintQueryNode> ParseQuery(FString& OutError)
+        {
+            TSharedPtr<FBlueprintQueryNode> Root = ParseOr();
+
+            if (Error.IsEmpty() && Current.Type != FToken::EType::End)
+            {
+                Error = FString::Printf(TEXT("Unexpected '%s' at position %d"), *Current.Text, TokenStart);
+            }
+
+            if (!Error.IsEmpty())
+            {
+                OutError = Error;
+                return nullptr;
+            }
+
+            return Root;
+        }
+
+    private:
+        void Advance()
+        {
+            const int32 Length = Expression.Len();
+
+            while (Position < Length && FChar::IsWhitespace(Expression[Position]))
+            {
+                ++Position;
+            }
+
+            TokenStart = Position;
+            Current = FToken();
+
+            if (Position >= Length)
+            {
+                return;
+            }
+
+            const TCHAR Char = Expression[Position];
+            if (Char == TEXT('(') || Char == TEXT(')'))
+            {
+                Current.Type = Char == TEXT('(') ? FToken::EType::LeftParen : FToken::EType::RightParen;
+                Current.Text = FString::Chr(Char);
+                ++Position;
+                return;
+            }
+
+            // Read a term; quoted sections may contain spaces and parentheses
+            bool bQuoted = false;
+            while (Position < Length)
+            {
+                const TCHAR TermChar = Expression[Position];
+
+                if (TermChar == TEXT('"'))
+                {
+                    bQuoted = true;
+                    ++Position;
+                    while (Position < Length && Expression[Position] != TEXT('"'))
+                    {
+                        Current.Text.AppendChar(Expression[Position++]);
+                    }
+
+                    if (Position >= Length)
+                    {
+                        Error = FString::Printf(TEXT("Unterminated quote at position %d"), TokenStart);
+                        return;
+                    }
+
+                    ++Position;
+                    continue;
+                }
+
+                if (FChar::IsWhitespace(TermChar) || TermChar == TEXT('(') || TermChar == TEXT(')'))
+                {
+                    break;
+                }
+
+                Current.Text.AppendChar(TermChar);
+                ++Position;
+            }
+
+            Current.Type = FToken::EType::Term;
+            if (!bQuoted)
+            {
+                if (Current.Text.Equals(TEXT("AND"), ESearchCase::IgnoreCase))
+                {
+                    Current.Type = FToken::EType::And;
+                }
+                else if (Current.Text.Equals(TEXT("OR"), ESearchCase::IgnoreCase))
+                {
+                    Current.Type = FToken::EType::Or;
+                }
+                else if (Current.Text.Equals(TEXT("NOT"), ESearchCase::IgnoreCase))
+                {
+                    Current.Type = FToken::EType::Not;
+                }
+            }
+        }
+
+        /** Combine children under an And/Or node, flattening nested nodes of the same kind */
+        static TSharedPtr<FBlueprintQueryNode> Combine(EBlueprintQueryOp Op, TArray<TSharedPtr<FBlueprintQueryNode>>& Children)
+        {
+            if (Children.Num() == 1)
+            {
+                return Children[0];
+            }
+
+            TSharedPtr<FBlueprintQueryNode> Node = MakeShareable(new FBlueprintQueryNode);
+            Node->Op = Op;
+            for (TSharedPtr<FBlueprintQueryNode>& Child : Children)
+            {
+                if (Child->Op == Op)
+                {
+                    Node->Children.Append(MoveTemp(Child->Children));
+                }
+                else
+                {
+                    Node->Children.Add(MoveTemp(Child));
+                }
+            }
+            return Node;
+        }
+
+        TSharedPtr<FBlueprintQueryNode> ParseOr()
+        {
+            TArray<TSharedPtr<FBlueprintQueryNode>> Children;
+            Children.Add(ParseAnd());
+
+            while (Error.IsEmpty() && Current.Type == FToken::EType::Or)
+            {
+                Advance();
+                Children.Add(ParseAnd());
+            }
+
+            return Error.IsEmpty() ? Combine(EBlueprintQueryOp::Or, Children) : nullptr;
+        }
+
+        TSharedPtr<FBlueprintQueryNode> ParseAnd()
+        {
+            TArray<TSharedPtr<FBlueprintQueryNode>> Children;
+            Children.Add(ParseNot());
+
+            // Adjacent terms without an operator are an implicit AND
+            while (Error.IsEmpty() && (Current.Type == FToken::EType::And || Current.Type == FToken::EType::Not ||
+                                       Current.Type == FToken::EType::Term || Current.Type == FToken::EType::LeftParen))
+            {
+                if (Current.Type == FToken::EType::And)
+                {
+                    Advance();
+                }
+                Children.Add(ParseNot());
+            }
+
+            return Error.IsEmpty() ? Combine(EBlueprintQueryOp::And, Children) : nullptr;
+        }
+
+        TSharedPtr<FBlueprintQueryNode> ParseNot()
+        {
+            if (Current.Type == FToken::EType::Not)
+            {
+                Advance();
+
+                TSharedPtr<FBlueprintQueryNode> Child = ParseNot();
+                if (!Error.IsEmpty())
+                {
+                    return nullptr;
+                }
+
+                TSharedPtr<FBlueprintQueryNode> Node = MakeShareable(new FBlueprintQueryNode);
+                Node->Op = EBlueprintQueryOp::Not;
+                Node->Children.Add(Child);
+                return Node;
+            }
+
+            return ParsePrimary();
+        }
+
+        TSharedPtr<FBlueprintQueryNode> ParsePrimary()
+        {
+            if (!Error.IsEmpty())
+            {
+                return nullptr;
+            }
+
+            if (Current.Type == FToken::EType::LeftParen)
+            {
+                Advance();
+                TSharedPtr<FBlueprintQueryNode> Node = ParseOr();
+                if (!Error.IsEmpty())
+                {
+                    return nullptr;
+                }
+
+                if (Current.Type != FToken::EType::RightParen)
+                {
+                    Error = FString::Printf(TEXT("Expected ')' at position %d"), TokenStart);
+                    return nullptr;
+                }
+
+                Advance();
+                return Node;
+            }
+
+            if (Current.Type != FToken::EType::Term)
+            {
+                Error = Current.Type == FToken::EType::End
+                    ? FString(TEXT("Unexpected end of query"))
+                    : FString::Printf(TEXT("Unexpected '%s' at position %d"), *Current.Text, TokenStart);
+                return nullptr;
+            }
+
+            // Split field:value
+            FString FieldName;
+            FString Value;
+            if (!Current.Text.Split(TEXT(":"), &FieldName, &Value))
+            {
+                Error = FString::Printf(TEXT("Expected field:value at position %d, got '%s'"), TokenStart, *Current.Text);
+                return nullptr;
+            }
+
+            TSharedPtr<FBlueprintQueryNode> Node = MakeShareable(new FBlueprintQueryNode);
+            Node->Op = EBlueprintQueryOp::Predicate;
+            Node->Value = Value;
+
+            if (FieldName.Equals(TEXT("name"), ESearchCase::IgnoreCase))
+            {
+                Node->Field = EBlueprintQueryField::Name;
+            }
+            else if (FieldName.Equals(TEXT("path"), ESearchCase::IgnoreCase))
+            {
+                Node->Field = EBlueprintQueryField::Path;
+            }
+            else if (FieldName.Equals(TEXT("parentClass"), ESearchCase::IgnoreCase))
+            {
+                Node->Field = EBlueprintQueryField::ParentClass;
+            }
+            else if (FieldName.Equals(TEXT("function"), ESearchCase::IgnoreCase))
+            {
+                Node->Field = EBlueprintQueryField::Function;
+            }
+            else if (FieldName.Equals(TEXT("variable"), ESearchCase::IgnoreCase))
+            {
+                Node->Field = EBlueprintQueryField::Variable;
+            }
+            else if (FieldName.Equals(TEXT("tag"), ESearchCase::IgnoreCase))
+            {
+                // tag:Key matches any value, tag:Key=Value matches values containing Value
+                Node->Field = EBlueprintQueryField::Tag;
+                if (!Value.Split(TEXT("="), &Node->TagKey, &Node->Value))
+                {
+                    Node->TagKey = Value;
+                    Node->Value.Empty();
+                }
+
+                if (Node->TagKey.IsEmpty())
+                {
+                    Error = FString::Printf(TEXT("Missing tag name at position %d"), TokenStart);
+                    return nullptr;
+                }
+            }
+            else
+            {
+                Error = FString::Printf(TEXT("Unknown field '%s' at position %d (expected name, path, parentClass, function, variable or tag)"), *FieldName, TokenStart);
+                return nullptr;
+            }
+
+            Advance();
+            return Node;
+        }
+
+        const FString& Expression;
+        int32 Position = 0;
+        int32 TokenStart = 0;
+        FToken Current;
+        FString Error;
+    };
+
+    /** Map a query field to the catalog's indexed field, if it has one */
+    bool GetSearchField(EBlueprintQueryField Field, EBlueprintSearchField& OutField)
+    {
+        switch (Field)
+        {
+        case EBlueprintQueryField::Name:
+            OutField = EBlueprintSearchField::Name;
+            return true;
+        case EBlueprintQueryField::Path:
+            OutField = EBlueprintSearchField::Path;
+            return true;
+        case EBlueprintQueryField::ParentClass:
+            OutField = EBlueprintSearchField::ParentClass;
+            return true;
+        case EBlueprintQueryField::Function:
+            OutField = EBlueprintSearchField::Function;
+            return true;
+        case EBlueprintQueryField::Variable:
+            OutField = EBlueprintSearchField::Variable;
+            return true;
+        case EBlueprintQueryField::Tag:
+            return false;
+        }
+        return false;
+    }
+
+    /** Sorted set intersection */
+    void Intersect(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& Out)
+    {
+        Out.Reset();
+        int32 IndexA = 0;
+        int32 IndexB = 0;
+        while (IndexA < A.Num() && IndexB < B.Num())
+        {
+            if (A[IndexA] < B[IndexB])
+            {
+                ++IndexA;
+            }
+            else if (A[IndexA] > B[IndexB])
+            {
+                ++IndexB;
+            }
+            else
+            {
+                Out.Add(A[IndexA]);
+                ++IndexA;
+                ++IndexB;
+            }
+        }
+    }
+
+    /** Sorted set difference A - B */
+    void Subtract(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& Out)
+    {
+        Out.Reset();
+        int32 IndexB = 0;
+        for (int32 Value : A)
+        {
+            while (IndexB < B.Num() && B[IndexB] < Value)
+            {
+                ++IndexB;
+            }
+            if (IndexB >= B.Num() || B[IndexB] != Value)
+            {
+                Out.Add(Value);
+            }
+        }
+    }
+
+    /** Sorted set union */
+    void Union(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& Out)
+    {
+        Out.Reset(A.Num() + B.Num());
+        int32 IndexA = 0;
+        int32 IndexB = 0;
+        while (IndexA < A.Num() || IndexB < B.Num())
+        {
+            if (IndexB >= B.Num() || (IndexA < A.Num() && A[IndexA] < B[IndexB]))
+            {
+                Out.Add(A[IndexA++]);
+            }
+            else if (IndexA >= A.Num() || B[IndexB] < A[IndexA])
+            {
+                Out.Add(B[IndexB++]);
+            }
+            else
+            {
+                Out.Add(A[IndexA]);
+                ++IndexA;
+                ++IndexB;
+            }
+        }
+    }
+
+    const TCHAR* GetOpName(EBlueprintQueryOp Op)
+    {
+        switch (Op)
+        {
+        case EBlueprintQueryOp::And: return TEXT("and");
+        case EBlueprintQueryOp::Or: return TEXT("or");
+        case EBlueprintQueryOp::Not: return TEXT("not");
+        case EBlueprintQueryOp::Predicate: return TEXT("predicate");
+        }
+        return TEXT("");
+    }
+
+    const TCHAR* GetFieldName(EBlueprintQueryField Field)
+    {
+        switch (Field)
+        {
+        case EBlueprintQueryField::Name: return TEXT("name");
+        case EBlueprintQueryField::Path: return TEXT("path");
+        case EBlueprintQueryField::ParentClass: return TEXT("parentClass");
+        case EBlueprintQueryField::Tag: return TEXT("tag");
+        case EBlueprintQueryField::Function: return TEXT("function");
+        case EBlueprintQueryField::Variable: return TEXT("variable");
+        }
+        return TEXT("");
+    }
+}
+
+TSharedPtr<FBlueprintQueryNode> FBlueprintQuery::Parse(const FString& Expression, FString& OutError)
+{
+    BlueprintQuery::FParser Parser(Expression);
+    return Parser.ParseQuery(OutError);
+}
+
+void FBlueprintQuery::Plan(const TSharedPtr<FBlueprintQueryNode>& Root)
+{
+    if (!Root.IsValid())
+    {
+        return;
+    }
+
+    const int32 TotalRows = FBlueprintCatalog::GetNumEntries();
+    const double UnloadedFraction = TotalRows > 0
+        ? 1.0 - static_cast<double>(FBlueprintCatalog::GetNumEntriesWithMemberData()) / TotalRows
+        : 0.0;
+
+    PlanNode(*Root, TotalRows, UnloadedFraction);
+}
+
+void FBlueprintQuery::PlanNode(FBlueprintQueryNode& Node, int32 TotalRows, double UnloadedFraction)
+{
+    for (const TSharedPtr<FBlueprintQueryNode>& Child : Node.Children)
+    {
+        PlanNode(*Child, TotalRows, UnloadedFraction);
+    }
+
+    switch (Node.Op)
+    {
+    case EBlueprintQueryOp::Predicate:
+    {
+        EBlueprintSearchField SearchField;
+        const bool bIndexed = BlueprintQuery::GetSearchField(Node.Field, SearchField);
+        const int32 IndexEstimate = bIndexed ? FBlueprintCatalog::EstimateSubstring(SearchField, Node.Value) : INDEX_NONE;
+
+        Node.bNeedsMemberData = Node.Field == EBlueprintQueryField::Function || Node.Field == EBlueprintQueryField::Variable;
+
+        if (Node.bNeedsMemberData)
+        {
+            // Member postings only cover loaded blueprints, so scale the estimate up to the whole catalog
+            const double LoadedFraction = FMath::Max(1.0 - UnloadedFraction, 0.01);
+            Node.EstimatedRows = IndexEstimate != INDEX_NONE
+                ? FMath::Min(TotalRows, FMath::CeilToInt32(IndexEstimate / LoadedFraction))
+                : TotalRows;
+            Node.EstimatedCost = TotalRows * (BlueprintQuery::ScanCost + UnloadedFraction * BlueprintQuery::LoadCost);
+        }
+        else if (Node.Field == EBlueprintQueryField::Tag)
+        {
+            // No index and no statistics for tags; assume half the blueprints match
+            Node.EstimatedRows = TotalRows / 2;
+            Node.EstimatedCost = TotalRows * BlueprintQuery::TagCost;
+        }
+        else
+        {
+            Node.EstimatedRows = IndexEstimate != INDEX_NONE ? FMath::Min(IndexEstimate, TotalRows) : TotalRows;
+            Node.EstimatedCost = (IndexEstimate != INDEX_NONE ? Node.EstimatedRows : TotalRows) * BlueprintQuery::ScanCost;
+        }
+        break;
+    }
+
+    case EBlueprintQueryOp::And:
+    {
+        // Registry-only predicates first, then by cost, then by selectivity,
+        // so blueprints are only loaded for candidates that survive the cheap filters
+        Node.Children.StableSort([](const TSharedPtr<FBlueprintQueryNode>& A, const TSharedPtr<FBlueprintQueryNode>& B)
+        {
+            if (A->bNeedsMemberData != B->bNeedsMemberData)
+            {
+                return !A->bNeedsMemberData;
+            }
+            if (A->EstimatedCost != B->EstimatedCost)
+            {
+                return A->EstimatedCost < B->EstimatedCost;
+            }
+            return A->EstimatedRows < B->EstimatedRows;
+        });
+
+        // Each child only sees the rows that survived the children before it
+        double Rows = TotalRows;
+        double Cost = 0.0;
+        for (const TSharedPtr<FBlueprintQueryNode>& Child : Node.Children)
+        {
+            const double InputFraction = TotalRows > 0 ? Rows / TotalRows : 0.0;
+            Cost += Child->EstimatedCost * InputFraction;
+            Rows *= TotalRows > 0 ? static_cast<double>(Child->EstimatedRows) / TotalRows : 0.0;
+            Node.bNeedsMemberData |= Child->bNeedsMemberData;
+        }
+
+        Node.EstimatedRows = FMath::CeilToInt32(Rows);
+        Node.EstimatedCost = Cost;
+        break;
+    }
+
+    case EBlueprintQueryOp::Or:
+    {
+        int32 Rows = 0;
+        double Cost = 0.0;
+        for (const TSharedPtr<FBlueprintQueryNode>& Child : Node.Children)
+        {
+            Rows += Child->EstimatedRows;
+            Cost += Child->EstimatedCost;
+            Node.bNeedsMemberData |= Child->bNeedsMemberData;
+        }
+
+        Node.EstimatedRows = FMath::Min(Rows, TotalRows);
+        Node.EstimatedCost = Cost;
+        break;
+    }
+
+    case EBlueprintQueryOp::Not:
+        Node.EstimatedRows = TotalRows - Node.Children[0]->EstimatedRows;
+        Node.EstimatedCost = Node.Children[0]->EstimatedCost;
+        Node.bNeedsMemberData = Node.Children[0]->bNeedsMemberData;
+        break;
+    }
+}
+
+void FBlueprintQuery::Execute(const TSharedPtr<FBlueprintQueryNode>& Root, TArray<int32>& OutEntryIds)
+{
+    OutEntryIds.Reset();
+
+    if (!Root.IsValid())
+    {
+        return;
+    }
+
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+
+    Evaluate(*Root, AllEntryIds, OutEntryIds);
+}
+
+void FBlueprintQuery::Evaluate(const FBlueprintQueryNode& Node, const TArray<int32>& Candidates, TArray<int32>& OutEntryIds)
+{
+    switch (Node.Op)
+    {
+    case EBlueprintQueryOp::Predicate:
+        EvaluatePredicate(Node, Candidates, OutEntryIds);
+        break;
+
+    case EBlueprintQueryOp::And:
+    {
+        // Narrow the candidate set child by child and stop as soon as it's empty
+        OutEntryIds = Candidates;
+        TArray<int32> Matched;
+        for (const TSharedPtr<FBlueprintQueryNode>& Child : Node.Children)
+        {
+            if (OutEntryIds.Num() == 0)
+            {
+                break;
+            }
+
+            Evaluate(*Child, OutEntryIds, Matched);
+            Swap(OutEntryIds, Matched);
+        }
+        break;
+    }
+
+    case EBlueprintQueryOp::Or:
+    {
+        // Candidates already matched by an earlier child don't need to be tested again
+        OutEntryIds.Reset();
+        TArray<int32> Remaining = Candidates;
+        TArray<int32> Matched;
+        TArray<int32> Scratch;
+        for (const TSharedPtr<FBlueprintQueryNode>& Child : Node.Children)
+        {
+            if (Remaining.Num() == 0)
+            {
+                break;
+            }
+
+            Evaluate(*Child, Remaining, Matched);
+
+            BlueprintQuery::Union(OutEntryIds, Matched, Scratch);
+            Swap(OutEntryIds, Scratch);
+
+            BlueprintQuery::Subtract(Remaining, Matched, Scratch);
+            Swap(Remaining, Scratch);
+        }
+        break;
+    }
+
+    case EBlueprintQueryOp::Not:
+    {
+        TArray<int32> Matched;
+        Evaluate(*Node.Children[0], Candidates, Matched);
+        BlueprintQuery::Subtract(Candidates, Matched, OutEntryIds);
+        break;
+    }
+    }
+}
+
+void FBlueprintQuery::EvaluatePredicate(const FBlueprintQueryNode& Node, const TArray<int32>& Candidates, TArray<int32>& OutEntryIds)
+{
+    OutEntryIds.Reset();
+
+    // Only load the blueprints that are still candidates
+    if (Node.Field == EBlueprintQueryField::Function || Node.Field == EBlueprintQueryField::Variable)
+    {
+        FBlueprintCatalog::EnsureMemberData(Candidates);
+    }
+
+    // Use the trigram index when it yields fewer rows than checking every candidate
+    EBlueprintSearchField SearchField;
+    if (BlueprintQuery::GetSearchField(Node.Field, SearchField))
+    {
+        const int32 IndexEstimate = FBlueprintCatalog::EstimateSubstring(SearchField, Node.Value);
+        if (IndexEstimate != INDEX_NONE && IndexEstimate < Candidates.Num())
+        {
+            TArray<int32> Matches;
+            FBlueprintCatalog::FindSubstring(SearchField, Node.Value, Matches);
+            BlueprintQuery::Intersect(Candidates, Matches, OutEntryIds);
+            return;
+        }
+    }
+
+    for (int32 EntryId : Candidates)
+    {
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+        if (Entry && PredicateMatches(Node, *Entry))
+        {
+            OutEntryIds.Add(EntryId);
+        }
+    }
+}
+
+bool FBlueprintQuery::PredicateMatches(const FBlueprintQueryNode& Node, const FBlueprintCatalogEntry& Entry)
+{
+    if (Node.Field == EBlueprintQueryField::Tag)
+    {
+        for (const TPair<FName, FString>& Tag : Entry.AssetTags)
+        {
+            if (Tag.Key.ToString().Equals(Node.TagKey, ESearchCase::IgnoreCase))
+            {
+                return Node.Value.IsEmpty() || Tag.Value.Contains(Node.Value, ESearchCase::IgnoreCase);
+            }
+        }
+        return false;
+    }
+
+    EBlueprintSearchField SearchField;
+    return BlueprintQuery::GetSearchField(Node.Field, SearchField) && FBlueprintCatalog::FieldContains(Entry, SearchField, Node.Value);
+}
+
+TSharedPtr<FJsonObject> FBlueprintQuery::Explain(const TSharedPtr<FBlueprintQueryNode>& Root)
+{
+    TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
+    if (!Root.IsValid())
+    {
+        return NodeObject;
+    }
+
+    NodeObject->SetStringField(TEXT("op"), BlueprintQuery::GetOpName(Root->Op));
+
+    if (Root->Op == EBlueprintQueryOp::Predicate)
+    {
+        NodeObject->SetStringField(TEXT("field"), BlueprintQuery::GetFieldName(Root->Field));
+        if (Root->Field == EBlueprintQueryField::Tag)
+        {
+            NodeObject->SetStringField(TEXT("tag"), Root->TagKey);
+        }
+        NodeObject->SetStringField(TEXT("value"), Root->Value);
+    }
+
+    NodeObject->SetNumberField(TEXT("estimatedRows"), Root->EstimatedRows);
+    NodeObject->SetNumberField(TEXT("estimatedCost"), Root->EstimatedCost);
+    NodeObject->SetBoolField(TEXT("needsMemberData"), Root->bNeedsMemberData);
+
+    if (Root->Children.Num() > 0)
+    {
+        // Children are listed in execution order
+        TArray<TSharedPtr<FJsonValue>> ChildrenArray;
+        for (const TSharedPtr<FBlueprintQueryNode>& Child : Root->Children)
+        {
+            ChildrenArray.Add(MakeShareable(new FJsonValueObject(Explain(Child))));
+        }
+        NodeObject->SetArrayField(TEXT("children"), ChildrenArray);
+    }
+
+    return NodeObject;
+}
@@ -0,0 +1,397 @@
+#include "BlueprintAnalyzer/Public/BlueprintRankedIndex.h"
+#include "Algo/BinarySearch.h"
+
+namespace BlueprintRankedIndex
+{
+    /** BM25 term frequency saturation */
+    constexpr float K1 = 1.2f;
+
+    /** BM25 document length normalization */
+    constexpr float B = 0.75f;
+
+    /** Term frequency weight of each field, indexed by EBlueprintRankedField */
+    constexpr float FieldWeights[] = { 3.0f, 1.5f, 1.0f };
+
+    /**
+     * Number of typos tolerated for a query token; short tokens have to match exactly
+     * or they would match almost every term in the dictionary
+     */
+    int32 GetMaxEdits(int32 TokenLength)
+    {
+        if (TokenLength <= 2)
+        {
+            return 0;
+        }
+        return TokenLength <= 5 ? 1 : 2;
+    }
+}
+
+void FBlueprintRankedIndex::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+    OutTokens.Reset();
+
+    const int32 Length = Text.Len();
+    FString Current;
+
+    for (int32 i = 0; i < Length; ++i)
+    {
+        const TCHAR Char = Text[i];
+
+        if (!FChar::IsAlnum(Char))
+        {
+            // Separators such as '_', ' ', '/' and '.' end the current token
+            if (!Current.IsEmpty())
+            {
+                OutTokens.Add(MoveTemp(Current));
+                Current.Reset();
+            }
+            continue;
+        }
+
+        if (!Current.IsEmpty())
+        {
+            const TCHAR Previous = Text[i - 1];
+            const TCHAR Next = i + 1 < Length ? Text[i + 1] : TEXT('\0');
+
+            // Split "playerCharacter" before 'C', "HTTPServer" before 'S' and "Health2" before '2'
+            const bool bLowerToUpper = FChar::IsLower(Previous) && FChar::IsUpper(Char);
+            const bool bAcronymEnd = FChar::IsUpper(Previous) && FChar::IsUpper(Char) && FChar::IsLower(Next);
+            const bool bDigitBoundary = FChar::IsDigit(Previous) != FChar::IsDigit(Char);
+
+            if (bLowerToUpper || bAcronymEnd || bDigitBoundary)
+            {
+                OutTokens.Add(MoveTemp(Current));
+                Current.Reset();
+            }
+        }
+
+        Current.AppendChar(FChar::ToLower(Char));
+    }
+
+    if (!Current.IsEmpty())
+    {
+        OutTokens.Add(MoveTemp(Current));
+    }
+}
+
+void FBlueprintRankedIndex::AddDocument(int32 DocumentId, EBlueprintRankedField Field, TConstArrayView<FString> Texts)
+{
+    const float Weight = BlueprintRankedIndex::FieldWeights[static_cast<uint8>(Field)];
+
+    // Accumulate weighted term frequencies for this field
+    TMap<FString, float> TermFrequencies;
+    TArray<FString> Tokens;
+    for (const FString& Text : Texts)
+    {
+        Tokenize(Text, Tokens);
+        for (FString& Token : Tokens)
+        {
+            TermFrequencies.FindOrAdd(MoveTemp(Token)) += Weight;
+        }
+    }
+
+    if (TermFrequencies.Num() == 0)
+    {
+        return;
+    }
+
+    FDocumentInfo& Document = Documents.FindOrAdd(DocumentId);
+
+    for (const TPair<FString, float>& Term : TermFrequencies)
+    {
+        TArray<FPosting>* PostingList = Postings.Find(Term.Key);
+        if (!PostingList)
+        {
+            PostingList = &Postings.Add(Term.Key);
+            bSortedTermsDirty = true;
+        }
+
+        // Keep posting lists sorted by document id; a term seen in an earlier field adds up
+        const int32 InsertIndex = Algo::LowerBoundBy(*PostingList, DocumentId, &FPosting::DocumentId);
+        if (PostingList->IsValidIndex(InsertIndex) && (*PostingList)[InsertIndex].DocumentId == DocumentId)
+        {
+            (*PostingList)[InsertIndex].TermFrequency += Term.Value;
+        }
+        else
+        {
+            PostingList->Insert(FPosting{ DocumentId, Term.Value }, InsertIndex);
+            Document.Terms.Add(Term.Key);
+        }
+
+        Document.Length += Term.Value;
+        TotalLength += Term.Value;
+    }
+}
+
+void FBlueprintRankedIndex::RemoveDocument(int32 DocumentId)
+{
+    FDocumentInfo Document;
+    if (!Documents.RemoveAndCopyValue(DocumentId, Document))
+    {
+        return;
+    }
+
+    for (const FString& Term : Document.Terms)
+    {
+        TArray<FPosting>* PostingList = Postings.Find(Term);
+        if (!PostingList)
+        {
+            continue;
+        }
+
+        const int32 FoundIndex = Algo::BinarySearchBy(*PostingList, DocumentId, &FPosting::DocumentId);
+        if (FoundIndex != INDEX_NONE)
+        {
+            PostingList->RemoveAt(FoundIndex, 1, EAllowShrinking::No);
+        }
+
+        // Drop terms no document uses anymore so they stop matching typos
+        if (PostingList->Num() == 0)
+        {
+            Postings.Remove(Term);
+            bSortedTermsDirty = true;
+        }
+    }
+
+    TotalLength -= Document.Length;
+}
+
+void FBlueprintRankedIndex::Search(const FString& Query, int32 MaxResults, TArray<FBlueprintRankedHit>& OutHits, int32* OutTotalMatches) const
+{
+    OutHits.Reset();
+
+    if (OutTotalMatches)
+    {
+        *OutTotalMatches = 0;
+    }
+
+    if (MaxResults <= 0 || Documents.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FString> QueryTokens;
+    Tokenize(Query, QueryTokens);
+
+    const float DocumentCount = static_cast<float>(Documents.Num());
+    const float AverageLength = FMath::Max(TotalLength / DocumentCount, 1.0f);
+
+    // Sum the best match of every query token per document
+    TMap<int32, float> DocumentScores;
+    TMap<int32, float> TokenScores;
+    TArray<TPair<const FString*, int32>> MatchedTerms;
+
+    for (const FString& Token : QueryTokens)
+    {
+        FindTerms(Token, BlueprintRankedIndex::GetMaxEdits(Token.Len()), MatchedTerms);
+
+        TokenScores.Reset();
+        for (const TPair<const FString*, int32>& Match : MatchedTerms)
+        {
+            const TArray<FPosting>& PostingList = Postings.FindChecked(*Match.Key);
+
+            // Each typo halves the contribution so exact matches always rank first
+            const float DocumentFrequency = static_cast<float>(PostingList.Num());
+            const float InverseDocumentFrequency = FMath::Loge(1.0f + (DocumentCount - DocumentFrequency + 0.5f) / (DocumentFrequency + 0.5f));
+            const float TypoPenalty = 1.0f / static_cast<float>(1 << Match.Value);
+
+            for (const FPosting& Posting : PostingList)
+            {
+                const float DocumentLength = Documents.FindChecked(Posting.DocumentId).Length;
+                const float Normalization = BlueprintRankedIndex::K1 * (1.0f - BlueprintRankedIndex::B + BlueprintRankedIndex::B * DocumentLength / AverageLength);
+                const float TermScore = InverseDocumentFrequency * Posting.TermFrequency * (BlueprintRankedIndex::K1 + 1.0f) / (Posting.TermFrequency + Normalization);
+
+                float& BestScore = TokenScores.FindOrAdd(Posting.DocumentId);
+                BestScore = FMath::Max(BestScore, TermScore * TypoPenalty);
+            }
+        }
+
+        for (const TPair<int32, float>& TokenScore : TokenScores)
+        {
+            DocumentScores.FindOrAdd(TokenScore.Key) += TokenScore.Value;
+        }
+    }
+
+    if (OutTotalMatches)
+    {
+        *OutTotalMatches = DocumentScores.Num();
+    }
+
+    // Keep only the best MaxResults hits in a min-heap instead of sorting every match
+    auto IsWorse = [](const FBlueprintRankedHit& A, const FBlueprintRankedHit& B)
+    {
+        return A.Score < B.Score || (A.Score == B.Score && A.DocumentId > B.DocumentId);
+    };
+
+    OutHits.Reserve(FMath::Min(MaxResults + 1, DocumentScores.Num()));
+    for (const TPair<int32, float>& DocumentScore : DocumentScores)
+    {
+        const FBlueprintRankedHit Hit{ DocumentScore.Key, DocumentScore.Value };
+
+        if (OutHits.Num() < MaxResults)
+        {
+            OutHits.HeapPush(Hit, IsWorse);
+        }
+        else if (IsWorse(OutHits.HeapTop(), Hit))
+        {
+            OutHits.HeapPopDiscard(IsWorse, EAllowShrinking::No);
+            OutHits.HeapPush(Hit, IsWorse);
+        }
+    }
+
+    OutHits.Sort([&IsWorse](const FBlueprintRankedHit& A, const FBlueprintRankedHit& B)
+    {
+        return IsWorse(B, A);
+    });
+}
+
+void FBlueprintRankedIndex::Reset()
+{
+    Postings.Reset();
+    Documents.Reset();
+    SortedTerms.Reset();
+    TotalLength = 0.0f;
+    bSortedTermsDirty = false;
+}
+
+void FBlueprintRankedIndex::FindTerms(const FString& Token, int32 MaxEdits, TArray<TPair<const FString*, int32>>& OutMatches) const
+{
+    OutMatches.Reset();
+
+    if (Token.IsEmpty())
+    {
+        return;
+    }
+
+    // Without typo tolerance this is a plain lookup
+    if (MaxEdits == 0)
+    {
+        if (Postings.Contains(Token))
+        {
+            OutMatches.Emplace(&Token, 0);
+        }
+        return;
+    }
+
+    EnsureSortedTerms();
+
+    // Walk the sorted dictionary with a Levenshtein automaton: one DP row per term character.
+    // Rows only depend on the term prefix, so rows are reused across terms sharing a prefix,
+    // and a row whose minimum exceeds MaxEdits rules out every term with that prefix.
+    const TCHAR* TokenChars = *Token;
+    const int32 Columns = Token.Len() + 1;
+
+    TArray<int32> Rows;
+    Rows.SetNumUninitialized(Columns);
+    for (int32 Column = 0; Column < Columns; ++Column)
+    {
+        Rows[Column] = Column;
+    }
+
+    const FString* PreviousTerm = nullptr;
+    int32 ValidDepth = 0;
+    int32 TermIndex = 0;
+
+    while (TermIndex < SortedTerms.Num())
+    {
+        const FString& Term = SortedTerms[TermIndex];
+        const int32 TermLength = Term.Len();
+
+        // Rows up to the prefix shared with the previous term are still valid
+        int32 SharedDepth = 0;
+        if (PreviousTerm)
+        {
+            const int32 MaxShared = FMath::Min3(TermLength, PreviousTerm->Len(), ValidDepth);
+            while (SharedDepth < MaxShared && Term[SharedDepth] == (*PreviousTerm)[SharedDepth])
+            {
+                ++SharedDepth;
+            }
+        }
+
+        if (Rows.Num() < (TermLength + 1) * Columns)
+        {
+            Rows.SetNumUninitialized((TermLength + 1) * Columns, EAllowShrinking::No);
+        }
+
+        int32 PrunedDepth = INDEX_NONE;
+        for (int32 Depth = SharedDepth + 1; Depth <= TermLength; ++Depth)
+        {
+            const int32* PreviousRow = &Rows[(Depth - 1) * Columns];
+            int32* Row = &Rows[Depth * Columns];
+            const TCHAR TermChar = Term[Depth - 1];
+
+            Row[0] = Depth;
+            int32 RowMin = Row[0];
+            for (int32 Column = 1; Column < Columns; ++Column)
+            {
+                const int32 Substitution = PreviousRow[Column - 1] + (TokenChars[Column - 1] == TermChar ? 0 : 1);
+                Row[Column] = FMath::Min3(PreviousRow[Column] + 1, Row[Column - 1] + 1, Substitution);
+                RowMin = FMath::Min(RowMin, Row[Column]);
+            }
+
+            if (RowMin > MaxEdits)
+            {
+                PrunedDepth = Depth;
+                break;
+            }
+        }
+
+        PreviousTerm = &Term;
+
+        if (PrunedDepth != INDEX_NONE)
+        {
+            // Skip every following term that shares the dead prefix
+            ValidDepth = PrunedDepth;
+
+            int32 Low = TermIndex + 1;
+            int32 High = SortedTerms.Num();
+            while (Low < High)
+            {
+                const int32 Mid = Low + (High - Low) / 2;
+                if (FCString::Strncmp(*SortedTerms[Mid], *Term, PrunedDepth) == 0)
+                {
+                    Low = Mid + 1;
+                }
+                else
+                {
+                    High = Mid;
+                }
+            }
+
+            TermIndex = Low;
+            continue;
+        }
+
+        ValidDepth = TermLength;
+
+        const int32 Distance = Rows[TermLength * Columns + Columns - 1];
+        if (Distance <= MaxEdits)
+        {
+            OutMatches.Emplace(&Term, Distance);
+        }
+
+        ++TermIndex;
+    }
+}
+
+void FBlueprintRankedIndex::EnsureSortedTerms() const
+{
+    if (!bSortedTermsDirty)
+    {
+        return;
+    }
+
+    SortedTerms.Reset(Postings.Num());
+    for (const TPair<FString, TArray<FPosting>>& Posting : Postings)
+    {
+        SortedTerms.Add(Posting.Key);
+    }
+
+    // Ordinal order so terms sharing a prefix are contiguous for Strncmp-based skipping
+    SortedTerms.Sort([](const FString& A, const FString& B)
+    {
+        return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+    });
+
+    bSortedTermsDirty = false;
+}
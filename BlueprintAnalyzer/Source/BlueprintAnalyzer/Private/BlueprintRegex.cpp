@@ -0,0 +1,546 @@
+#include "BlueprintAnalyzer/Public/BlueprintRegex.h"
+#include "Internationalization/Regex.h"
+#include "HAL/IConsoleManager.h"
+
+// Initialize static members
+TLruCache<FString, TSharedPtr<const FRegexPattern>> FBlueprintRegex::PatternCache(FBlueprintRegex::MaxCachedPatterns);
+
+namespace BlueprintRegex
+{
+    /** Characters with a meaning of their own outside character classes */
+    bool IsMetaChar(TCHAR Char)
+    {
+        return FCString::Strchr(TEXT("\\^$.|?*+()[]{}"), Char) != nullptr;
+    }
+
+    /** Index after the run of at most MaxDigits digits (hexadecimal or octal) starting at Index */
+    int32 SkipDigits(const FString& Pattern, int32 Index, int32 MaxDigits, bool bHex)
+    {
+        for (int32 Count = 0; Count < MaxDigits && Index < Pattern.Len(); ++Count, ++Index)
+        {
+            const TCHAR Char = Pattern[Index];
+            if (bHex ? !FChar::IsHexDigit(Char) : (Char < TEXT('0') || Char > TEXT('7')))
+            {
+                break;
+            }
+        }
+        return Index;
+    }
+
+    /** Index after the character Close that ends a group opened at Index, or the pattern length if there is none */
+    int32 SkipDelimited(const FString& Pattern, int32 Index, TCHAR Close)
+    {
+        while (Index < Pattern.Len() && Pattern[Index] != Close)
+        {
+            ++Index;
+        }
+        return FMath::Min(Index + 1, Pattern.Len());
+    }
+
+    /**
+     * Find the end of the escape sequence starting with the backslash at Index, operands included:
+     * \xhh, \x{...}, \uhhhh, \Uhhhhhhhh, \0ooo, back references, \cX, \p{...}, \P{...}, \N{...}, \k<...>
+     * and a whole \Q...\E quote
+     * @return Index after the escape
+     */
+    int32 SkipEscape(const FString& Pattern, int32 Index)
+    {
+        if (Index + 1 >= Pattern.Len())
+        {
+            return Pattern.Len();
+        }
+
+        const int32 Operand = Index + 2;
+        const bool bBraced = Operand < Pattern.Len() && Pattern[Operand] == TEXT('{');
+
+        switch (Pattern[Index + 1])
+        {
+        case TEXT('Q'):
+        {
+            const int32 QuoteEnd = Pattern.Find(TEXT("\\E"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Operand);
+            return QuoteEnd == INDEX_NONE ? Pattern.Len() : QuoteEnd + 2;
+        }
+        case TEXT('x'):
+            return bBraced ? SkipDelimited(Pattern, Operand, TEXT('}')) : SkipDigits(Pattern, Operand, 2, true);
+        case TEXT('u'):
+            return SkipDigits(Pattern, Operand, 4, true);
+        case TEXT('U'):
+            return SkipDigits(Pattern, Operand, 8, true);
+        case TEXT('0'):
+            return SkipDigits(Pattern, Operand, 3, false);
+        case TEXT('p'):
+        case TEXT('P'):
+            return bBraced ? SkipDelimited(Pattern, Operand, TEXT('}')) : FMath::Min(Operand + 1, Pattern.Len());
+        case TEXT('N'):
+            return bBraced ? SkipDelimited(Pattern, Operand, TEXT('}')) : Operand;
+        case TEXT('k'):
+            return Operand < Pattern.Len() && Pattern[Operand] == TEXT('<') ? SkipDelimited(Pattern, Operand, TEXT('>')) : Operand;
+        case TEXT('c'):
+            return FMath::Min(Operand + 1, Pattern.Len());
+        default:
+            break;
+        }
+
+        // Back references take every following digit
+        int32 End = Operand;
+        if (FChar::IsDigit(Pattern[Index + 1]))
+        {
+            while (End < Pattern.Len() && FChar::IsDigit(Pattern[End]))
+            {
+                ++End;
+            }
+        }
+        return End;
+    }
+
+    /**
+     * Find the index of the ']' closing the character class that starts at Start
+     * @return Index of the closing bracket, or INDEX_NONE if the class is unterminated
+     */
+    int32 FindClassEnd(const FString& Pattern, int32 Start)
+    {
+        int32 Index = Start + 1;
+
+        // A ']' right after '[' or '[^' is a literal member of the class
+        if (Index < Pattern.Len() && Pattern[Index] == TEXT('^'))
+        {
+            ++Index;
+        }
+        if (Index < Pattern.Len() && Pattern[Index] == TEXT(']'))
+        {
+            ++Index;
+        }
+
+        for (; Index < Pattern.Len(); ++Index)
+        {
+            if (Pattern[Index] == TEXT('\\'))
+            {
+                Index = SkipEscape(Pattern, Index) - 1;
+            }
+            else if (Pattern[Index] == TEXT(']'))
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    /**
+     * Find the index of the ')' closing the group that starts at Start
+     * @return Index of the closing parenthesis, or INDEX_NONE if the group is unterminated
+     */
+    int32 FindGroupEnd(const FString& Pattern, int32 Start)
+    {
+        int32 Depth = 0;
+        for (int32 Index = Start; Index < Pattern.Len(); ++Index)
+        {
+            const TCHAR Char = Pattern[Index];
+            if (Char == TEXT('\\'))
+            {
+                Index = SkipEscape(Pattern, Index) - 1;
+            }
+            else if (Char == TEXT('['))
+            {
+                Index = FindClassEnd(Pattern, Index);
+                if (Index == INDEX_NONE)
+                {
+                    return INDEX_NONE;
+                }
+            }
+            else if (Char == TEXT('('))
+            {
+                ++Depth;
+            }
+            else if (Char == TEXT(')') && --Depth == 0)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    /** Whether the quantifier starting at Index (if any) allows zero repetitions */
+    bool IsOptionalQuantifier(const FString& Pattern, int32 Index)
+    {
+        if (Index >= Pattern.Len())
+        {
+            return false;
+        }
+
+        const TCHAR Char = Pattern[Index];
+        return Char == TEXT('?') || Char == TEXT('*') ||
+               (Char == TEXT('{') && Index + 1 < Pattern.Len() && Pattern[Index + 1] == TEXT('0'));
+    }
+
+    /**
+     * Split a slice of the pattern at its top-level '|'
+     * @return False if the slice contains anything but literal characters and escaped punctuation
+     */
+    bool SplitLiteralAlternatives(const FString& Pattern, int32 Start, int32 End, TArray<FString>& OutAlternatives)
+    {
+        OutAlternatives.Reset();
+
+        FString Current;
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            const TCHAR Char = Pattern[Index];
+            if (Char == TEXT('\\'))
+            {
+                // Escaped letters and digits are classes or anchors (\d, \w, \b), escaped punctuation is literal
+                if (Index + 1 >= End || FChar::IsAlnum(Pattern[Index + 1]))
+                {
+                    return false;
+                }
+                Current.AppendChar(Pattern[++Index]);
+            }
+            else if (Char == TEXT('|'))
+            {
+                OutAlternatives.Add(MoveTemp(Current));
+                Current.Reset();
+            }
+            else if (IsMetaChar(Char))
+            {
+                return false;
+            }
+            else
+            {
+                Current.AppendChar(Char);
+            }
+        }
+        OutAlternatives.Add(MoveTemp(Current));
+
+        // An empty alternative matches anywhere, so the group requires nothing
+        for (const FString& Alternative : OutAlternatives)
+        {
+            if (Alternative.IsEmpty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Single pass over the top level of a pattern, collecting runs of literal characters
+     */
+    class FLiteralScanner
+    {
+    public:
+        explicit FLiteralScanner(const FString& InPattern)
+            : Pattern(InPattern)
+        {
+        }
+
+        bool Scan(FBlueprintRegexLiterals& OutLiterals, FString& OutError)
+        {
+            Literals = &OutLiterals;
+
+            // Checked up front so the scan below can trust every bracket and parenthesis it meets
+            if (!Validate(OutError))
+            {
+                return false;
+            }
+
+            // With a top-level alternation no single literal is needed by every match
+            if (bTopLevelAlternation)
+            {
+                return true;
+            }
+
+            int32 Index = 0;
+            while (Index < Pattern.Len())
+            {
+                const TCHAR Char = Pattern[Index];
+
+                if (Char == TEXT('\\'))
+                {
+                    const TCHAR Escaped = Pattern[Index + 1];
+                    if (FChar::IsAlnum(Escaped))
+                    {
+                        // Classes, anchors, code points and quotes are one atom that is not literal text, operand included
+                        Flush();
+                        Index = SkipEscape(Pattern, Index);
+                    }
+                    else
+                    {
+                        Run.AppendChar(Escaped);
+                        bLastAtomInRun = true;
+                        Index += 2;
+                    }
+                    continue;
+                }
+
+                if (Char == TEXT('['))
+                {
+                    Flush();
+                    Index = FindClassEnd(Pattern, Index) + 1;
+                    continue;
+                }
+
+                if (Char == TEXT('('))
+                {
+                    Flush();
+                    const int32 GroupEnd = FindGroupEnd(Pattern, Index);
+                    if (!IsOptionalQuantifier(Pattern, GroupEnd + 1))
+                    {
+                        AddGroup(Index + 1, GroupEnd);
+                    }
+                    Index = GroupEnd + 1;
+                    continue;
+                }
+
+                if (Char == TEXT('?') || Char == TEXT('*') || Char == TEXT('+') || Char == TEXT('{'))
+                {
+                    Index = Quantify(Index);
+                    continue;
+                }
+
+                if (IsMetaChar(Char))
+                {
+                    // '.', '^', '$' and anything else that isn't a literal ends the run
+                    Flush();
+                    ++Index;
+                    continue;
+                }
+
+                Run.AppendChar(Char);
+                bLastAtomInRun = true;
+                ++Index;
+            }
+
+            Flush();
+            return true;
+        }
+
+    private:
+        bool Validate(FString& OutError)
+        {
+            int32 Depth = 0;
+            for (int32 Index = 0; Index < Pattern.Len(); ++Index)
+            {
+                const TCHAR Char = Pattern[Index];
+                if (Char == TEXT('\\'))
+                {
+                    if (Index + 1 >= Pattern.Len())
+                    {
+                        OutError = TEXT("Pattern ends with a lone backslash");
+                        return false;
+                    }
+                    // Parentheses and brackets inside \Q...\E or an escape's operand are not structure
+                    Index = SkipEscape(Pattern, Index) - 1;
+                }
+                else if (Char == TEXT('['))
+                {
+                    const int32 ClassEnd = FindClassEnd(Pattern, Index);
+                    if (ClassEnd == INDEX_NONE)
+                    {
+                        OutError = FString::Printf(TEXT("Missing ']' for the character class at position %d"), Index);
+                        return false;
+                    }
+                    Index = ClassEnd;
+                }
+                else if (Char == TEXT('('))
+                {
+                    ++Depth;
+                }
+                else if (Char == TEXT(')'))
+                {
+                    if (--Depth < 0)
+                    {
+                        OutError = FString::Printf(TEXT("Unmatched ')' at position %d"), Index);
+                        return false;
+                    }
+                }
+                else if (Char == TEXT('|') && Depth == 0)
+                {
+                    bTopLevelAlternation = true;
+                }
+            }
+
+            if (Depth > 0)
+            {
+                OutError = TEXT("Missing ')' at the end of the pattern");
+                return false;
+            }
+            return true;
+        }
+
+        /** Apply the quantifier at Index to the last atom and return the index after it */
+        int32 Quantify(int32 Index)
+        {
+            const TCHAR Char = Pattern[Index];
+
+            if (Char == TEXT('{'))
+            {
+                const int32 Close = Pattern.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index);
+                if (Close == INDEX_NONE || Index + 1 >= Pattern.Len() || !FChar::IsDigit(Pattern[Index + 1]))
+                {
+                    // Not a repetition count, just a literal brace
+                    Run.AppendChar(Char);
+                    bLastAtomInRun = true;
+                    return Index + 1;
+                }
+
+                DropLastAtomIf(Pattern[Index + 1] == TEXT('0'));
+                return SkipLazySuffix(Close + 1);
+            }
+
+            DropLastAtomIf(Char != TEXT('+'));
+            return SkipLazySuffix(Index + 1);
+        }
+
+        /** The last atom may repeat or vanish, so the run ends before it (optional) or after it (repeated) */
+        void DropLastAtomIf(bool bOptional)
+        {
+            if (bOptional && bLastAtomInRun && Run.Len() > 0)
+            {
+                Run.LeftChopInline(1, EAllowShrinking::No);
+            }
+            Flush();
+        }
+
+        /** A quantifier followed by '?' or '+' is only made lazy or possessive */
+        int32 SkipLazySuffix(int32 Index)
+        {
+            if (Index < Pattern.Len() && (Pattern[Index] == TEXT('?') || Pattern[Index] == TEXT('+')))
+            {
+                ++Index;
+            }
+            return Index;
+        }
+
+        /** Add a required group whose alternatives are all plain literals */
+        void AddGroup(int32 Start, int32 End)
+        {
+            // Only plain and non-capturing groups; lookarounds and inline flags need no text of their own
+            if (Start < End && Pattern[Start] == TEXT('?'))
+            {
+                if (Start + 1 < End && Pattern[Start + 1] == TEXT(':'))
+                {
+                    Start += 2;
+                }
+                else
+                {
+                    return;
+                }
+            }
+
+            TArray<FString> Alternatives;
+            if (SplitLiteralAlternatives(Pattern, Start, End, Alternatives))
+            {
+                Literals->Required.Add(MoveTemp(Alternatives));
+            }
+        }
+
+        void Flush()
+        {
+            if (Run.Len() > 0)
+            {
+                Literals->Required.Add({ Run });
+                Run.Reset();
+            }
+            bLastAtomInRun = false;
+        }
+
+        const FString& Pattern;
+        FBlueprintRegexLiterals* Literals = nullptr;
+        FString Run;
+        bool bLastAtomInRun = false;
+        bool bTopLevelAlternation = false;
+    };
+
+    /**
+     * Check that the literal prefilter keeps the intended match of escape-heavy patterns:
+     * every pattern must match its target, and every required literal must occur in it.
+     * Usage: BlueprintAnalyzer.CheckRegexLiterals
+     */
+    void CheckRegexLiterals(const TArray<FString>& Args)
+    {
+        struct FRegexCase
+        {
+            const TCHAR* Pattern;
+            const TCHAR* Target;
+        };
+
+        static const FRegexCase Cases[] = {
+            { TEXT("BP_\\x41ctor"), TEXT("BP_Actor") },
+            { TEXT("\\x{41}nim"), TEXT("Anim") },
+            { TEXT("\\u0041BC"), TEXT("ABC") },
+            { TEXT("\\U00000041nim"), TEXT("Anim") },
+            { TEXT("\\p{L}+_Enemy"), TEXT("BP_Enemy") },
+            { TEXT("\\P{L}Enemy"), TEXT("_Enemy") },
+            { TEXT("\\cAX"), TEXT("\x01X") },
+            { TEXT("\\N{LATIN CAPITAL LETTER A}bc"), TEXT("Abc") },
+            { TEXT("\\0101ctor"), TEXT("Actor") },
+            { TEXT("\\Q(a)\\E_BP"), TEXT("(a)_BP") },
+            { TEXT("(\\Q)\\E)_BP"), TEXT(")_BP") }
+        };
+
+        int32 Failures = 0;
+        for (const FRegexCase& Case : Cases)
+        {
+            FBlueprintRegexLiterals Literals;
+            FString Error;
+            if (!FBlueprintRegex::ExtractLiterals(Case.Pattern, Literals, Error))
+            {
+                ++Failures;
+                UE_LOG(LogTemp, Error, TEXT("%s is rejected: %s"), Case.Pattern, *Error);
+                continue;
+            }
+
+            FRegexMatcher Matcher(*FBlueprintRegex::FindOrCompile(Case.Pattern), Case.Target);
+            if (!Matcher.FindNext())
+            {
+                ++Failures;
+                UE_LOG(LogTemp, Error, TEXT("%s does not match %s"), Case.Pattern, Case.Target);
+            }
+
+            for (const TArray<FString>& Alternatives : Literals.Required)
+            {
+                const bool bFound = Alternatives.ContainsByPredicate([&Case](const FString& Literal)
+                {
+                    return FCString::Stristr(Case.Target, *Literal) != nullptr;
+                });
+                if (!bFound)
+                {
+                    ++Failures;
+                    UE_LOG(LogTemp, Error, TEXT("%s requires '%s', which %s does not contain"),
+                        Case.Pattern, *FString::Join(Alternatives, TEXT("|")), Case.Target);
+                }
+            }
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Regex literal prefilter over %d patterns: %d failures"), static_cast<int32>(UE_ARRAY_COUNT(Cases)), Failures);
+    }
+
+    FAutoConsoleCommand CheckRegexLiteralsCommand(
+        TEXT("BlueprintAnalyzer.CheckRegexLiterals"),
+        TEXT("Check that the regex literal prefilter keeps the intended match of escape-heavy patterns. Usage: BlueprintAnalyzer.CheckRegexLiterals"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CheckRegexLiterals));
+}
+
+TSharedRef<const FRegexPattern> FBlueprintRegex::FindOrCompile(const FString& Pattern)
+{
+    if (const TSharedPtr<const FRegexPattern>* Cached = PatternCache.FindAndTouch(Pattern))
+    {
+        return Cached->ToSharedRef();
+    }
+
+    // Case-insensitive like every other search mode
+    TSharedRef<const FRegexPattern> Compiled = MakeShared<const FRegexPattern>(Pattern, ERegexPatternFlags::CaseInsensitive);
+    PatternCache.Add(Pattern, Compiled);
+    return Compiled;
+}
+
+bool FBlueprintRegex::ExtractLiterals(const FString& Pattern, FBlueprintRegexLiterals& OutLiterals, FString& OutError)
+{
+    OutLiterals.Required.Reset();
+
+    BlueprintRegex::FLiteralScanner Scanner(Pattern);
+    return Scanner.Scan(OutLiterals, OutError);
+}
+
+void FBlueprintRegex::Reset()
+{
+    PatternCache.Empty(MaxCachedPatterns);
+}
@@ -0,0 +1,146 @@
+#include "BlueprintAnalyzer/Public/BlueprintResponseCompression.h"
+#include "Misc/Compression.h"
+#include "Misc/ScopeLock.h"
+
+// Initialize static members
+FCriticalSection FBlueprintResponseCompression::StatsLock;
+FBlueprintCompressionStats FBlueprintResponseCompression::Stats;
+
+namespace BlueprintResponseCompression
+{
+    /** Room for the gzip header and trailer on top of the zlib bound */
+    constexpr int32 GzipOverhead = 32;
+
+    /** Engine compression format of an encoding */
+    FName GetFormatName(EBlueprintContentEncoding Encoding)
+    {
+        return Encoding == EBlueprintContentEncoding::Gzip ? NAME_Gzip : NAME_Zlib;
+    }
+}
+
+EBlueprintContentEncoding FBlueprintResponseCompression::NegotiateEncoding(FStringView AcceptEncoding)
+{
+    EBlueprintContentEncoding BestEncoding = EBlueprintContentEncoding::Identity;
+    float BestQuality = 0.0f;
+
+    TArray<FString> Codings;
+    FString(AcceptEncoding).ParseIntoArray(Codings, TEXT(","), true);
+
+    for (const FString& Coding : Codings)
+    {
+        TArray<FString> Parts;
+        Coding.ParseIntoArray(Parts, TEXT(";"), true);
+        if (Parts.Num() == 0)
+        {
+            continue;
+        }
+
+        const FString Name = Parts[0].TrimStartAndEnd();
+        EBlueprintContentEncoding Encoding;
+        if (Name.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase) || Name == TEXT("*"))
+        {
+            Encoding = EBlueprintContentEncoding::Gzip;
+        }
+        else if (Name.Equals(TEXT("deflate"), ESearchCase::IgnoreCase))
+        {
+            Encoding = EBlueprintContentEncoding::Deflate;
+        }
+        else
+        {
+            continue;
+        }
+
+        float Quality = 1.0f;
+        for (int32 Index = 1; Index < Parts.Num(); ++Index)
+        {
+            const FString Parameter = Parts[Index].TrimStartAndEnd();
+            if (Parameter.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+            {
+                Quality = FCString::Atof(*Parameter + 2);
+            }
+        }
+
+        if (Quality > BestQuality || (Quality == BestQuality && Quality > 0.0f && Encoding == EBlueprintContentEncoding::Gzip))
+        {
+            BestEncoding = Encoding;
+            BestQuality = Quality;
+        }
+    }
+
+    return BestEncoding;
+}
+
+const TCHAR* FBlueprintResponseCompression::GetEncodingName(EBlueprintContentEncoding Encoding)
+{
+    switch (Encoding)
+    {
+    case EBlueprintContentEncoding::Gzip:
+        return TEXT("gzip");
+    case EBlueprintContentEncoding::Deflate:
+        return TEXT("deflate");
+    default:
+        return TEXT("identity");
+    }
+}
+
+bool FBlueprintResponseCompression::ShouldCompress(int32 BodySize)
+{
+    return BodySize >= MinCompressBytes;
+}
+
+bool FBlueprintResponseCompression::Compress(TArray<uint8>& InOutBody, EBlueprintContentEncoding Encoding)
+{
+    if (Encoding == EBlueprintContentEncoding::Identity || InOutBody.Num() == 0)
+    {
+        return false;
+    }
+
+    const FName FormatName = BlueprintResponseCompression::GetFormatName(Encoding);
+    int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, InOutBody.Num()) + BlueprintResponseCompression::GzipOverhead;
+
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(FormatName, Compressed.GetData(), CompressedSize, InOutBody.GetData(), InOutBody.Num()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to %s compress a %d byte response, sending it uncompressed"), GetEncodingName(Encoding), InOutBody.Num());
+        return false;
+    }
+
+    if (CompressedSize >= InOutBody.Num())
+    {
+        return false;
+    }
+
+    Compressed.SetNum(CompressedSize, EAllowShrinking::No);
+    InOutBody = MoveTemp(Compressed);
+    return true;
+}
+
+void FBlueprintResponseCompression::RecordResponse(int64 RawBytes, int64 SentBytes, bool bCompressed, double CompressSeconds)
+{
+    FScopeLock Lock(&StatsLock);
+
+    ++Stats.Responses;
+    Stats.RawBytes += RawBytes;
+    Stats.SentBytes += SentBytes;
+    Stats.CompressSeconds += CompressSeconds;
+
+    if (bCompressed)
+    {
+        ++Stats.CompressedResponses;
+        Stats.CompressedRawBytes += RawBytes;
+        Stats.CompressedBytes += SentBytes;
+    }
+}
+
+FBlueprintCompressionStats FBlueprintResponseCompression::GetStats()
+{
+    FScopeLock Lock(&StatsLock);
+    return Stats;
+}
+
+void FBlueprintResponseCompression::Reset()
+{
+    FScopeLock Lock(&StatsLock);
+    Stats = FBlueprintCompressionStats();
+}
@@ -0,0 +1,116 @@
+#include "BlueprintAnalyzer/Public/BlueprintResultCache.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+
+// Initialize static members
+TLruCache<FString, FBlueprintResultCache::FCachedResponse> FBlueprintResultCache::Responses(FBlueprintResultCache::MaxEntries);
+uint64 FBlueprintResultCache::Generation = 0;
+int64 FBlueprintResultCache::Hits = 0;
+int64 FBlueprintResultCache::Misses = 0;
+int64 FBlueprintResultCache::Invalidations = 0;
+
+FString FBlueprintResultCache::MakeKey(const FString& Route, const TMap<FString, FString>& QueryParams, const TMap<FString, FString>& Defaults)
+{
+    TArray<FString> Parts;
+    Parts.Reserve(QueryParams.Num());
+
+    for (const TPair<FString, FString>& Param : QueryParams)
+    {
+        const FString Value = Param.Value.TrimStartAndEnd();
+        const FString* Default = Defaults.Find(Param.Key);
+        if (Value.IsEmpty() || (Default && *Default == Value))
+        {
+            continue;
+        }
+
+        Parts.Add(Param.Key + TEXT("=") + Value);
+    }
+
+    // Parameter order in the URL doesn't change the result
+    Parts.Sort();
+
+    return Route + TEXT("?") + FString::Join(Parts, TEXT("&"));
+}
+
+TSharedPtr<const TArray<uint8>> FBlueprintResultCache::Find(const FString& Key)
+{
+    SyncGeneration();
+
+    if (const FCachedResponse* Cached = Responses.FindAndTouch(Key))
+    {
+        // Edits that haven't been saved yet don't move the generation, but the searches see them
+        if (!HasUnsavedChanges(Cached->SourcePaths))
+        {
+            ++Hits;
+            return Cached->Bytes;
+        }
+        Responses.Remove(Key);
+    }
+
+    ++Misses;
+    return nullptr;
+}
+
+void FBlueprintResultCache::Add(const FString& Key, const TArray<uint8>& Response, const TArray<FString>& SourcePaths)
+{
+    // An asset may have changed while the search ran
+    SyncGeneration();
+
+    if (Response.Num() <= MaxResponseLength && !HasUnsavedChanges(SourcePaths))
+    {
+        FCachedResponse Cached;
+        Cached.Bytes = MakeShared<const TArray<uint8>>(Response);
+        Cached.SourcePaths = SourcePaths;
+        Responses.Add(Key, Cached);
+    }
+}
+
+bool FBlueprintResultCache::HasUnsavedChanges(const TArray<FString>& SourcePaths)
+{
+    for (const FString& Path : SourcePaths)
+    {
+        if (FBlueprintCatalog::HasUnsavedChanges(Path))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+FBlueprintResultCacheStats FBlueprintResultCache::GetStats()
+{
+    SyncGeneration();
+
+    FBlueprintResultCacheStats Stats;
+    Stats.Hits = Hits;
+    Stats.Misses = Misses;
+    Stats.Invalidations = Invalidations;
+    Stats.NumEntries = Responses.Num();
+    Stats.Capacity = MaxEntries;
+    Stats.Generation = Generation;
+    return Stats;
+}
+
+void FBlueprintResultCache::Reset()
+{
+    Responses.Empty(MaxEntries);
+    Generation = 0;
+    Hits = 0;
+    Misses = 0;
+    Invalidations = 0;
+}
+
+void FBlueprintResultCache::SyncGeneration()
+{
+    const uint64 CurrentGeneration = FBlueprintCatalog::GetGeneration();
+    if (CurrentGeneration == Generation)
+    {
+        return;
+    }
+
+    if (Responses.Num() > 0)
+    {
+        Responses.Empty(MaxEntries);
+        ++Invalidations;
+    }
+    Generation = CurrentGeneration;
+}
@@ -1,336 +1,750 @@
 #include "BlueprintAnalyzer/Public/BlueprintSearcher.h"
 #include "BlueprintAnalyzer/Public/BlueprintData.h"
 #include "BlueprintAnalyzer/Public/BlueprintDataExtractor.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+#include "BlueprintAnalyzer/Public/BlueprintQuery.h"
+#include "Engine/Blueprint.h"
+#include "Internationalization/Regex.h"
+#include "Algo/AllOf.h"
+#include "Algo/Unique.h"
 
-TArray<FBlueprintData> FBlueprintSearcher::SearchByName(const FString& NameQuery, EBlueprintDetailLevel DetailLevel)
+namespace BlueprintSearcher
 {
-    TArray<FBlueprintData> Results;
-    
-    // Get all blueprints first with basic detail level for efficiency
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetailLevel::Basic);
-    
-    // Filter by name
-    for (const FBlueprintData& Blueprint : AllBlueprints)
+    /** Number of blueprints loaded per batch when a search may stop early */
+    constexpr int32 ScanChunkSize = 64;
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByName(const FString& NameQuery, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Find matching blueprints in the catalog's trigram index
+    TArray<int32> EntryIds;
+    FBlueprintCatalog::FindSubstring(EBlueprintSearchField::Name, NameQuery, EntryIds);
+
+    // Upgrade only the requested page to the requested detail level
+    return MakePage(EntryIds, EntryIds.Num(), true, DetailLevel, Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByParentClass(const FString& ParentClassName, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Find matching blueprints in the catalog's trigram index
+    TArray<int32> EntryIds;
+    FBlueprintCatalog::FindSubstring(EBlueprintSearchField::ParentClass, ParentClassName, EntryIds);
+
+    // Upgrade only the requested page to the requested detail level
+    return MakePage(EntryIds, EntryIds.Num(), true, DetailLevel, Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByFunction(const FString& FunctionName, const TArray<FString>& ParamTypes, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // For function searches, we need at least medium detail level to access function information.
+    // The catalog only extracts it once per blueprint and keeps it current on save.
+    auto Matches = [&FunctionName, &ParamTypes](const FBlueprintCatalogEntry& Entry)
+    {
+        for (const FBlueprintFunctionData& Function : Entry.Data.Functions)
+        {
+            if (!Function.Name.Contains(FunctionName, ESearchCase::IgnoreCase))
+            {
+                continue;
+            }
+
+            // If no parameter types specified, just match by name
+            if (ParamTypes.Num() == 0)
+            {
+                return true;
+            }
+
+            // If parameter types are specified, check those too on the inputs of the function that matched by name
+            int32 ParamIndex = 0;
+            for (const FBlueprintParamData& Param : Function.Params)
+            {
+                if (ParamIndex == ParamTypes.Num())
+                {
+                    break;
+                }
+
+                if (Param.IsOutput)
+                {
+                    continue;
+                }
+
+                // Check the full type ("Actor") as well as the pin category ("object")
+                if (!Param.FullType.Contains(ParamTypes[ParamIndex], ESearchCase::IgnoreCase) &&
+                    !Param.Type.Contains(ParamTypes[ParamIndex], ESearchCase::IgnoreCase))
+                {
+                    break;
+                }
+
+                ++ParamIndex;
+            }
+
+            if (ParamIndex == ParamTypes.Num())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    TArray<int32> EntryIds;
+    int32 TotalCount = 0;
+    bool bTotalCountExact = true;
+    MatchMembers(EBlueprintSearchField::Function, FunctionName, Matches, Options, EntryIds, TotalCount, bTotalCountExact);
+
+    // Member searches always return at least medium detail, which the catalog already holds
+    return MakePage(EntryIds, TotalCount, bTotalCountExact, FMath::Max(DetailLevel, EBlueprintDetailLevel::Medium), Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchBySignature(const FBlueprintSignatureQuery& Query, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Signatures come from member data, which the catalog extracts once per blueprint
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+    FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+    TArray<FBlueprintSignatureMatch> Matches;
+    FBlueprintCatalog::FindSignature(Query, Matches);
+
+    // Matches are sorted by entry, so functions of the same blueprint are adjacent
+    TArray<int32> EntryIds;
+    TMap<int32, TArray<FString>> MatchedFunctions;
+    for (const FBlueprintSignatureMatch& Match : Matches)
     {
-        if (Blueprint.Name.Contains(NameQuery, ESearchCase::IgnoreCase))
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(Match.DocumentId);
+        if (!Entry || !Entry->Data.Functions.IsValidIndex(Match.FunctionIndex))
+        {
+            continue;
+        }
+
+        if (EntryIds.Num() == 0 || EntryIds.Last() != Match.DocumentId)
         {
-            Results.Add(Blueprint);
+            EntryIds.Add(Match.DocumentId);
         }
+        MatchedFunctions.FindOrAdd(Match.DocumentId).Add(Entry->Data.Functions[Match.FunctionIndex].Name);
     }
-    
-    // If a higher detail level is requested and we have results, get more detailed information
-    if (DetailLevel != EBlueprintDetailLevel::Basic && Results.Num() > 0)
+
+    // Hydrate the page and tell the caller which functions matched in each blueprint
+    FBlueprintSearchResult Result = MakePage(EntryIds, EntryIds.Num(), true, FMath::Max(DetailLevel, EBlueprintDetailLevel::Medium), Options);
+    for (FBlueprintData& Blueprint : Result.Blueprints)
+    {
+        const int32 EntryId = FBlueprintCatalog::FindEntryId(Blueprint.Path);
+        if (const TArray<FString>* FunctionNames = MatchedFunctions.Find(EntryId))
+        {
+            Blueprint.Metadata.Add(TEXT("MatchedFunctions"), FString::Join(*FunctionNames, TEXT(",")));
+        }
+    }
+
+    return Result;
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByVariable(const FString& VariableName, const FString& VariableType, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // For variable searches, we need at least medium detail level to access variable information.
+    // If variable type is specified, the same variable has to match both name and type.
+    auto Matches = [&VariableName, &VariableType](const FBlueprintCatalogEntry& Entry)
     {
-        for (int32 i = 0; i < Results.Num(); ++i)
+        for (const FBlueprintVariableData& Variable : Entry.Data.Variables)
         {
-            // Use the path to fetch more detailed information
-            TOptional<FBlueprintData> DetailedData = FBlueprintDataExtractor::GetBlueprintByPath(Results[i].Path, DetailLevel);
-            if (DetailedData.IsSet())
+            if (Variable.Name.Contains(VariableName, ESearchCase::IgnoreCase) &&
+                (VariableType.IsEmpty() || Variable.Type.Contains(VariableType, ESearchCase::IgnoreCase)))
             {
-                Results[i] = DetailedData.GetValue();
+                return true;
             }
         }
+
+        return false;
+    };
+
+    TArray<int32> EntryIds;
+    int32 TotalCount = 0;
+    bool bTotalCountExact = true;
+    MatchMembers(EBlueprintSearchField::Variable, VariableName, Matches, Options, EntryIds, TotalCount, bTotalCountExact);
+
+    // Member searches always return at least medium detail, which the catalog already holds
+    return MakePage(EntryIds, TotalCount, bTotalCountExact, FMath::Max(DetailLevel, EBlueprintDetailLevel::Medium), Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchWithParameters(const TMap<FString, FString>& SearchParams, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Build an AND query from the supported parameters and let the planner order them
+    TSharedPtr<FBlueprintQueryNode> Query = MakeShareable(new FBlueprintQueryNode);
+    Query->Op = EBlueprintQueryOp::And;
+
+    for (const TPair<FString, FString>& Param : SearchParams)
+    {
+        const FString& Key = Param.Key;
+        EBlueprintQueryField Field;
+
+        if (Key.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+        {
+            Field = EBlueprintQueryField::Name;
+        }
+        else if (Key.Equals(TEXT("ParentClass"), ESearchCase::IgnoreCase))
+        {
+            Field = EBlueprintQueryField::ParentClass;
+        }
+        else if (Key.Equals(TEXT("Function"), ESearchCase::IgnoreCase))
+        {
+            Field = EBlueprintQueryField::Function;
+        }
+        else if (Key.Equals(TEXT("Variable"), ESearchCase::IgnoreCase))
+        {
+            Field = EBlueprintQueryField::Variable;
+        }
+        else if (Key.Equals(TEXT("Path"), ESearchCase::IgnoreCase))
+        {
+            Field = EBlueprintQueryField::Path;
+        }
+        else
+        {
+            continue;
+        }
+
+        TSharedPtr<FBlueprintQueryNode> Predicate = MakeShareable(new FBlueprintQueryNode);
+        Predicate->Op = EBlueprintQueryOp::Predicate;
+        Predicate->Field = Field;
+        Predicate->Value = Param.Value;
+        Query->Children.Add(Predicate);
+    }
+
+    FBlueprintQuery::Plan(Query);
+
+    // Function and variable results have always included medium detail
+    const EBlueprintDetailLevel SearchLevel = Query->bNeedsMemberData ? EBlueprintDetailLevel::Medium : EBlueprintDetailLevel::Basic;
+    return SearchByQuery(Query, FMath::Max(DetailLevel, SearchLevel), Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByQuery(const TSharedPtr<FBlueprintQueryNode>& Query, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // The planner already defers member predicates to the survivors of cheaper ones,
+    // so the count stays exact and only the page gets hydrated
+    TArray<int32> EntryIds;
+    FBlueprintQuery::Execute(Query, EntryIds);
+
+    return MakePage(EntryIds, EntryIds.Num(), true, DetailLevel, Options);
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchRanked(const FString& Query, EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Ranking covers function and variable names, so make sure member data is available
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+    FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+    // Only the hits up to the end of the requested page are ever ranked and materialized;
+    // without a limit the page is DefaultRankedResults long, starting at the offset like any other
+    const int32 Offset = FMath::Max(Options.Offset, 0);
+    const int32 MaxResults = Offset + (Options.Limit > 0 ? Options.Limit : DefaultRankedResults);
+
+    TArray<FBlueprintRankedHit> Hits;
+    int32 TotalMatches = 0;
+    FBlueprintCatalog::RankedSearch(Query, MaxResults, Hits, &TotalMatches);
+
+    TArray<int32> EntryIds;
+    EntryIds.Reserve(Hits.Num());
+    for (int32 i = Offset; i < Hits.Num(); ++i)
+    {
+        EntryIds.Add(Hits[i].DocumentId);
     }
-    
+
+    FBlueprintSearchResult Result;
+    Result.Blueprints = HydrateResults(EntryIds, DetailLevel);
+    // Every match is scored to rank the top hits, so the total is exact whatever bExactCount asks for
+    Result.TotalCount = TotalMatches;
+    Result.bTotalCountExact = true;
+
+    // Hits and results are in the same order
+    for (int32 i = 0; i < Result.Blueprints.Num() && Offset + i < Hits.Num(); ++i)
+    {
+        Result.Blueprints[i].Metadata.Add(TEXT("Score"), FString::SanitizeFloat(Hits[Offset + i].Score));
+    }
+
+    return Result;
+}
+
+TArray<FBlueprintGraphTextMatch> FBlueprintSearcher::SearchGraphText(const FString& Query)
+{
+    // Graph texts are collected together with member data
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+    FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+    TArray<int32> GraphTextIds;
+    FBlueprintCatalog::FindGraphText(Query, GraphTextIds);
+
+    TArray<FBlueprintGraphTextMatch> Results;
+    Results.Reserve(GraphTextIds.Num());
+
+    for (int32 GraphTextId : GraphTextIds)
+    {
+        const FBlueprintGraphText* GraphText = FBlueprintCatalog::GetGraphText(GraphTextId);
+        const FBlueprintCatalogEntry* Entry = GraphText ? FBlueprintCatalog::GetEntry(GraphText->EntryId) : nullptr;
+        if (!Entry)
+        {
+            continue;
+        }
+
+        FBlueprintGraphTextMatch& Match = Results.AddDefaulted_GetRef();
+        Match.BlueprintName = Entry->Data.Name;
+        Match.BlueprintPath = Entry->Data.Path;
+        Match.GraphName = GraphText->GraphName;
+        Match.NodeId = GraphText->NodeId;
+        Match.NodeTitle = GraphText->NodeTitle;
+        Match.PinName = GraphText->PinName;
+        Match.Text = GraphText->Text;
+
+        switch (GraphText->Field)
+        {
+        case EBlueprintGraphTextField::NodeTitle:
+            Match.Field = TEXT("title");
+            break;
+        case EBlueprintGraphTextField::NodeComment:
+            Match.Field = TEXT("comment");
+            break;
+        case EBlueprintGraphTextField::CommentBox:
+            Match.Field = TEXT("commentBox");
+            break;
+        case EBlueprintGraphTextField::PinDefaultValue:
+            Match.Field = TEXT("pinDefaultValue");
+            break;
+        }
+    }
+
+    // Keep matches from the same blueprint together so pages are stable and readable
+    Results.StableSort([](const FBlueprintGraphTextMatch& A, const FBlueprintGraphTextMatch& B)
+    {
+        return A.BlueprintPath < B.BlueprintPath;
+    });
+
     return Results;
 }
 
-TArray<FBlueprintData> FBlueprintSearcher::SearchByParentClass(const FString& ParentClassName, EBlueprintDetailLevel DetailLevel)
+void FBlueprintSearcher::MatchMembers(EBlueprintSearchField Field, const FString& Needle, TFunctionRef<bool(const FBlueprintCatalogEntry&)> Predicate,
+                                      const FBlueprintSearchOptions& Options, TArray<int32>& OutEntryIds, int32& OutTotalCount, bool& bOutExact)
 {
-    TArray<FBlueprintData> Results;
-    
-    // Get all blueprints first with basic detail level for efficiency
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetailLevel::Basic);
-    
-    // Filter by parent class
-    for (const FBlueprintData& Blueprint : AllBlueprints)
+    OutEntryIds.Reset();
+    OutTotalCount = 0;
+    bOutExact = true;
+
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+
+    if (Options.bExactCount || Options.Limit <= 0)
     {
-        if (Blueprint.ParentClass.Contains(ParentClassName, ESearchCase::IgnoreCase))
+        // An exact count needs member data for every blueprint; after that the trigram index narrows the candidates
+        FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+        TArray<int32> CandidateIds;
+        FBlueprintCatalog::FindSubstring(Field, Needle, CandidateIds);
+
+        for (int32 EntryId : CandidateIds)
         {
-            Results.Add(Blueprint);
+            const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+            if (Entry && Predicate(*Entry))
+            {
+                OutEntryIds.Add(EntryId);
+            }
         }
+
+        OutTotalCount = OutEntryIds.Num();
+        return;
     }
-    
-    // If a higher detail level is requested and we have results, get more detailed information
-    if (DetailLevel != EBlueprintDetailLevel::Basic && Results.Num() > 0)
+
+    // Otherwise load blueprints a chunk at a time and stop as soon as the page is filled
+    const int32 NeededMatches = FMath::Max(Options.Offset, 0) + Options.Limit;
+    int32 ScannedCount = 0;
+
+    while (ScannedCount < AllEntryIds.Num() && OutEntryIds.Num() < NeededMatches)
     {
-        for (int32 i = 0; i < Results.Num(); ++i)
+        const int32 ChunkSize = FMath::Min(BlueprintSearcher::ScanChunkSize, AllEntryIds.Num() - ScannedCount);
+        const TConstArrayView<int32> Chunk(AllEntryIds.GetData() + ScannedCount, ChunkSize);
+        FBlueprintCatalog::EnsureMemberData(Chunk);
+
+        for (int32 EntryId : Chunk)
         {
-            // Use the path to fetch more detailed information
-            TOptional<FBlueprintData> DetailedData = FBlueprintDataExtractor::GetBlueprintByPath(Results[i].Path, DetailLevel);
-            if (DetailedData.IsSet())
+            const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+            if (Entry && Predicate(*Entry))
             {
-                Results[i] = DetailedData.GetValue();
+                OutEntryIds.Add(EntryId);
             }
         }
+
+        ScannedCount += ChunkSize;
     }
-    
-    return Results;
+
+    if (ScannedCount >= AllEntryIds.Num())
+    {
+        OutTotalCount = OutEntryIds.Num();
+        return;
+    }
+
+    // Extrapolate the match rate of the scanned blueprints to the whole catalog
+    OutTotalCount = FMath::Max(OutEntryIds.Num(), FMath::CeilToInt(static_cast<double>(OutEntryIds.Num()) * AllEntryIds.Num() / ScannedCount));
+    bOutExact = false;
 }
 
-TArray<FBlueprintData> FBlueprintSearcher::SearchByFunction(const FString& FunctionName, const TArray<FString>& ParamTypes, EBlueprintDetailLevel DetailLevel)
+TArray<FBlueprintPatternMatch> FBlueprintSearcher::SearchGraphPattern(const FBlueprintGraphPattern& Pattern, int32 MaxMatches)
 {
-    TArray<FBlueprintData> Results;
-    
-    // For function searches, we need at least medium detail level to access function information
-    // We'll use medium detail even for basic searches, then enhance if full detail is requested
-    EBlueprintDetailLevel SearchLevel = EBlueprintDetailLevel::Medium;
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(SearchLevel);
-    
-    // Filter by function name and optionally parameter types
-    for (const FBlueprintData& Blueprint : AllBlueprints)
+    // Graph summaries are collected together with member data
+    TArray<int32> CandidateIds;
+    FBlueprintCatalog::GetAllEntryIds(CandidateIds);
+    FBlueprintCatalog::EnsureMemberData(CandidateIds);
+
+    // Only blueprints that contain every node class named in the pattern can match
+    TArray<int32> PostingList;
+    TArray<int32> Intersection;
+    for (const FBlueprintPatternStep& Step : Pattern.Steps)
     {
-        bool bFoundMatch = false;
-        
-        for (const FBlueprintFunctionData& Function : Blueprint.Functions)
+        if (Step.NodeClass.IsEmpty())
         {
-            if (Function.Name.Contains(FunctionName, ESearchCase::IgnoreCase))
+            continue;
+        }
+
+        FBlueprintCatalog::FindEntriesWithNodeClass(Step.NodeClass, PostingList);
+
+        Intersection.Reset();
+        for (int32 i = 0, j = 0; i < CandidateIds.Num() && j < PostingList.Num();)
+        {
+            if (CandidateIds[i] < PostingList[j])
             {
-                // If parameter types are specified, check those too
-                if (ParamTypes.Num() > 0)
-                {
-                    if (Function.Params.Num() >= ParamTypes.Num())
-                    {
-                        bool bAllParamsMatch = true;
-                        
-                        // Check each parameter type
-                        for (int32 i = 0; i < ParamTypes.Num(); ++i)
-                        {
-                            if (i >= Function.Params.Num() || 
-                                !Function.Params[i].Type.Contains(ParamTypes[i], ESearchCase::IgnoreCase))
-                            {
-                                bAllParamsMatch = false;
-                                break;
-                            }
-                        }
-                        
-                        if (bAllParamsMatch)
-                        {
-                            bFoundMatch = true;
-                            break;
-                        }
-                    }
-                }
-                else
-                {
-                    // If no parameter types specified, just match by name
-                    bFoundMatch = true;
-                    break;
-                }
+                ++i;
+            }
+            else if (PostingList[j] < CandidateIds[i])
+            {
+                ++j;
+            }
+            else
+            {
+                Intersection.Add(CandidateIds[i]);
+                ++i;
+                ++j;
             }
         }
-        
-        if (bFoundMatch)
+        Swap(CandidateIds, Intersection);
+    }
+
+    // Subgraph search on the survivors only
+    TArray<FBlueprintPatternMatch> Results;
+    TArray<TArray<int32>> GraphMatches;
+
+    for (int32 EntryId : CandidateIds)
+    {
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+        if (!Entry)
+        {
+            continue;
+        }
+
+        for (const FBlueprintGraphSummary& Graph : Entry->GraphSummaries)
         {
-            Results.Add(Blueprint);
+            GraphMatches.Reset();
+            FBlueprintPatternMatcher::Match(Graph, Pattern, MaxMatches > 0 ? MaxMatches - Results.Num() : 0, GraphMatches);
+
+            for (const TArray<int32>& NodeIndices : GraphMatches)
+            {
+                FBlueprintPatternMatch& Match = Results.AddDefaulted_GetRef();
+                Match.BlueprintName = Entry->Data.Name;
+                Match.BlueprintPath = Entry->Data.Path;
+                Match.GraphName = Graph.GraphName;
+
+                for (int32 NodeIndex : NodeIndices)
+                {
+                    Match.NodeIds.Add(Graph.Nodes[NodeIndex].NodeId);
+                    Match.NodeTitles.Add(Graph.Nodes[NodeIndex].Title);
+                }
+            }
+
+            if (MaxMatches > 0 && Results.Num() >= MaxMatches)
+            {
+                return Results;
+            }
         }
     }
-    
-    // If full detail level is requested and we have results, get more detailed information
-    if (DetailLevel == EBlueprintDetailLevel::Full && Results.Num() > 0)
+
+    return Results;
+}
+
+FBlueprintSearchResult FBlueprintSearcher::SearchByRegex(EBlueprintSearchField Field, const FString& Pattern, const FBlueprintRegexLiterals& Literals,
+                                                         EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    // Member fields only exist on entries with member data
+    if (Field == EBlueprintSearchField::Function || Field == EBlueprintSearchField::Variable || Field == EBlueprintSearchField::VariableType)
     {
-        for (int32 i = 0; i < Results.Num(); ++i)
+        TArray<int32> AllEntryIds;
+        FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+        FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+    }
+
+    TArray<int32> CandidateIds;
+    GetRegexCandidates(Field, Literals, CandidateIds);
+
+    // Full regex evaluation on the survivors only
+    const TSharedRef<const FRegexPattern> Compiled = FBlueprintRegex::FindOrCompile(Pattern);
+
+    TArray<int32> EntryIds;
+    TArray<FString> Texts;
+    for (int32 EntryId : CandidateIds)
+    {
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+        if (!Entry)
         {
-            // Use the path to fetch more detailed information
-            TOptional<FBlueprintData> DetailedData = FBlueprintDataExtractor::GetBlueprintByPath(Results[i].Path, DetailLevel);
-            if (DetailedData.IsSet())
+            continue;
+        }
+
+        FBlueprintCatalog::GetFieldTexts(*Entry, Field, Texts);
+        for (const FString& Text : Texts)
+        {
+            FRegexMatcher Matcher(*Compiled, Text);
+            if (Matcher.FindNext())
             {
-                Results[i] = DetailedData.GetValue();
+                EntryIds.Add(EntryId);
+                break;
             }
         }
     }
-    
-    return Results;
+
+    return MakePage(EntryIds, EntryIds.Num(), true, DetailLevel, Options);
 }
 
-TArray<FBlueprintData> FBlueprintSearcher::SearchByVariable(const FString& VariableName, const FString& VariableType, EBlueprintDetailLevel DetailLevel)
+void FBlueprintSearcher::GetRegexCandidates(EBlueprintSearchField Field, const FBlueprintRegexLiterals& Literals, TArray<int32>& OutEntryIds)
 {
-    TArray<FBlueprintData> Results;
-    
-    // For variable searches, we need at least medium detail level to access variable information
-    // We'll use medium detail even for basic searches, then enhance if full detail is requested
-    EBlueprintDetailLevel SearchLevel = EBlueprintDetailLevel::Medium;
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(SearchLevel);
-    
-    // Filter by variable name and optionally type
-    for (const FBlueprintData& Blueprint : AllBlueprints)
+    // Split the required literals into those the trigram index serves and those that need an arena scan
+    TArray<const TArray<FString>*> Indexed;
+    TArray<const TArray<FString>*> Short;
+    for (const TArray<FString>& Alternatives : Literals.Required)
+    {
+        const bool bIndexed = Algo::AllOf(Alternatives, [](const FString& Literal)
+        {
+            return Literal.Len() >= FBlueprintTrigramIndex::MinQueryLength;
+        });
+        (bIndexed ? Indexed : Short).Add(&Alternatives);
+    }
+
+    const TArray<const TArray<FString>*>& Used = Indexed.Num() > 0 ? Indexed : Short;
+    if (Used.Num() == 0)
     {
-        bool bFoundMatch = false;
-        
-        for (const FBlueprintVariableData& Variable : Blueprint.Variables)
+        // Nothing to prefilter on, every entry is a candidate
+        FBlueprintCatalog::GetAllEntryIds(OutEntryIds);
+        return;
+    }
+
+    TArray<int32> AlternativeIds;
+    TArray<int32> Union;
+    TArray<int32> Intersection;
+    for (int32 UsedIndex = 0; UsedIndex < Used.Num(); ++UsedIndex)
+    {
+        // Any one alternative of a group is enough
+        Union.Reset();
+        for (const FString& Literal : *Used[UsedIndex])
         {
-            if (Variable.Name.Contains(VariableName, ESearchCase::IgnoreCase))
+            FBlueprintCatalog::FindSubstring(Field, Literal, AlternativeIds);
+            Union.Append(AlternativeIds);
+        }
+        Union.Sort();
+        Union.SetNum(Algo::Unique(Union));
+
+        if (UsedIndex == 0)
+        {
+            Swap(OutEntryIds, Union);
+        }
+        else
+        {
+            Intersection.Reset();
+            for (int32 i = 0, j = 0; i < OutEntryIds.Num() && j < Union.Num();)
             {
-                // If variable type is specified, check that too
-                if (!VariableType.IsEmpty())
+                if (OutEntryIds[i] < Union[j])
                 {
-                    if (Variable.Type.Contains(VariableType, ESearchCase::IgnoreCase))
-                    {
-                        bFoundMatch = true;
-                        break;
-                    }
+                    ++i;
+                }
+                else if (Union[j] < OutEntryIds[i])
+                {
+                    ++j;
                 }
                 else
                 {
-                    // If no type specified, just match by name
-                    bFoundMatch = true;
-                    break;
+                    Intersection.Add(OutEntryIds[i]);
+                    ++i;
+                    ++j;
                 }
             }
+            Swap(OutEntryIds, Intersection);
         }
-        
-        if (bFoundMatch)
+
+        if (OutEntryIds.Num() == 0)
         {
-            Results.Add(Blueprint);
+            return;
         }
     }
-    
-    // If full detail level is requested and we have results, get more detailed information
-    if (DetailLevel == EBlueprintDetailLevel::Full && Results.Num() > 0)
+}
+
+TArray<FBlueprintGraphUsage> FBlueprintSearcher::FindNodeClassUsages(const FString& NodeClass)
+{
+    // Graph summaries, and with them the postings, are collected together with member data
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+    FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+    TArray<FBlueprintGraphRef> Graphs;
+    FBlueprintCatalog::FindGraphsWithNodeClass(NodeClass, Graphs);
+    return MakeGraphUsages(Graphs);
+}
+
+TArray<FBlueprintGraphUsage> FBlueprintSearcher::FindEventImplementations(const FString& EventName)
+{
+    TArray<int32> AllEntryIds;
+    FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+    FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+
+    TArray<FBlueprintGraphRef> Graphs;
+    FBlueprintCatalog::FindGraphsWithEvent(EventName, Graphs);
+    return MakeGraphUsages(Graphs);
+}
+
+TArray<FBlueprintTopEntry> FBlueprintSearcher::GetTopBlueprints(EBlueprintLeaderboardMetric Metric, int32 MaxResults)
+{
+    // Graph and member metrics are only known once member data is extracted; references and sizes come from the registry
+    if (Metric == EBlueprintLeaderboardMetric::NodeCount || Metric == EBlueprintLeaderboardMetric::GraphCount || Metric == EBlueprintLeaderboardMetric::VariableCount)
+    {
+        TArray<int32> AllEntryIds;
+        FBlueprintCatalog::GetAllEntryIds(AllEntryIds);
+        FBlueprintCatalog::EnsureMemberData(AllEntryIds);
+    }
+
+    TArray<FBlueprintLeaderboardSlot> Slots;
+    FBlueprintCatalog::GetTop(Metric, MaxResults, Slots);
+
+    TArray<FBlueprintTopEntry> Results;
+    Results.Reserve(Slots.Num());
+    for (const FBlueprintLeaderboardSlot& Slot : Slots)
     {
-        for (int32 i = 0; i < Results.Num(); ++i)
+        if (const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(Slot.EntryId))
         {
-            // Use the path to fetch more detailed information
-            TOptional<FBlueprintData> DetailedData = FBlueprintDataExtractor::GetBlueprintByPath(Results[i].Path, DetailLevel);
-            if (DetailedData.IsSet())
-            {
-                Results[i] = DetailedData.GetValue();
-            }
+            FBlueprintTopEntry& Result = Results.AddDefaulted_GetRef();
+            Result.BlueprintName = Entry->Data.Name;
+            Result.BlueprintPath = Entry->Data.Path;
+            Result.Value = Slot.Value;
         }
     }
-    
+
     return Results;
 }
 
-TArray<FBlueprintData> FBlueprintSearcher::SearchWithParameters(const TMap<FString, FString>& SearchParams, EBlueprintDetailLevel DetailLevel)
+TArray<FBlueprintGraphUsage> FBlueprintSearcher::MakeGraphUsages(const TArray<FBlueprintGraphRef>& Graphs)
 {
-    TArray<FBlueprintData> Results;
-    
-    // For parameter searches, use medium detail level if we might need to search functions or variables
-    // otherwise basic level is more efficient
-    EBlueprintDetailLevel SearchLevel = EBlueprintDetailLevel::Basic;
-    
-    // Check if we need function or variable data for the search
-    for (const TPair<FString, FString>& Param : SearchParams)
+    TArray<FBlueprintGraphUsage> Results;
+
+    int32 LastEntryId = INDEX_NONE;
+    for (const FBlueprintGraphRef& GraphRef : Graphs)
     {
-        const FString& Key = Param.Key;
-        if (Key.Equals(TEXT("Function"), ESearchCase::IgnoreCase) ||
-            Key.Equals(TEXT("Variable"), ESearchCase::IgnoreCase))
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(GraphRef.EntryId);
+        if (!Entry || !Entry->GraphSummaries.IsValidIndex(GraphRef.GraphIndex))
         {
-            SearchLevel = EBlueprintDetailLevel::Medium;
-            break;
+            continue;
+        }
+
+        // References are sorted by entry, so each blueprint's graphs arrive together
+        if (GraphRef.EntryId != LastEntryId)
+        {
+            FBlueprintGraphUsage& Usage = Results.AddDefaulted_GetRef();
+            Usage.BlueprintName = Entry->Data.Name;
+            Usage.BlueprintPath = Entry->Data.Path;
+            LastEntryId = GraphRef.EntryId;
         }
+
+        Results.Last().GraphNames.Add(Entry->GraphSummaries[GraphRef.GraphIndex].GraphName);
     }
-    
-    // Get blueprints with appropriate detail level
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(SearchLevel);
-    Results = AllBlueprints;
-    
-    // Apply filters based on provided parameters
-    for (const TPair<FString, FString>& Param : SearchParams)
+
+    return Results;
+}
+
+FBlueprintSearchResult FBlueprintSearcher::MakePage(const TArray<int32>& EntryIds, int32 TotalCount, bool bTotalCountExact,
+                                                    EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options)
+{
+    FBlueprintSearchResult Result;
+    Result.TotalCount = TotalCount;
+    Result.bTotalCountExact = bTotalCountExact;
+
+    const int32 Offset = FMath::Clamp(Options.Offset, 0, EntryIds.Num());
+    const int32 Count = Options.Limit > 0 ? FMath::Min(Options.Limit, EntryIds.Num() - Offset) : EntryIds.Num() - Offset;
+
+    // Only the page itself is ever hydrated
+    const TArray<int32> PageIds(EntryIds.GetData() + Offset, Count);
+    Result.Blueprints = HydrateResults(PageIds, DetailLevel);
+
+    return Result;
+}
+
+TArray<FBlueprintData> FBlueprintSearcher::HydrateResults(const TArray<int32>& EntryIds, EBlueprintDetailLevel DetailLevel)
+{
+    // Basic data is always in the catalog
+    if (DetailLevel == EBlueprintDetailLevel::Basic)
     {
-        const FString& Key = Param.Key;
-        const FString& Value = Param.Value;
-        
-        // Filter current results
-        TArray<FBlueprintData> FilteredResults;
-        
-        if (Key.Equals(TEXT("Name"), ESearchCase::IgnoreCase))
+        return CollectResults(EntryIds, false);
+    }
+
+    // Medium data is reused from the catalog; only blueprints never seen before get loaded, in one batch
+    if (DetailLevel == EBlueprintDetailLevel::Medium)
+    {
+        FBlueprintCatalog::EnsureMemberData(EntryIds);
+        return CollectResults(EntryIds, true);
+    }
+
+    // Higher levels need the loaded blueprints; load every missing one in a single request
+    // and extract from the objects directly instead of going back through the asset registry
+    TArray<UBlueprint*> Blueprints;
+    FBlueprintCatalog::LoadBlueprints(EntryIds, Blueprints);
+
+    TArray<FBlueprintData> Results;
+    Results.Reserve(EntryIds.Num());
+
+    for (int32 i = 0; i < EntryIds.Num(); ++i)
+    {
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryIds[i]);
+        if (!Entry)
         {
-            // Filter by blueprint name
-            for (const FBlueprintData& Blueprint : Results)
-            {
-                if (Blueprint.Name.Contains(Value, ESearchCase::IgnoreCase))
-                {
-                    FilteredResults.Add(Blueprint);
-                }
-            }
+            continue;
         }
-        else if (Key.Equals(TEXT("ParentClass"), ESearchCase::IgnoreCase))
+
+        if (Blueprints[i])
         {
-            // Filter by parent class
-            for (const FBlueprintData& Blueprint : Results)
-            {
-                if (Blueprint.ParentClass.Contains(Value, ESearchCase::IgnoreCase))
-                {
-                    FilteredResults.Add(Blueprint);
-                }
-            }
+            Results.Add(FBlueprintDataExtractor::ExtractBlueprintData(Blueprints[i], DetailLevel));
         }
-        else if (Key.Equals(TEXT("Function"), ESearchCase::IgnoreCase))
+        else
         {
-            // Filter by function name
-            for (const FBlueprintData& Blueprint : Results)
-            {
-                bool bFoundMatch = false;
-                
-                for (const FBlueprintFunctionData& Function : Blueprint.Functions)
-                {
-                    if (Function.Name.Contains(Value, ESearchCase::IgnoreCase))
-                    {
-                        bFoundMatch = true;
-                        break;
-                    }
-                }
-                
-                if (bFoundMatch)
-                {
-                    FilteredResults.Add(Blueprint);
-                }
-            }
+            // Keep what the catalog knows if the blueprint failed to load
+            Results.Add(Entry->Data);
         }
-        else if (Key.Equals(TEXT("Variable"), ESearchCase::IgnoreCase))
+    }
+
+    return Results;
+}
+
+TArray<FBlueprintData> FBlueprintSearcher::CollectResults(const TArray<int32>& EntryIds, bool bIncludeMembers)
+{
+    TArray<FBlueprintData> Results;
+    Results.Reserve(EntryIds.Num());
+
+    for (int32 EntryId : EntryIds)
+    {
+        const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId);
+        if (!Entry)
         {
-            // Filter by variable name
-            for (const FBlueprintData& Blueprint : Results)
-            {
-                bool bFoundMatch = false;
-                
-                for (const FBlueprintVariableData& Variable : Blueprint.Variables)
-                {
-                    if (Variable.Name.Contains(Value, ESearchCase::IgnoreCase))
-                    {
-                        bFoundMatch = true;
-                        break;
-                    }
-                }
-                
-                if (bFoundMatch)
-                {
-                    FilteredResults.Add(Blueprint);
-                }
-            }
+            continue;
         }
-        else if (Key.Equals(TEXT("Path"), ESearchCase::IgnoreCase))
+
+        if (bIncludeMembers)
         {
-            // Filter by asset path
-            for (const FBlueprintData& Blueprint : Results)
-            {
-                if (Blueprint.Path.Contains(Value, ESearchCase::IgnoreCase))
-                {
-                    FilteredResults.Add(Blueprint);
-                }
-            }
+            Results.Add(Entry->Data);
         }
-        
-        // Update results for next filter
-        Results = FilteredResults;
-    }
-    
-    // If a higher detail level is requested than what we used for searching,
-    // and we have results, get more detailed information
-    if (DetailLevel > SearchLevel && Results.Num() > 0)
-    {
-        for (int32 i = 0; i < Results.Num(); ++i)
+        else
         {
-            // Use the path to fetch more detailed information
-            TOptional<FBlueprintData> DetailedData = FBlueprintDataExtractor::GetBlueprintByPath(Results[i].Path, DetailLevel);
-            if (DetailedData.IsSet())
-            {
-                Results[i] = DetailedData.GetValue();
-            }
+            // Basic results only carry name, path and parent class
+            FBlueprintData& BasicData = Results.AddDefaulted_GetRef();
+            BasicData.Name = Entry->Data.Name;
+            BasicData.Path = Entry->Data.Path;
+            BasicData.ParentClass = Entry->Data.ParentClass;
         }
     }
-    
+
     return Results;
 }
\ No newline at end of file
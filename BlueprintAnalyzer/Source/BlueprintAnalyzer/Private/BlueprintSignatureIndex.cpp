@@ -0,0 +1,208 @@
+#include "BlueprintAnalyzer/Public/BlueprintSignatureIndex.h"
+
+namespace BlueprintSignatureIndex
+{
+    /** Key prefixes for the three ways a function is filed */
+    const TCHAR* const InputPrefix = TEXT("in:");
+    const TCHAR* const OutputPrefix = TEXT("out:");
+    const TCHAR* const CombinedPrefix = TEXT("sig:");
+
+    /**
+     * Collect the full types of a function's inputs or outputs
+     */
+    void CollectTypes(const FBlueprintFunctionData& Function, bool bOutputs, TArray<FString>& OutTypes)
+    {
+        OutTypes.Reset();
+        for (const FBlueprintParamData& Param : Function.Params)
+        {
+            if (Param.IsOutput == bOutputs)
+            {
+                // Data cached before full types were extracted only has the pin category
+                OutTypes.Add(Param.FullType.IsEmpty() ? Param.Type : Param.FullType);
+            }
+        }
+    }
+}
+
+FString FBlueprintSignatureIndex::NormalizeType(const FString& Type)
+{
+    FString Normalized;
+    Normalized.Reserve(Type.Len());
+    for (TCHAR Char : Type)
+    {
+        if (!FChar::IsWhitespace(Char))
+        {
+            Normalized.AppendChar(FChar::ToLower(Char));
+        }
+    }
+
+    // Accept the spellings people naturally type for the basic pin categories
+    static const TMap<FString, FString> Aliases = {
+        { TEXT("boolean"), TEXT("bool") },
+        { TEXT("integer"), TEXT("int") },
+        { TEXT("int32"), TEXT("int") },
+        { TEXT("double"), TEXT("float") },
+        { TEXT("real"), TEXT("float") },
+        { TEXT("fstring"), TEXT("string") },
+        { TEXT("fname"), TEXT("name") },
+        { TEXT("ftext"), TEXT("text") }
+    };
+
+    if (const FString* Alias = Aliases.Find(Normalized))
+    {
+        return *Alias;
+    }
+    return Normalized;
+}
+
+void FBlueprintSignatureIndex::ParseTypeList(const FString& TypeList, TArray<FString>& OutTypes)
+{
+    OutTypes.Reset();
+
+    int32 Depth = 0;
+    int32 Start = 0;
+    for (int32 Index = 0; Index <= TypeList.Len(); ++Index)
+    {
+        const TCHAR Char = Index < TypeList.Len() ? TypeList[Index] : TEXT(',');
+        if (Char == TEXT('<'))
+        {
+            ++Depth;
+        }
+        else if (Char == TEXT('>'))
+        {
+            Depth = FMath::Max(Depth - 1, 0);
+        }
+        else if (Char == TEXT(',') && Depth == 0)
+        {
+            FString Type = TypeList.Mid(Start, Index - Start).TrimStartAndEnd();
+            if (!Type.IsEmpty())
+            {
+                OutTypes.Add(MoveTemp(Type));
+            }
+            Start = Index + 1;
+        }
+    }
+}
+
+FString FBlueprintSignatureIndex::MakeKey(const TCHAR* Prefix, TConstArrayView<FString> Types)
+{
+    TArray<FString> Normalized;
+    Normalized.Reserve(Types.Num());
+    for (const FString& Type : Types)
+    {
+        Normalized.Add(NormalizeType(Type));
+    }
+
+    // Sorting makes "Actor,float" and "float,Actor" the same signature
+    Normalized.Sort();
+
+    return Prefix + FString::Join(Normalized, TEXT(","));
+}
+
+void FBlueprintSignatureIndex::AddDocument(int32 DocumentId, TConstArrayView<FBlueprintFunctionData> Functions)
+{
+    TArray<FString>& Keys = DocumentKeys.FindOrAdd(DocumentId);
+
+    TArray<FString> Inputs;
+    TArray<FString> Outputs;
+
+    for (int32 FunctionIndex = 0; FunctionIndex < Functions.Num(); ++FunctionIndex)
+    {
+        const FBlueprintFunctionData& Function = Functions[FunctionIndex];
+        BlueprintSignatureIndex::CollectTypes(Function, false, Inputs);
+        BlueprintSignatureIndex::CollectTypes(Function, true, Outputs);
+
+        const FString InputKey = MakeKey(BlueprintSignatureIndex::InputPrefix, Inputs);
+        const FString OutputKey = MakeKey(BlueprintSignatureIndex::OutputPrefix, Outputs);
+        const FString CombinedKey = BlueprintSignatureIndex::CombinedPrefix + InputKey + TEXT("->") + OutputKey;
+
+        const FFunctionInfo Info{ FunctionIndex, Function.IsPure, Function.IsEvent };
+        for (const FString& Key : { InputKey, OutputKey, CombinedKey })
+        {
+            Signatures.FindOrAdd(Key).Emplace(DocumentId, Info);
+            Keys.AddUnique(Key);
+        }
+    }
+}
+
+void FBlueprintSignatureIndex::RemoveDocument(int32 DocumentId)
+{
+    TArray<FString> Keys;
+    if (!DocumentKeys.RemoveAndCopyValue(DocumentId, Keys))
+    {
+        return;
+    }
+
+    for (const FString& Key : Keys)
+    {
+        TArray<TPair<int32, FFunctionInfo>>* Functions = Signatures.Find(Key);
+        if (!Functions)
+        {
+            continue;
+        }
+
+        Functions->RemoveAll([DocumentId](const TPair<int32, FFunctionInfo>& Function)
+        {
+            return Function.Key == DocumentId;
+        });
+
+        if (Functions->Num() == 0)
+        {
+            Signatures.Remove(Key);
+        }
+    }
+}
+
+void FBlueprintSignatureIndex::Find(const FBlueprintSignatureQuery& Query, TArray<FBlueprintSignatureMatch>& OutMatches) const
+{
+    OutMatches.Reset();
+
+    FString Key;
+    if (Query.bMatchParams && Query.bMatchReturns)
+    {
+        Key = BlueprintSignatureIndex::CombinedPrefix + MakeKey(BlueprintSignatureIndex::InputPrefix, Query.ParamTypes) +
+              TEXT("->") + MakeKey(BlueprintSignatureIndex::OutputPrefix, Query.ReturnTypes);
+    }
+    else if (Query.bMatchParams)
+    {
+        Key = MakeKey(BlueprintSignatureIndex::InputPrefix, Query.ParamTypes);
+    }
+    else if (Query.bMatchReturns)
+    {
+        Key = MakeKey(BlueprintSignatureIndex::OutputPrefix, Query.ReturnTypes);
+    }
+    else
+    {
+        return;
+    }
+
+    const TArray<TPair<int32, FFunctionInfo>>* Functions = Signatures.Find(Key);
+    if (!Functions)
+    {
+        return;
+    }
+
+    for (const TPair<int32, FFunctionInfo>& Function : *Functions)
+    {
+        if ((Query.bPure.IsSet() && Query.bPure.GetValue() != Function.Value.bPure) ||
+            (Query.bEvent.IsSet() && Query.bEvent.GetValue() != Function.Value.bEvent))
+        {
+            continue;
+        }
+
+        FBlueprintSignatureMatch& Match = OutMatches.AddDefaulted_GetRef();
+        Match.DocumentId = Function.Key;
+        Match.FunctionIndex = Function.Value.FunctionIndex;
+    }
+
+    OutMatches.Sort([](const FBlueprintSignatureMatch& A, const FBlueprintSignatureMatch& B)
+    {
+        return A.DocumentId < B.DocumentId || (A.DocumentId == B.DocumentId && A.FunctionIndex < B.FunctionIndex);
+    });
+}
+
+void FBlueprintSignatureIndex::Reset()
+{
+    Signatures.Empty();
+    DocumentKeys.Empty();
+}
@@ -0,0 +1,29 @@
+#include "BlueprintAnalyzer/Public/BlueprintStringTable.h"
+#include "Hash/CityHash.h"
+
+int32 FBlueprintStringTable::Add(FStringView Text)
+{
+    if (const int32* Index = Indices.Find(Text))
+    {
+        return *Index;
+    }
+
+    const int32 Index = Strings.Add(Text);
+    Indices.Add(Text, Index);
+    return Index;
+}
+
+TConstArrayView<FStringView> FBlueprintStringTable::GetStrings() const
+{
+    return Strings;
+}
+
+int32 FBlueprintStringTable::Num() const
+{
+    return Strings.Num();
+}
+
+uint32 FBlueprintStringTable::FKeyFuncs::GetKeyHash(FStringView Key)
+{
+    return CityHash32(reinterpret_cast<const char*>(Key.GetData()), Key.Len() * sizeof(TCHAR));
+}
@@ -0,0 +1,161 @@
+#include "BlueprintAnalyzer/Public/BlueprintTrigramIndex.h"
+#include "Algo/BinarySearch.h"
+
+void FBlueprintTrigramIndex::CollectKeys(EBlueprintSearchField Field, const FString& Text, TSet<uint64>& OutKeys)
+{
+    const int32 Length = Text.Len();
+    if (Length < MinQueryLength)
+    {
+        return;
+    }
+
+    const TCHAR* Chars = *Text;
+    const uint64 FieldBits = static_cast<uint64>(Field) << 48;
+
+    // Fold case the same way FString::Contains(..., IgnoreCase) does so candidates are a superset of matches
+    for (int32 i = 0; i + MinQueryLength <= Length; ++i)
+    {
+        const uint64 A = static_cast<uint16>(FChar::ToUpper(Chars[i]));
+        const uint64 B = static_cast<uint16>(FChar::ToUpper(Chars[i + 1]));
+        const uint64 C = static_cast<uint16>(FChar::ToUpper(Chars[i + 2]));
+        OutKeys.Add(FieldBits | (A << 32) | (B << 16) | C);
+    }
+}
+
+void FBlueprintTrigramIndex::AddDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts)
+{
+    TSet<uint64> Keys;
+    for (const FString& Text : Texts)
+    {
+        CollectKeys(Field, Text, Keys);
+    }
+
+    for (uint64 Key : Keys)
+    {
+        TArray<int32>& PostingList = Postings.FindOrAdd(Key);
+
+        // Keep posting lists sorted so they can be intersected with a linear merge
+        const int32 InsertIndex = Algo::LowerBound(PostingList, DocumentId);
+        if (!PostingList.IsValidIndex(InsertIndex) || PostingList[InsertIndex] != DocumentId)
+        {
+            PostingList.Insert(DocumentId, InsertIndex);
+        }
+    }
+}
+
+void FBlueprintTrigramIndex::RemoveDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts)
+{
+    TSet<uint64> Keys;
+    for (const FString& Text : Texts)
+    {
+        CollectKeys(Field, Text, Keys);
+    }
+
+    for (uint64 Key : Keys)
+    {
+        TArray<int32>* PostingList = Postings.Find(Key);
+        if (!PostingList)
+        {
+            continue;
+        }
+
+        const int32 FoundIndex = Algo::BinarySearch(*PostingList, DocumentId);
+        if (FoundIndex != INDEX_NONE)
+        {
+            PostingList->RemoveAt(FoundIndex, 1, EAllowShrinking::No);
+        }
+
+        // Drop empty lists so the map doesn't grow without bound as assets churn
+        if (PostingList->Num() == 0)
+        {
+            Postings.Remove(Key);
+        }
+    }
+}
+
+bool FBlueprintTrigramIndex::Query(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutCandidates) const
+{
+    OutCandidates.Reset();
+
+    if (Needle.Len() < MinQueryLength)
+    {
+        return false;
+    }
+
+    TSet<uint64> Keys;
+    CollectKeys(Field, Needle, Keys);
+
+    // Gather the posting lists; a missing trigram means nothing can match
+    TArray<const TArray<int32>*> Lists;
+    Lists.Reserve(Keys.Num());
+    for (uint64 Key : Keys)
+    {
+        const TArray<int32>* PostingList = Postings.Find(Key);
+        if (!PostingList)
+        {
+            return true;
+        }
+        Lists.Add(PostingList);
+    }
+
+    // Intersect starting from the shortest list to keep the working set small
+    Lists.Sort([](const TArray<int32>& A, const TArray<int32>& B)
+    {
+        return A.Num() < B.Num();
+    });
+
+    OutCandidates = *Lists[0];
+    for (int32 ListIndex = 1; ListIndex < Lists.Num() && OutCandidates.Num() > 0; ++ListIndex)
+    {
+        const TArray<int32>& Other = *Lists[ListIndex];
+        int32 WriteIndex = 0;
+        int32 OtherIndex = 0;
+
+        for (int32 ReadIndex = 0; ReadIndex < OutCandidates.Num() && OtherIndex < Other.Num(); )
+        {
+            if (OutCandidates[ReadIndex] < Other[OtherIndex])
+            {
+                ++ReadIndex;
+            }
+            else if (OutCandidates[ReadIndex] > Other[OtherIndex])
+            {
+                ++OtherIndex;
+            }
+            else
+            {
+                OutCandidates[WriteIndex++] = OutCandidates[ReadIndex];
+                ++ReadIndex;
+                ++OtherIndex;
+            }
+        }
+
+        OutCandidates.SetNum(WriteIndex, EAllowShrinking::No);
+    }
+
+    return true;
+}
+
+int32 FBlueprintTrigramIndex::EstimateCandidates(EBlueprintSearchField Field, const FString& Needle) const
+{
+    if (Needle.Len() < MinQueryLength)
+    {
+        return INDEX_NONE;
+    }
+
+    TSet<uint64> Keys;
+    CollectKeys(Field, Needle, Keys);
+
+    int32 Estimate = MAX_int32;
+    for (uint64 Key : Keys)
+    {
+        const TArray<int32>* PostingList = Postings.Find(Key);
+        Estimate = FMath::Min(Estimate, PostingList ? PostingList->Num() : 0);
+    }
+
+    return Estimate;
+}
+
+void FBlueprintTrigramIndex::Reset()
+{
+    Postings.Reset();
+}
@@ -0,0 +1,464 @@
+#include "BlueprintAnalyzer/Public/BlueprintUtf8JsonWriter.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#define BLUEPRINT_UTF8_WRITER_SSE 1
+#else
+#define BLUEPRINT_UTF8_WRITER_SSE 0
+#endif
+
+namespace BlueprintUtf8JsonWriter
+{
+    /** Characters transcoded per buffer reservation, bounds the worst-case over-reservation */
+    constexpr int32 ChunkLength = 4096;
+
+    /**
+     * Copy the leading printable ASCII run of Source to Dest as bytes
+     * @param bEscape Whether quotes, backslashes and control characters also end the run
+     * @return Number of characters copied
+     */
+    template <bool bEscape>
+    int32 CopyAsciiRun(const TCHAR* Source, int32 Length, uint8* Dest)
+    {
+        int32 Index = 0;
+
+#if BLUEPRINT_UTF8_WRITER_SSE
+        if constexpr (sizeof(TCHAR) == 2)
+        {
+            const __m128i HighBits = _mm_set1_epi16(static_cast<int16>(0xFF80));
+            const __m128i Zero = _mm_setzero_si128();
+            const __m128i Space = _mm_set1_epi16(0x20);
+            const __m128i Quote = _mm_set1_epi16(0x22);
+            const __m128i Backslash = _mm_set1_epi16(0x5C);
+
+            for (; Index + 8 <= Length; Index += 8)
+            {
+                const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+
+                // Lanes without bits above 0x7F are ASCII; surrogates and everything else non-ASCII fail here
+                __m128i Clean = _mm_cmpeq_epi16(_mm_and_si128(Block, HighBits), Zero);
+                if constexpr (bEscape)
+                {
+                    const __m128i Special = _mm_or_si128(_mm_cmplt_epi16(Block, Space),
+                        _mm_or_si128(_mm_cmpeq_epi16(Block, Quote), _mm_cmpeq_epi16(Block, Backslash)));
+                    Clean = _mm_andnot_si128(Special, Clean);
+                }
+
+                const uint32 CleanMask = static_cast<uint32>(_mm_movemask_epi8(Clean));
+                if (CleanMask != 0xFFFF)
+                {
+                    // Two mask bits per character; copy the clean prefix and stop at the first other character
+                    const int32 NumClean = static_cast<int32>(FMath::CountTrailingZeros(~CleanMask)) / 2;
+                    for (int32 Offset = 0; Offset < NumClean; ++Offset)
+                    {
+                        Dest[Index + Offset] = static_cast<uint8>(Source[Index + Offset]);
+                    }
+                    return Index + NumClean;
+                }
+
+                // All eight are ASCII, so narrowing the 16-bit lanes to bytes is exact
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(Dest + Index), _mm_packus_epi16(Block, Block));
+            }
+        }
+#endif
+
+        for (; Index < Length; ++Index)
+        {
+            const TCHAR Char = Source[Index];
+            if (Char >= 0x80 || (bEscape && (Char < 0x20 || Char == TEXT('"') || Char == TEXT('\\'))))
+            {
+                break;
+            }
+            Dest[Index] = static_cast<uint8>(Char);
+        }
+        return Index;
+    }
+
+    /**
+     * Decode the code point at Source[Index], joining UTF-16 surrogate pairs
+     * Lone surrogates decode to U+FFFD so the output always stays valid UTF-8.
+     * @return Number of characters consumed
+     */
+    int32 DecodeCodePoint(const TCHAR* Source, int32 Index, int32 Length, uint32& OutCodePoint)
+    {
+        const uint32 Char = static_cast<uint32>(Source[Index]);
+
+        if (Char >= 0xD800 && Char <= 0xDBFF && Index + 1 < Length)
+        {
+            const uint32 Next = static_cast<uint32>(Source[Index + 1]);
+            if (Next >= 0xDC00 && Next <= 0xDFFF)
+            {
+                OutCodePoint = 0x10000 + ((Char - 0xD800) << 10) + (Next - 0xDC00);
+                return 2;
+            }
+        }
+
+        OutCodePoint = (Char >= 0xD800 && Char <= 0xDFFF) || Char > 0x10FFFF ? 0xFFFD : Char;
+        return 1;
+    }
+
+    /** Encode a code point as UTF-8, returning the end of the written bytes */
+    uint8* EncodeCodePoint(uint32 CodePoint, uint8* Dest)
+    {
+        if (CodePoint < 0x80)
+        {
+            *Dest++ = static_cast<uint8>(CodePoint);
+        }
+        else if (CodePoint < 0x800)
+        {
+            *Dest++ = static_cast<uint8>(0xC0 | (CodePoint >> 6));
+            *Dest++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+        }
+        else if (CodePoint < 0x10000)
+        {
+            *Dest++ = static_cast<uint8>(0xE0 | (CodePoint >> 12));
+            *Dest++ = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+            *Dest++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+        }
+        else
+        {
+            *Dest++ = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+            *Dest++ = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+            *Dest++ = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+            *Dest++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+        }
+        return Dest;
+    }
+
+    /** Write the JSON escape sequence for a quote, backslash or control character */
+    uint8* EncodeEscape(TCHAR Char, uint8* Dest)
+    {
+        static const uint8 HexDigits[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+        *Dest++ = '\\';
+        switch (Char)
+        {
+        case TEXT('"'):  *Dest++ = '"'; break;
+        case TEXT('\\'): *Dest++ = '\\'; break;
+        case TEXT('\b'): *Dest++ = 'b'; break;
+        case TEXT('\f'): *Dest++ = 'f'; break;
+        case TEXT('\n'): *Dest++ = 'n'; break;
+        case TEXT('\r'): *Dest++ = 'r'; break;
+        case TEXT('\t'): *Dest++ = 't'; break;
+        default:
+            *Dest++ = 'u';
+            *Dest++ = '0';
+            *Dest++ = '0';
+            *Dest++ = HexDigits[(Char >> 4) & 0xF];
+            *Dest++ = HexDigits[Char & 0xF];
+            break;
+        }
+        return Dest;
+    }
+
+    /**
+     * Transcode text to UTF-8, optionally escaping it for a JSON string
+     * Each chunk reserves its worst case once and is trimmed afterwards, so the inner loop never checks capacity.
+     */
+    template <bool bEscape>
+    void AppendText(TArray<uint8>& Out, FStringView Text)
+    {
+        // \u001f is the longest escape; otherwise a character takes at most 3 bytes (a surrogate pair 4 for 2)
+        constexpr int32 MaxBytesPerChar = bEscape ? 6 : 3;
+
+        const TCHAR* Source = Text.GetData();
+        const int32 Length = Text.Len();
+
+        int32 Index = 0;
+        while (Index < Length)
+        {
+            // One spare character for a surrogate pair straddling the chunk end
+            const int32 ChunkEnd = FMath::Min(Index + ChunkLength, Length);
+            const int32 Start = Out.Num();
+            Out.AddUninitialized((ChunkEnd - Index + 1) * MaxBytesPerChar);
+
+            uint8* const Begin = Out.GetData() + Start;
+            uint8* Dest = Begin;
+
+            while (Index < ChunkEnd)
+            {
+                const int32 NumCopied = CopyAsciiRun<bEscape>(Source + Index, ChunkEnd - Index, Dest);
+                Index += NumCopied;
+                Dest += NumCopied;
+
+                if (Index >= ChunkEnd)
+                {
+                    break;
+                }
+
+                if (bEscape && Source[Index] < 0x80)
+                {
+                    Dest = EncodeEscape(Source[Index], Dest);
+                    ++Index;
+                    continue;
+                }
+
+                uint32 CodePoint = 0;
+                Index += DecodeCodePoint(Source, Index, Length, CodePoint);
+                Dest = EncodeCodePoint(CodePoint, Dest);
+            }
+
+            Out.SetNumUninitialized(Start + static_cast<int32>(Dest - Begin), EAllowShrinking::No);
+        }
+    }
+
+    /** Format an integer in decimal, returning the number of characters written (at most 20) */
+    int32 FormatInteger(int64 Value, ANSICHAR* Buffer)
+    {
+        uint64 Magnitude = Value < 0 ? 0 - static_cast<uint64>(Value) : static_cast<uint64>(Value);
+
+        ANSICHAR Digits[20];
+        int32 NumDigits = 0;
+        do
+        {
+            Digits[NumDigits++] = static_cast<ANSICHAR>('0' + Magnitude % 10);
+            Magnitude /= 10;
+        }
+        while (Magnitude > 0);
+
+        int32 Length = 0;
+        if (Value < 0)
+        {
+            Buffer[Length++] = '-';
+        }
+        while (NumDigits > 0)
+        {
+            Buffer[Length++] = Digits[--NumDigits];
+        }
+        return Length;
+    }
+}
+
+FBlueprintUtf8JsonWriter::FBlueprintUtf8JsonWriter(int32 InitialCapacity)
+{
+    Bytes.Reserve(InitialCapacity);
+}
+
+void FBlueprintUtf8JsonWriter::WriteObjectStart()
+{
+    WriteSeparator();
+    OpenScope('{');
+}
+
+void FBlueprintUtf8JsonWriter::WriteObjectStart(FStringView Identifier)
+{
+    WriteIdentifier(Identifier);
+    OpenScope('{');
+}
+
+void FBlueprintUtf8JsonWriter::WriteObjectEnd()
+{
+    CloseScope('}');
+}
+
+void FBlueprintUtf8JsonWriter::WriteArrayStart()
+{
+    WriteSeparator();
+    OpenScope('[');
+}
+
+void FBlueprintUtf8JsonWriter::WriteArrayStart(FStringView Identifier)
+{
+    WriteIdentifier(Identifier);
+    OpenScope('[');
+}
+
+void FBlueprintUtf8JsonWriter::WriteArrayEnd()
+{
+    CloseScope(']');
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Value)
+{
+    WriteSeparator();
+    AppendJsonString(Bytes, Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(const FString& Value)
+{
+    WriteValue(FStringView(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(const TCHAR* Value)
+{
+    WriteValue(FStringView(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(bool Value)
+{
+    WriteSeparator();
+    AppendBool(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(int32 Value)
+{
+    WriteValue(static_cast<int64>(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(int64 Value)
+{
+    WriteSeparator();
+    AppendInteger(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(double Value)
+{
+    WriteSeparator();
+    AppendDouble(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteNull()
+{
+    WriteSeparator();
+    AppendAscii("null", 4);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, FStringView Value)
+{
+    WriteIdentifier(Identifier);
+    AppendJsonString(Bytes, Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, const FString& Value)
+{
+    WriteValue(Identifier, FStringView(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, const TCHAR* Value)
+{
+    WriteValue(Identifier, FStringView(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, bool Value)
+{
+    WriteIdentifier(Identifier);
+    AppendBool(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, int32 Value)
+{
+    WriteValue(Identifier, static_cast<int64>(Value));
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, int64 Value)
+{
+    WriteIdentifier(Identifier);
+    AppendInteger(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteValue(FStringView Identifier, double Value)
+{
+    WriteIdentifier(Identifier);
+    AppendDouble(Value);
+}
+
+void FBlueprintUtf8JsonWriter::WriteNull(FStringView Identifier)
+{
+    WriteIdentifier(Identifier);
+    AppendAscii("null", 4);
+}
+
+void FBlueprintUtf8JsonWriter::WriteRawValue(TConstArrayView<uint8> Encoded)
+{
+    WriteSeparator();
+    Bytes.Append(Encoded.GetData(), Encoded.Num());
+}
+
+bool FBlueprintUtf8JsonWriter::Close()
+{
+    return HasValue.Num() == 0 && Bytes.Num() > 0;
+}
+
+TArray<uint8> FBlueprintUtf8JsonWriter::MoveBytes()
+{
+    HasValue.Reset();
+    return MoveTemp(Bytes);
+}
+
+void FBlueprintUtf8JsonWriter::AppendJsonString(TArray<uint8>& Out, FStringView Text)
+{
+    Out.Add('"');
+    BlueprintUtf8JsonWriter::AppendText<true>(Out, Text);
+    Out.Add('"');
+}
+
+void FBlueprintUtf8JsonWriter::AppendUtf8(TArray<uint8>& Out, FStringView Text)
+{
+    BlueprintUtf8JsonWriter::AppendText<false>(Out, Text);
+}
+
+void FBlueprintUtf8JsonWriter::WriteSeparator()
+{
+    if (HasValue.Num() == 0)
+    {
+        return;
+    }
+
+    if (HasValue.Last())
+    {
+        Bytes.Add(',');
+    }
+    HasValue.Last() = true;
+}
+
+void FBlueprintUtf8JsonWriter::WriteIdentifier(FStringView Identifier)
+{
+    WriteSeparator();
+    AppendJsonString(Bytes, Identifier);
+    Bytes.Add(':');
+}
+
+void FBlueprintUtf8JsonWriter::OpenScope(uint8 StartChar)
+{
+    Bytes.Add(StartChar);
+    HasValue.Add(false);
+}
+
+void FBlueprintUtf8JsonWriter::CloseScope(uint8 EndChar)
+{
+    if (!ensureMsgf(HasValue.Num() > 0, TEXT("Unbalanced JSON end")))
+    {
+        return;
+    }
+
+    HasValue.Pop(EAllowShrinking::No);
+    Bytes.Add(EndChar);
+}
+
+void FBlueprintUtf8JsonWriter::AppendAscii(const ANSICHAR* Text, int32 Length)
+{
+    Bytes.Append(reinterpret_cast<const uint8*>(Text), Length);
+}
+
+void FBlueprintUtf8JsonWriter::AppendBool(bool Value)
+{
+    if (Value)
+    {
+        AppendAscii("true", 4);
+    }
+    else
+    {
+        AppendAscii("false", 5);
+    }
+}
+
+void FBlueprintUtf8JsonWriter::AppendInteger(int64 Value)
+{
+    ANSICHAR Buffer[24];
+    AppendAscii(Buffer, BlueprintUtf8JsonWriter::FormatInteger(Value, Buffer));
+}
+
+void FBlueprintUtf8JsonWriter::AppendDouble(double Value)
+{
+    // JSON has no representation for NaN or infinity
+    if (!FMath::IsFinite(Value))
+    {
+        AppendAscii("null", 4);
+        return;
+    }
+
+    // Same precision as TJsonWriter, so numbers round-trip exactly
+    ANSICHAR Buffer[32];
+    const int32 Length = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%.17g", Value);
+    AppendAscii(Buffer, FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Buffer)) - 1));
+}
@@ -81,7 +81,7 @@ FString FMCPDoc::GetFullApiDocs()
     TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
     
     // Add blueprint analyzer version
-    RootObject->SetStringField(TEXT("apiVersion"), TEXT("1.0.0"));
+    RootObject->SetStringField(TEXT("apiVersion"), TEXT("2.0.0"));
     RootObject->SetStringField(TEXT("name"), TEXT("Blueprint Analyzer API"));
     
     // Add endpoints documentation
@@ -118,6 +118,21 @@ FString FMCPDoc::GetFullApiDocs()
     OffsetParam->SetStringField(TEXT("description"), TEXT("Starting index for pagination"));
     ListAllParamsArray.Add(MakeShareable(new FJsonValueObject(OffsetParam)));
     
+    TSharedPtr<FJsonObject> ApiVersionParam = MakeShareable(new FJsonObject);
+    ApiVersionParam->SetStringField(TEXT("name"), TEXT("apiVersion"));
+    ApiVersionParam->SetStringField(TEXT("type"), TEXT("integer"));
+    ApiVersionParam->SetBoolField(TEXT("required"), false);
+    ApiVersionParam->SetStringField(TEXT("default"), TEXT("1"));
+    ApiVersionParam->SetStringField(TEXT("description"), TEXT("API version the client was written against; 2 turns omitDefaults on"));
+    ListAllParamsArray.Add(MakeShareable(new FJsonValueObject(ApiVersionParam)));
+    
+    TSharedPtr<FJsonObject> OmitDefaultsParam = MakeShareable(new FJsonObject);
+    OmitDefaultsParam->SetStringField(TEXT("name"), TEXT("omitDefaults"));
+    OmitDefaultsParam->SetStringField(TEXT("type"), TEXT("boolean"));
+    OmitDefaultsParam->SetBoolField(TEXT("required"), false);
+    OmitDefaultsParam->SetStringField(TEXT("description"), TEXT("Leave out empty strings, false, 0 and empty arrays and objects; a missing field means that default. Also accepted by /blueprints/search, /path, /function and /graph/nodes"));
+    ListAllParamsArray.Add(MakeShareable(new FJsonValueObject(OmitDefaultsParam)));
+    
     ListAllEndpoint->SetArrayField(TEXT("parameters"), ListAllParamsArray);
     EndpointsArray.Add(MakeShareable(new FJsonValueObject(ListAllEndpoint)));
     
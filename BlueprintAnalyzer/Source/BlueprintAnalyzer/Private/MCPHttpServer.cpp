@@ -5,15 +5,342 @@
 #include "HttpServerResponse.h"
 #include "HttpPath.h"
 #include "BlueprintAnalyzer/Public/BlueprintDataExtractor.h"
+#include "BlueprintAnalyzer/Public/BlueprintDataSerializer.h"
+#include "BlueprintAnalyzer/Public/BlueprintUtf8JsonWriter.h"
+#include "BlueprintAnalyzer/Public/BlueprintBinaryWriter.h"
 #include "BlueprintAnalyzer/Public/BlueprintSearcher.h"
+#include "BlueprintAnalyzer/Public/BlueprintQuery.h"
+#include "BlueprintAnalyzer/Public/BlueprintSignatureIndex.h"
+#include "BlueprintAnalyzer/Public/BlueprintGraphPattern.h"
+#include "BlueprintAnalyzer/Public/BlueprintRegex.h"
+#include "BlueprintAnalyzer/Public/BlueprintResultCache.h"
+#include "BlueprintAnalyzer/Public/BlueprintResponseCompression.h"
+#include "BlueprintAnalyzer/Public/BlueprintCatalog.h"
+#include "BlueprintAnalyzer/Public/BlueprintFragmentCache.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "BlueprintAnalyzer/Public/MCPIntegration.h"
 #include "Modules/ModuleManager.h"
+#include "Async/Async.h"
 
 // Initialize static members
 TSharedPtr<IHttpRouter> FMCPHttpServer::HttpRouter = nullptr;
 
+namespace MCPHttpServer
+{
+    /** Optional /blueprints/search parameters at their default values */
+    const TMap<FString, FString> SearchDefaults = {
+        { TEXT("type"), TEXT("name") },
+        { TEXT("detailLevel"), TEXT("0") },
+        { TEXT("limit"), TEXT("0") },
+        { TEXT("offset"), TEXT("0") },
+        { TEXT("exactCount"), TEXT("true") },
+        { TEXT("compact"), TEXT("false") }
+    };
+
+    /** Paging parameters at their default values */
+    const TMap<FString, FString> PagingDefaults = {
+        { TEXT("limit"), TEXT("0") },
+        { TEXT("offset"), TEXT("0") }
+    };
+
+    /** Write the "metadata" field of a paged blueprint list */
+    template <typename WriterType>
+    void WritePaginationMetadata(WriterType& Writer, int32 Count, int32 TotalCount, int32 Limit, int32 Offset, bool bTotalCountExact)
+    {
+        Writer.WriteObjectStart(TEXT("metadata"));
+        Writer.WriteValue(TEXT("totalCount"), TotalCount);
+        Writer.WriteValue(TEXT("count"), Count);
+        Writer.WriteValue(TEXT("limit"), Limit);
+        Writer.WriteValue(TEXT("offset"), Offset);
+        Writer.WriteValue(TEXT("totalCountExact"), bTotalCountExact);
+        Writer.WriteObjectEnd();
+    }
+
+    /** Write a blueprints array and its pagination metadata as one object */
+    template <typename WriterType>
+    void WriteBlueprintsWithMetadata(
+        WriterType& Writer,
+        const TArray<FBlueprintData>& BlueprintsData,
+        int32 TotalCount,
+        int32 Limit,
+        int32 Offset,
+        bool bTotalCountExact,
+        const FBlueprintSerializationOptions& Options)
+    {
+        Writer.WriteObjectStart();
+        FBlueprintDataSerializer::WriteBlueprintsField(Writer, BlueprintsData, Options);
+        WritePaginationMetadata(Writer, BlueprintsData.Num(), TotalCount, Limit, Offset, bTotalCountExact);
+        Writer.WriteObjectEnd();
+    }
+
+    /** Write already encoded blueprint objects and their pagination metadata as one object */
+    template <typename WriterType>
+    void WriteFragmentsWithMetadata(
+        WriterType& Writer,
+        TConstArrayView<TSharedPtr<const TArray<uint8>>> Fragments,
+        int32 TotalCount,
+        int32 Limit,
+        int32 Offset)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteArrayStart(TEXT("blueprints"));
+        for (const TSharedPtr<const TArray<uint8>>& Fragment : Fragments)
+        {
+            Writer.WriteRawValue(*Fragment);
+        }
+        Writer.WriteArrayEnd();
+        WritePaginationMetadata(Writer, Fragments.Num(), TotalCount, Limit, Offset, true);
+        Writer.WriteObjectEnd();
+    }
+
+    /** Write a value that is an array element when Identifier is null and an object field otherwise */
+    template <typename WriterType, typename ValueType>
+    void WriteField(WriterType& Writer, const FString* Identifier, const ValueType& Value)
+    {
+        if (Identifier)
+        {
+            Writer.WriteValue(*Identifier, Value);
+        }
+        else
+        {
+            Writer.WriteValue(Value);
+        }
+    }
+
+    template <typename WriterType>
+    void WriteJsonObject(WriterType& Writer, const FString* Identifier, const TSharedPtr<FJsonObject>& Object);
+
+    /** Write a JSON DOM value; whole numbers are written as integers so binary encodings keep them compact */
+    template <typename WriterType>
+    void WriteJsonValue(WriterType& Writer, const FString* Identifier, const TSharedPtr<FJsonValue>& Value)
+    {
+        switch (Value.IsValid() ? Value->Type : EJson::Null)
+        {
+        case EJson::String:
+            WriteField(Writer, Identifier, Value->AsString());
+            break;
+            
+        case EJson::Number:
+        {
+            const double Number = Value->AsNumber();
+            if (FMath::IsFinite(Number) && Number == FMath::RoundToDouble(Number) && FMath::Abs(Number) < 9007199254740992.0)
+            {
+                WriteField(Writer, Identifier, static_cast<int64>(Number));
+            }
+            else
+            {
+                WriteField(Writer, Identifier, Number);
+            }
+            break;
+        }
+            
+        case EJson::Boolean:
+            WriteField(Writer, Identifier, Value->AsBool());
+            break;
+            
+        case EJson::Array:
+            if (Identifier)
+            {
+                Writer.WriteArrayStart(*Identifier);
+            }
+            else
+            {
+                Writer.WriteArrayStart();
+            }
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                WriteJsonValue(Writer, nullptr, Element);
+            }
+            Writer.WriteArrayEnd();
+            break;
+            
+        case EJson::Object:
+            WriteJsonObject(Writer, Identifier, Value->AsObject());
+            break;
+            
+        default:
+            if (Identifier)
+            {
+                Writer.WriteNull(*Identifier);
+            }
+            else
+            {
+                Writer.WriteNull();
+            }
+            break;
+        }
+    }
+    
+    template <typename WriterType>
+    void WriteJsonObject(WriterType& Writer, const FString* Identifier, const TSharedPtr<FJsonObject>& Object)
+    {
+        if (Identifier)
+        {
+            Writer.WriteObjectStart(*Identifier);
+        }
+        else
+        {
+            Writer.WriteObjectStart();
+        }
+        if (Object.IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+            {
+                WriteJsonValue(Writer, &Field.Key, Field.Value);
+            }
+        }
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Encode a document in the negotiated format
+     * @param Write Called once with the writer for the format; writes the document
+     * @param InitialCapacity Number of bytes to reserve up front
+     */
+    template <typename WriteFunctionType>
+    TArray<uint8> Encode(EBlueprintWireFormat Format, WriteFunctionType&& Write, int32 InitialCapacity = 4096)
+    {
+        if (Format == EBlueprintWireFormat::Json)
+        {
+            FBlueprintUtf8JsonWriter Writer(InitialCapacity);
+            Write(Writer);
+            Writer.Close();
+            return Writer.MoveBytes();
+        }
+        
+        FBlueprintBinaryWriter Writer(Format, InitialCapacity);
+        Write(Writer);
+        Writer.Close();
+        return Writer.MoveBytes();
+    }
+    
+    /**
+     * Extract the blueprints of catalog entries at a detail level
+     * @param EntryIds Ids of the entries
+     * @param DetailLevel Level of detail to extract
+     * @return One result per id, unset where the blueprint could not be loaded
+     */
+    TArray<TOptional<FBlueprintData>> ExtractEntries(TConstArrayView<int32> EntryIds, EBlueprintDetailLevel DetailLevel)
+    {
+        TArray<TOptional<FBlueprintData>> Results;
+        Results.SetNum(EntryIds.Num());
+        
+        if (DetailLevel == EBlueprintDetailLevel::Basic)
+        {
+            // Basic results only carry name, path and parent class, which the catalog already holds;
+            // ids the catalog no longer has stay unset, as there is no path left to look up
+            for (int32 Index = 0; Index < EntryIds.Num(); ++Index)
+            {
+                if (const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryIds[Index]))
+                {
+                    FBlueprintData& BasicData = Results[Index].Emplace();
+                    BasicData.Name = Entry->Data.Name;
+                    BasicData.Path = Entry->Data.Path;
+                    BasicData.ParentClass = Entry->Data.ParentClass;
+                }
+            }
+            return Results;
+        }
+        
+        TArray<UBlueprint*> Blueprints;
+        FBlueprintCatalog::LoadBlueprints(EntryIds, Blueprints);
+        for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+        {
+            if (Blueprints[Index])
+            {
+                Results[Index] = FBlueprintDataExtractor::ExtractBlueprintData(Blueprints[Index], DetailLevel);
+            }
+        }
+        return Results;
+    }
+    
+    /**
+     * Collect the blueprints a response was built from, for the result cache's unsaved-changes check
+     * @param Results Search results or matches
+     * @param PathMember Member holding the object path of each result's blueprint
+     * @return Each object path once
+     */
+    template <typename ResultType>
+    TArray<FString> GetSourcePaths(const TArray<ResultType>& Results, FString ResultType::* PathMember)
+    {
+        TSet<FString> Paths;
+        Paths.Reserve(Results.Num());
+        for (const ResultType& Result : Results)
+        {
+            Paths.Add(Result.*PathMember);
+        }
+        return Paths.Array();
+    }
+    
+    /**
+     * Get catalog entries as encoded blueprint objects, serializing only those not in the fragment cache
+     * @param EntryIds Ids of the entries
+     * @param DetailLevel Level of detail to extract
+     * @param Format Encoding of the fragments
+     * @param Options Layout of the fragments, without compact graphs
+     * @return Fragments in entry order; blueprints that could not be loaded are left out
+     */
+    TArray<TSharedPtr<const TArray<uint8>>> GetFragments(
+        TConstArrayView<int32> EntryIds,
+        EBlueprintDetailLevel DetailLevel,
+        EBlueprintWireFormat Format,
+        const FBlueprintSerializationOptions& Options)
+    {
+        TArray<TSharedPtr<const TArray<uint8>>> Fragments;
+        Fragments.SetNum(EntryIds.Num());
+        
+        TArray<int32> MissIds;
+        TArray<int32> MissSlots;
+        for (int32 Index = 0; Index < EntryIds.Num(); ++Index)
+        {
+            const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryIds[Index]);
+            if (!Entry)
+            {
+                continue;
+            }
+            
+            if (!FBlueprintCatalog::HasUnsavedChanges(Entry->Data.Path))
+            {
+                Fragments[Index] = FBlueprintFragmentCache::Find(Entry->Data.Path, DetailLevel, Format, Options, Entry->Revision);
+            }
+            
+            if (!Fragments[Index])
+            {
+                MissIds.Add(EntryIds[Index]);
+                MissSlots.Add(Index);
+            }
+        }
+        
+        // The misses are loaded in one batch
+        const TArray<TOptional<FBlueprintData>> Extracted = ExtractEntries(MissIds, DetailLevel);
+        for (int32 MissIndex = 0; MissIndex < MissIds.Num(); ++MissIndex)
+        {
+            if (!Extracted[MissIndex].IsSet())
+            {
+                continue;
+            }
+            
+            const FBlueprintData& BlueprintData = Extracted[MissIndex].GetValue();
+            const TSharedRef<const TArray<uint8>> Fragment = MakeShared<TArray<uint8>>(Encode(Format, [&BlueprintData, &Options](auto& Writer)
+            {
+                FBlueprintDataSerializer::WriteBlueprint(Writer, BlueprintData, Options);
+            }));
+            Fragments[MissSlots[MissIndex]] = Fragment;
+            
+            // Loading may have updated the entry, so read its revision again
+            const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(MissIds[MissIndex]);
+            if (Entry && !FBlueprintCatalog::HasUnsavedChanges(Entry->Data.Path))
+            {
+                FBlueprintFragmentCache::Add(Entry->Data.Path, DetailLevel, Format, Options, Entry->Revision, Fragment);
+            }
+        }
+        
+        Fragments.RemoveAll([](const TSharedPtr<const TArray<uint8>>& Fragment) { return !Fragment.IsValid(); });
+        return Fragments;
+    }
+}
+
 bool FMCPHttpServer::Initialize(uint32 Port)
 {
     // Get the HTTP server module
@@ -36,39 +363,67 @@ bool FMCPHttpServer::Initialize(uint32 Port)
     // Bind routes
     
     // GET /blueprints/all - List all blueprints
-    auto AllBlueprintsDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleListAllBlueprints);
+    auto AllBlueprintsDelegate = CreateHandler(&FMCPHttpServer::HandleListAllBlueprints);
     HttpRouter->BindRoute(FHttpPath("/blueprints/all"), EHttpServerRequestVerbs::VERB_GET, AllBlueprintsDelegate);
     
     // GET /blueprints/search?query=X&type=Y - Search blueprints
-    auto SearchBlueprintsDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleSearchBlueprints);
+    auto SearchBlueprintsDelegate = CreateHandler(&FMCPHttpServer::HandleSearchBlueprints);
     HttpRouter->BindRoute(FHttpPath("/blueprints/search"), EHttpServerRequestVerbs::VERB_GET, SearchBlueprintsDelegate);
     
+    // GET /blueprints/grep?query=X - Search text inside blueprint graphs
+    auto GrepBlueprintsDelegate = CreateHandler(&FMCPHttpServer::HandleGrepBlueprints);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/grep"), EHttpServerRequestVerbs::VERB_GET, GrepBlueprintsDelegate);
+    
+    // GET /blueprints/pattern?pattern=X - Find structural patterns in blueprint graphs
+    auto PatternSearchDelegate = CreateHandler(&FMCPHttpServer::HandlePatternSearch);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/pattern"), EHttpServerRequestVerbs::VERB_GET, PatternSearchDelegate);
+    
+    // GET /blueprints/usages?nodeClass=X or ?event=Y - Find blueprints using a node class or implementing an event
+    auto FindUsagesDelegate = CreateHandler(&FMCPHttpServer::HandleFindUsages);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/usages"), EHttpServerRequestVerbs::VERB_GET, FindUsagesDelegate);
+    
+    // GET /blueprints/complete?prefix=X&k=N - Type-ahead completion of names, paths, functions and events
+    auto CompleteDelegate = CreateHandler(&FMCPHttpServer::HandleComplete);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/complete"), EHttpServerRequestVerbs::VERB_GET, CompleteDelegate);
+    
+    // GET /blueprints/tree?path=/Game/X - Subfolders with recursive counts and the blueprints directly in a folder
+    auto GetTreeDelegate = CreateHandler(&FMCPHttpServer::HandleGetTree);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/tree"), EHttpServerRequestVerbs::VERB_GET, GetTreeDelegate);
+    
+    // GET /blueprints/top?metric=X&k=N - Largest, most referenced and most complex blueprints
+    auto GetTopDelegate = CreateHandler(&FMCPHttpServer::HandleGetTop);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/top"), EHttpServerRequestVerbs::VERB_GET, GetTopDelegate);
+    
+    // GET /blueprints/cache/stats - Result cache hit/miss counters
+    auto GetCacheStatsDelegate = CreateHandler(&FMCPHttpServer::HandleGetCacheStats);
+    HttpRouter->BindRoute(FHttpPath("/blueprints/cache/stats"), EHttpServerRequestVerbs::VERB_GET, GetCacheStatsDelegate);
+    
     // GET /blueprints/path - Get blueprint by path (using query parameter)
-    auto GetBlueprintByPathDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetBlueprintByPath);
+    auto GetBlueprintByPathDelegate = CreateHandler(&FMCPHttpServer::HandleGetBlueprintByPath);
     HttpRouter->BindRoute(FHttpPath("/blueprints/path"), EHttpServerRequestVerbs::VERB_GET, GetBlueprintByPathDelegate);
     
     // GET /blueprints/function - Get function graph data
-    auto GetFunctionGraphDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetFunctionGraph);
+    auto GetFunctionGraphDelegate = CreateHandler(&FMCPHttpServer::HandleGetFunctionGraph);
     HttpRouter->BindRoute(FHttpPath("/blueprints/function"), EHttpServerRequestVerbs::VERB_GET, GetFunctionGraphDelegate);
     
     // GET /blueprints/graph/nodes - Get nodes by type
-    auto GetNodesByTypeDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetNodesByType);
+    auto GetNodesByTypeDelegate = CreateHandler(&FMCPHttpServer::HandleGetNodesByType);
     HttpRouter->BindRoute(FHttpPath("/blueprints/graph/nodes"), EHttpServerRequestVerbs::VERB_GET, GetNodesByTypeDelegate);
     
     // GET /blueprints/events - Get all event nodes from a blueprint
-    auto GetEventNodesDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetEventNodes);
+    auto GetEventNodesDelegate = CreateHandler(&FMCPHttpServer::HandleGetEventNodes);
     HttpRouter->BindRoute(FHttpPath("/blueprints/events"), EHttpServerRequestVerbs::VERB_GET, GetEventNodesDelegate);
     
     // GET /blueprints/event-graph - Get a specific event graph by name
-    auto GetEventGraphDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetEventGraph);
+    auto GetEventGraphDelegate = CreateHandler(&FMCPHttpServer::HandleGetEventGraph);
     HttpRouter->BindRoute(FHttpPath("/blueprints/event-graph"), EHttpServerRequestVerbs::VERB_GET, GetEventGraphDelegate);
     
     // GET /blueprints/references - Get references to and from a blueprint
-    auto GetBlueprintReferencesDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetBlueprintReferences);
+    auto GetBlueprintReferencesDelegate = CreateHandler(&FMCPHttpServer::HandleGetBlueprintReferences);
     HttpRouter->BindRoute(FHttpPath("/blueprints/references"), EHttpServerRequestVerbs::VERB_GET, GetBlueprintReferencesDelegate);
     
     // GET /docs - Get API documentation
-    auto GetDocumentationDelegate = FHttpRequestHandler::CreateStatic(&FMCPHttpServer::HandleGetDocumentation);
+    auto GetDocumentationDelegate = CreateHandler(&FMCPHttpServer::HandleGetDocumentation);
     HttpRouter->BindRoute(FHttpPath("/docs"), EHttpServerRequestVerbs::VERB_GET, GetDocumentationDelegate);
     
     UE_LOG(LogTemp, Log, TEXT("HTTP routes for Blueprint Analyzer registered on port %d"), Port);
@@ -86,6 +441,54 @@ void FMCPHttpServer::Shutdown()
     }
 }
 
+FHttpRequestHandler FMCPHttpServer::CreateHandler(bool (*Handler)(const FHttpServerRequest&, const FHttpResultCallback&))
+{
+    return FHttpRequestHandler::CreateLambda([Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        // Negotiate the content encoding once; every response of the handler goes through it
+        const TArray<FString>* AcceptEncodingValues = Request.Headers.Find(TEXT("Accept-Encoding"));
+        const EBlueprintContentEncoding Encoding = AcceptEncodingValues
+            ? FBlueprintResponseCompression::NegotiateEncoding(FString::Join(*AcceptEncodingValues, TEXT(",")))
+            : EBlueprintContentEncoding::Identity;
+        
+        return Handler(Request, [Encoding, OnComplete](TUniquePtr<FHttpServerResponse>&& Response)
+        {
+            CompleteWithEncoding(MoveTemp(Response), Encoding, OnComplete);
+        });
+    });
+}
+
+void FMCPHttpServer::CompleteWithEncoding(TUniquePtr<FHttpServerResponse>&& Response, EBlueprintContentEncoding Encoding, const FHttpResultCallback& OnComplete)
+{
+    const int32 RawBytes = Response->Body.Num();
+    Response->Headers.FindOrAdd(TEXT("Vary")).Add(TEXT("Accept-Encoding"));
+    
+    if (Encoding == EBlueprintContentEncoding::Identity || Response->Code != EHttpServerResponseCodes::Ok || !FBlueprintResponseCompression::ShouldCompress(RawBytes))
+    {
+        FBlueprintResponseCompression::RecordResponse(RawBytes, RawBytes, false, 0.0);
+        OnComplete(MoveTemp(Response));
+        return;
+    }
+    
+    // Compress on a worker so a multi-megabyte graph doesn't stall the editor, then complete on the game thread
+    Async(EAsyncExecution::ThreadPool, [Response = MoveTemp(Response), Encoding, OnComplete, RawBytes]() mutable
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        const bool bCompressed = FBlueprintResponseCompression::Compress(Response->Body, Encoding);
+        FBlueprintResponseCompression::RecordResponse(RawBytes, Response->Body.Num(), bCompressed, FPlatformTime::Seconds() - StartTime);
+        
+        if (bCompressed)
+        {
+            Response->Headers.Add(TEXT("Content-Encoding"), TArray<FString>{ FBlueprintResponseCompression::GetEncodingName(Encoding) });
+        }
+        
+        AsyncTask(ENamedThreads::GameThread, [Response = MoveTemp(Response), OnComplete]() mutable
+        {
+            OnComplete(MoveTemp(Response));
+        });
+    });
+}
+
 bool FMCPHttpServer::HandleListAllBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
     // Parse detail level from query parameters (default to Basic if not specified)
@@ -95,90 +498,712 @@ bool FMCPHttpServer::HandleListAllBlueprints(const FHttpServerRequest& Request,
     
     const TMap<FString, FString>& QueryParams = Request.QueryParams;
     
-    // Parse detail level
-    if (QueryParams.Contains(TEXT("detailLevel")))
+    // Parse detail level
+    if (QueryParams.Contains(TEXT("detailLevel")))
+    {
+        FString DetailLevelStr = QueryParams.FindChecked(TEXT("detailLevel"));
+        int32 DetailLevelValue = FCString::Atoi(*DetailLevelStr);
+        
+        // Convert string to enum (safely clamped to valid range)
+        DetailLevelValue = FMath::Clamp(DetailLevelValue, 0, 4);  // Updated to include Events level
+        DetailLevel = static_cast<EBlueprintDetailLevel>(DetailLevelValue);
+    }
+    
+    // Parse pagination parameters
+    if (QueryParams.Contains(TEXT("limit")))
+    {
+        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
+        Limit = FCString::Atoi(*LimitStr);
+        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+    }
+    
+    if (QueryParams.Contains(TEXT("offset")))
+    {
+        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
+        Offset = FCString::Atoi(*OffsetStr);
+        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+    }
+    
+    // Page over the catalog first so only the blueprints on the page are extracted
+    TArray<int32> EntryIds;
+    FBlueprintCatalog::GetAllEntryIds(EntryIds);
+    
+    // Total count before pagination
+    int32 TotalCount = EntryIds.Num();
+    
+    // Apply pagination if limit is specified
+    if (Limit > 0 && EntryIds.Num() > 0)
+    {
+        // Make sure offset is within range
+        Offset = FMath::Min(Offset, EntryIds.Num() - 1);
+        
+        // Calculate the end index
+        int32 EndIndex = FMath::Min(Offset + Limit, EntryIds.Num());
+        
+        EntryIds = TArray<int32>(EntryIds.GetData() + Offset, EndIndex - Offset);
+    }
+    
+    const EBlueprintWireFormat Format = GetResponseFormat(Request);
+    const FBlueprintSerializationOptions Options = GetSerializationOptions(Request);
+    
+    // A compact response shares one string table across all its blueprints, so it can't be assembled from fragments
+    if (Options.bCompactGraphs)
+    {
+        TArray<FBlueprintData> Blueprints;
+        for (TOptional<FBlueprintData>& BlueprintData : MCPHttpServer::ExtractEntries(EntryIds, DetailLevel))
+        {
+            if (BlueprintData.IsSet())
+            {
+                Blueprints.Add(MoveTemp(BlueprintData.GetValue()));
+            }
+        }
+        
+        OnComplete(CreateJsonResponseWithMetadata(Blueprints, TotalCount, Limit, Offset, true, Format, Options));
+        return true;
+    }
+    
+    // Unchanged blueprints come from the fragment cache, so a repeated listing is mostly copying bytes
+    const TArray<TSharedPtr<const TArray<uint8>>> Fragments = MCPHttpServer::GetFragments(EntryIds, DetailLevel, Format, Options);
+    
+    int32 Capacity = 256;
+    for (const TSharedPtr<const TArray<uint8>>& Fragment : Fragments)
+    {
+        Capacity += Fragment->Num() + 1;
+    }
+    
+    OnComplete(CreateEncodedResponse(MCPHttpServer::Encode(Format, [&](auto& Writer)
+    {
+        MCPHttpServer::WriteFragmentsWithMetadata(Writer, Fragments, TotalCount, Limit, Offset);
+    }, Capacity), Format));
+    return true;
+}
+
+bool FMCPHttpServer::HandleSearchBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString Query;
+    FString SearchType = TEXT("name");
+    int32 Limit = 0; // 0 means no limit
+    int32 Offset = 0;
+    
+    // Parse query string
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    // Identical requests within one catalog generation are answered from the result cache, which holds JSON only
+    const EBlueprintWireFormat Format = GetResponseFormat(Request);
+    const FString CacheKey = FBlueprintResultCache::MakeKey(TEXT("/blueprints/search"), QueryParams, MCPHttpServer::SearchDefaults);
+    if (Format == EBlueprintWireFormat::Json)
+    {
+        if (const TSharedPtr<const TArray<uint8>> CachedJson = FBlueprintResultCache::Find(CacheKey))
+        {
+            OnComplete(CreateJsonResponse(TArray<uint8>(*CachedJson)));
+            return true;
+        }
+    }
+    
+    if (QueryParams.Contains(TEXT("type")))
+    {
+        SearchType = QueryParams.FindChecked(TEXT("type"));
+    }
+    
+    // Signature searches are described by params/returns instead of a query string
+    if (QueryParams.Contains(TEXT("query")))
+    {
+        Query = QueryParams.FindChecked(TEXT("query"));
+    }
+    else if (SearchType != TEXT("signature"))
+    {
+        OnComplete(CreateErrorResponse(400, TEXT("Missing 'query' parameter")));
+        return true;
+    }
+    
+    // Parse pagination parameters
+    if (QueryParams.Contains(TEXT("limit")))
+    {
+        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
+        Limit = FCString::Atoi(*LimitStr);
+        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+    }
+    
+    if (QueryParams.Contains(TEXT("offset")))
+    {
+        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
+        Offset = FCString::Atoi(*OffsetStr);
+        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+    }
+    
+    // Parse detail level from query parameters (default to Basic if not specified)
+    EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic;
+    
+    if (QueryParams.Contains(TEXT("detailLevel")))
+    {
+        FString DetailLevelStr = QueryParams.FindChecked(TEXT("detailLevel"));
+        int32 DetailLevelValue = FCString::Atoi(*DetailLevelStr);
+        
+        // Convert string to enum (safely clamped to valid range)
+        DetailLevelValue = FMath::Clamp(DetailLevelValue, 0, 3);  // Updated to include Graph level
+        DetailLevel = static_cast<EBlueprintDetailLevel>(DetailLevelValue);
+    }
+    
+    // The searcher only hydrates the requested page, and may stop early if an estimated count is acceptable
+    FBlueprintSearchOptions Options;
+    Options.Offset = Offset;
+    Options.Limit = Limit;
+    
+    if (QueryParams.Contains(TEXT("exactCount")))
+    {
+        Options.bExactCount = QueryParams.FindChecked(TEXT("exactCount")).ToBool();
+    }
+    
+    // Perform the search based on search type
+    FBlueprintSearchResult Results;
+    
+    if (QueryParams.Contains(TEXT("mode")) && QueryParams.FindChecked(TEXT("mode")) == TEXT("regex"))
+    {
+        // In regex mode the type names the field the pattern is matched against
+        static const TMap<FString, EBlueprintSearchField> RegexFields = {
+            { TEXT("name"), EBlueprintSearchField::Name },
+            { TEXT("path"), EBlueprintSearchField::Path },
+            { TEXT("parentClass"), EBlueprintSearchField::ParentClass },
+            { TEXT("function"), EBlueprintSearchField::Function },
+            { TEXT("variable"), EBlueprintSearchField::Variable }
+        };
+        
+        const EBlueprintSearchField* Field = RegexFields.Find(SearchType);
+        if (!Field)
+        {
+            OnComplete(CreateErrorResponse(400, TEXT("Regex mode supports type name, path, parentClass, function or variable")));
+            return true;
+        }
+        
+        FString PatternError;
+        FBlueprintRegexLiterals Literals;
+        if (!FBlueprintRegex::ExtractLiterals(Query, Literals, PatternError))
+        {
+            OnComplete(CreateErrorResponse(400, FString::Printf(TEXT("Invalid regex: %s"), *PatternError)));
+            return true;
+        }
+        
+        Results = FBlueprintSearcher::SearchByRegex(*Field, Query, Literals, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("query"))
+    {
+        // Parse and plan the compound query
+        FString ParseError;
+        TSharedPtr<FBlueprintQueryNode> CompoundQuery = FBlueprintQuery::Parse(Query, ParseError);
+        if (!CompoundQuery.IsValid())
+        {
+            OnComplete(CreateErrorResponse(400, FString::Printf(TEXT("Invalid query: %s"), *ParseError)));
+            return true;
+        }
+        
+        FBlueprintQuery::Plan(CompoundQuery);
+        
+        // With explain=true return the chosen plan instead of running it
+        if (QueryParams.Contains(TEXT("explain")) && QueryParams.FindChecked(TEXT("explain")).ToBool())
+        {
+            TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+            RootObject->SetStringField(TEXT("query"), Query);
+            RootObject->SetObjectField(TEXT("plan"), FBlueprintQuery::Explain(CompoundQuery));
+            
+            OnComplete(CreateJsonResponse(RootObject, EBlueprintWireFormat::Json));
+            return true;
+        }
+        
+        Results = FBlueprintSearcher::SearchByQuery(CompoundQuery, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("ranked"))
+    {
+        // Ranked search only computes the top results needed for the requested page
+        Results = FBlueprintSearcher::SearchRanked(Query, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("name"))
+    {
+        Results = FBlueprintSearcher::SearchByName(Query, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("parentClass"))
+    {
+        Results = FBlueprintSearcher::SearchByParentClass(Query, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("function"))
+    {
+        // Optional positional parameter types narrow the functions matched by name
+        TArray<FString> ParamTypes;
+        if (QueryParams.Contains(TEXT("params")))
+        {
+            FBlueprintSignatureIndex::ParseTypeList(QueryParams.FindChecked(TEXT("params")), ParamTypes);
+        }
+        
+        Results = FBlueprintSearcher::SearchByFunction(Query, ParamTypes, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("signature"))
+    {
+        FBlueprintSignatureQuery SignatureQuery;
+        
+        if (QueryParams.Contains(TEXT("params")))
+        {
+            SignatureQuery.bMatchParams = true;
+            FBlueprintSignatureIndex::ParseTypeList(QueryParams.FindChecked(TEXT("params")), SignatureQuery.ParamTypes);
+        }
+        
+        if (QueryParams.Contains(TEXT("returns")))
+        {
+            SignatureQuery.bMatchReturns = true;
+            FBlueprintSignatureIndex::ParseTypeList(QueryParams.FindChecked(TEXT("returns")), SignatureQuery.ReturnTypes);
+        }
+        
+        if (!SignatureQuery.bMatchParams && !SignatureQuery.bMatchReturns)
+        {
+            OnComplete(CreateErrorResponse(400, TEXT("Signature search needs a 'params' and/or 'returns' parameter")));
+            return true;
+        }
+        
+        if (QueryParams.Contains(TEXT("pure")))
+        {
+            SignatureQuery.bPure = QueryParams.FindChecked(TEXT("pure")).ToBool();
+        }
+        
+        if (QueryParams.Contains(TEXT("event")))
+        {
+            SignatureQuery.bEvent = QueryParams.FindChecked(TEXT("event")).ToBool();
+        }
+        
+        Results = FBlueprintSearcher::SearchBySignature(SignatureQuery, DetailLevel, Options);
+    }
+    else if (SearchType == TEXT("variable"))
+    {
+        Results = FBlueprintSearcher::SearchByVariable(Query, FString(), DetailLevel, Options);
+    }
+    else
+    {
+        TMap<FString, FString> SearchParams;
+        SearchParams.Add(SearchType, Query);
+        Results = FBlueprintSearcher::SearchWithParameters(SearchParams, DetailLevel, Options);
+    }
+    
+    // Binary encodings are streamed straight from the results
+    if (Format != EBlueprintWireFormat::Json)
+    {
+        OnComplete(CreateJsonResponseWithMetadata(Results.Blueprints, Results.TotalCount, Limit, Offset, Results.bTotalCountExact, Format, GetSerializationOptions(Request)));
+        return true;
+    }
+    
+    // Create response with search results including pagination metadata; the cache keeps the encoded bytes
+    TArray<uint8> JsonBytes = SerializeWithMetadata(Results.Blueprints, Results.TotalCount, Limit, Offset, Results.bTotalCountExact, GetSerializationOptions(Request));
+    FBlueprintResultCache::Add(CacheKey, JsonBytes, MCPHttpServer::GetSourcePaths(Results.Blueprints, &FBlueprintData::Path));
+    OnComplete(CreateJsonResponse(MoveTemp(JsonBytes)));
+    return true;
+}
+
+bool FMCPHttpServer::HandleGrepBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString Query;
+    int32 Limit = 0; // 0 means no limit
+    int32 Offset = 0;
+    
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    // Identical requests within one catalog generation are answered from the result cache
+    const FString CacheKey = FBlueprintResultCache::MakeKey(TEXT("/blueprints/grep"), QueryParams, MCPHttpServer::PagingDefaults);
+    if (const TSharedPtr<const TArray<uint8>> CachedJson = FBlueprintResultCache::Find(CacheKey))
+    {
+        OnComplete(CreateJsonResponse(TArray<uint8>(*CachedJson)));
+        return true;
+    }
+    
+    if (QueryParams.Contains(TEXT("query")))
+    {
+        Query = QueryParams.FindChecked(TEXT("query"));
+    }
+    
+    if (Query.IsEmpty())
+    {
+        OnComplete(CreateErrorResponse(400, TEXT("Missing 'query' parameter")));
+        return true;
+    }
+    
+    // Parse pagination parameters
+    if (QueryParams.Contains(TEXT("limit")))
+    {
+        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
+        Limit = FCString::Atoi(*LimitStr);
+        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+    }
+    
+    if (QueryParams.Contains(TEXT("offset")))
+    {
+        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
+        Offset = FCString::Atoi(*OffsetStr);
+        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+    }
+    
+    // Search the indexed graph texts
+    TArray<FBlueprintGraphTextMatch> Matches = FBlueprintSearcher::SearchGraphText(Query);
+    
+    // Total count before pagination
+    int32 TotalCount = Matches.Num();
+    
+    // Calculate the page range
+    int32 StartIndex = FMath::Min(Offset, TotalCount);
+    int32 EndIndex = (Limit > 0) ? FMath::Min(StartIndex + Limit, TotalCount) : TotalCount;
+    
+    // Convert the page of matches to JSON
+    TArray<TSharedPtr<FJsonValue>> MatchesArray;
+    for (int32 i = StartIndex; i < EndIndex; ++i)
+    {
+        const FBlueprintGraphTextMatch& Match = Matches[i];
+        
+        TSharedPtr<FJsonObject> MatchObject = MakeShareable(new FJsonObject);
+        MatchObject->SetStringField(TEXT("blueprint"), Match.BlueprintName);
+        MatchObject->SetStringField(TEXT("path"), Match.BlueprintPath);
+        MatchObject->SetStringField(TEXT("graph"), Match.GraphName);
+        MatchObject->SetStringField(TEXT("nodeId"), Match.NodeId);
+        MatchObject->SetStringField(TEXT("nodeTitle"), Match.NodeTitle);
+        MatchObject->SetStringField(TEXT("field"), Match.Field);
+        
+        if (!Match.PinName.IsEmpty())
+        {
+            MatchObject->SetStringField(TEXT("pin"), Match.PinName);
+        }
+        
+        MatchObject->SetStringField(TEXT("text"), Match.Text);
+        
+        MatchesArray.Add(MakeShareable(new FJsonValueObject(MatchObject)));
+    }
+    
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetArrayField(TEXT("matches"), MatchesArray);
+    
+    // Add metadata
+    TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
+    MetadataObject->SetNumberField(TEXT("totalCount"), TotalCount);
+    MetadataObject->SetNumberField(TEXT("count"), MatchesArray.Num());
+    MetadataObject->SetNumberField(TEXT("limit"), Limit);
+    MetadataObject->SetNumberField(TEXT("offset"), Offset);
+    
+    RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
+    
+    // Encode straight to UTF-8; the cache keeps these bytes and answers hits with them unchanged
+    TArray<uint8> JsonBytes = MCPHttpServer::Encode(EBlueprintWireFormat::Json, [&RootObject](auto& Writer)
+    {
+        MCPHttpServer::WriteJsonObject(Writer, nullptr, RootObject);
+    });
+    
+    FBlueprintResultCache::Add(CacheKey, JsonBytes, MCPHttpServer::GetSourcePaths(Matches, &FBlueprintGraphTextMatch::BlueprintPath));
+    OnComplete(CreateJsonResponse(MoveTemp(JsonBytes)));
+    return true;
+}
+
+bool FMCPHttpServer::HandlePatternSearch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString PatternText;
+    int32 Limit = 0; // 0 means no limit
+    int32 Offset = 0;
+    
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    // Identical requests within one catalog generation are answered from the result cache
+    const FString CacheKey = FBlueprintResultCache::MakeKey(TEXT("/blueprints/pattern"), QueryParams, MCPHttpServer::PagingDefaults);
+    if (const TSharedPtr<const TArray<uint8>> CachedJson = FBlueprintResultCache::Find(CacheKey))
+    {
+        OnComplete(CreateJsonResponse(TArray<uint8>(*CachedJson)));
+        return true;
+    }
+    
+    if (QueryParams.Contains(TEXT("pattern")))
+    {
+        PatternText = QueryParams.FindChecked(TEXT("pattern"));
+    }
+    
+    if (PatternText.IsEmpty())
+    {
+        OnComplete(CreateErrorResponse(400, TEXT("Missing 'pattern' parameter")));
+        return true;
+    }
+    
+    FString ParseError;
+    TSharedPtr<FBlueprintGraphPattern> Pattern = FBlueprintPatternMatcher::Parse(PatternText, ParseError);
+    if (!Pattern.IsValid())
+    {
+        OnComplete(CreateErrorResponse(400, FString::Printf(TEXT("Invalid pattern: %s"), *ParseError)));
+        return true;
+    }
+    
+    // Parse pagination parameters
+    if (QueryParams.Contains(TEXT("limit")))
+    {
+        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
+        Limit = FCString::Atoi(*LimitStr);
+        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+    }
+    
+    if (QueryParams.Contains(TEXT("offset")))
+    {
+        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
+        Offset = FCString::Atoi(*OffsetStr);
+        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+    }
+    
+    // Match the pattern in every blueprint that has all of its node classes
+    TArray<FBlueprintPatternMatch> Matches = FBlueprintSearcher::SearchGraphPattern(*Pattern);
+    
+    // Total count before pagination
+    int32 TotalCount = Matches.Num();
+    
+    // Calculate the page range
+    int32 StartIndex = FMath::Min(Offset, TotalCount);
+    int32 EndIndex = (Limit > 0) ? FMath::Min(StartIndex + Limit, TotalCount) : TotalCount;
+    
+    // Convert the page of matches to JSON
+    TArray<TSharedPtr<FJsonValue>> MatchesArray;
+    for (int32 i = StartIndex; i < EndIndex; ++i)
+    {
+        const FBlueprintPatternMatch& Match = Matches[i];
+        
+        TSharedPtr<FJsonObject> MatchObject = MakeShareable(new FJsonObject);
+        MatchObject->SetStringField(TEXT("blueprint"), Match.BlueprintName);
+        MatchObject->SetStringField(TEXT("path"), Match.BlueprintPath);
+        MatchObject->SetStringField(TEXT("graph"), Match.GraphName);
+        
+        TArray<TSharedPtr<FJsonValue>> NodeIdsArray;
+        TArray<TSharedPtr<FJsonValue>> NodeTitlesArray;
+        for (int32 NodeIndex = 0; NodeIndex < Match.NodeIds.Num(); ++NodeIndex)
+        {
+            NodeIdsArray.Add(MakeShareable(new FJsonValueString(Match.NodeIds[NodeIndex])));
+            NodeTitlesArray.Add(MakeShareable(new FJsonValueString(Match.NodeTitles[NodeIndex])));
+        }
+        
+        MatchObject->SetArrayField(TEXT("nodeIds"), NodeIdsArray);
+        MatchObject->SetArrayField(TEXT("nodeTitles"), NodeTitlesArray);
+        
+        MatchesArray.Add(MakeShareable(new FJsonValueObject(MatchObject)));
+    }
+    
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetStringField(TEXT("pattern"), PatternText);
+    RootObject->SetArrayField(TEXT("matches"), MatchesArray);
+    
+    // Add metadata
+    TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
+    MetadataObject->SetNumberField(TEXT("totalCount"), TotalCount);
+    MetadataObject->SetNumberField(TEXT("count"), MatchesArray.Num());
+    MetadataObject->SetNumberField(TEXT("limit"), Limit);
+    MetadataObject->SetNumberField(TEXT("offset"), Offset);
+    
+    RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
+    
+    // Encode straight to UTF-8; the cache keeps these bytes and answers hits with them unchanged
+    TArray<uint8> JsonBytes = MCPHttpServer::Encode(EBlueprintWireFormat::Json, [&RootObject](auto& Writer)
+    {
+        MCPHttpServer::WriteJsonObject(Writer, nullptr, RootObject);
+    });
+    
+    FBlueprintResultCache::Add(CacheKey, JsonBytes, MCPHttpServer::GetSourcePaths(Matches, &FBlueprintPatternMatch::BlueprintPath));
+    OnComplete(CreateJsonResponse(MoveTemp(JsonBytes)));
+    return true;
+}
+
+bool FMCPHttpServer::HandleFindUsages(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString NodeClass, EventName;
+    int32 Limit = 0; // 0 means no limit
+    int32 Offset = 0;
+    
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    // Identical requests within one catalog generation are answered from the result cache
+    const FString CacheKey = FBlueprintResultCache::MakeKey(TEXT("/blueprints/usages"), QueryParams, MCPHttpServer::PagingDefaults);
+    if (const TSharedPtr<const TArray<uint8>> CachedJson = FBlueprintResultCache::Find(CacheKey))
+    {
+        OnComplete(CreateJsonResponse(TArray<uint8>(*CachedJson)));
+        return true;
+    }
+    
+    if (QueryParams.Contains(TEXT("nodeClass")))
+    {
+        NodeClass = QueryParams.FindChecked(TEXT("nodeClass"));
+    }
+    
+    if (QueryParams.Contains(TEXT("event")))
+    {
+        EventName = QueryParams.FindChecked(TEXT("event"));
+    }
+    
+    if (NodeClass.IsEmpty() == EventName.IsEmpty())
+    {
+        OnComplete(CreateErrorResponse(400, TEXT("Specify exactly one of the 'nodeClass' and 'event' parameters")));
+        return true;
+    }
+    
+    // Parse pagination parameters
+    if (QueryParams.Contains(TEXT("limit")))
+    {
+        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
+        Limit = FCString::Atoi(*LimitStr);
+        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+    }
+    
+    if (QueryParams.Contains(TEXT("offset")))
+    {
+        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
+        Offset = FCString::Atoi(*OffsetStr);
+        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+    }
+    
+    // Answered from the catalog's posting lists, no per-blueprint graph extraction
+    TArray<FBlueprintGraphUsage> Usages = NodeClass.IsEmpty()
+        ? FBlueprintSearcher::FindEventImplementations(EventName)
+        : FBlueprintSearcher::FindNodeClassUsages(NodeClass);
+    
+    // Total count before pagination
+    int32 TotalCount = Usages.Num();
+    
+    // Calculate the page range
+    int32 StartIndex = FMath::Min(Offset, TotalCount);
+    int32 EndIndex = (Limit > 0) ? FMath::Min(StartIndex + Limit, TotalCount) : TotalCount;
+    
+    // Convert the page of usages to JSON
+    TArray<TSharedPtr<FJsonValue>> MatchesArray;
+    for (int32 i = StartIndex; i < EndIndex; ++i)
+    {
+        const FBlueprintGraphUsage& Usage = Usages[i];
+        
+        TSharedPtr<FJsonObject> MatchObject = MakeShareable(new FJsonObject);
+        MatchObject->SetStringField(TEXT("blueprint"), Usage.BlueprintName);
+        MatchObject->SetStringField(TEXT("path"), Usage.BlueprintPath);
+        
+        TArray<TSharedPtr<FJsonValue>> GraphsArray;
+        for (const FString& GraphName : Usage.GraphNames)
+        {
+            GraphsArray.Add(MakeShareable(new FJsonValueString(GraphName)));
+        }
+        MatchObject->SetArrayField(TEXT("graphs"), GraphsArray);
+        
+        MatchesArray.Add(MakeShareable(new FJsonValueObject(MatchObject)));
+    }
+    
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    if (NodeClass.IsEmpty())
+    {
+        RootObject->SetStringField(TEXT("event"), EventName);
+    }
+    else
+    {
+        RootObject->SetStringField(TEXT("nodeClass"), NodeClass);
+    }
+    RootObject->SetArrayField(TEXT("matches"), MatchesArray);
+    
+    // Add metadata
+    TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
+    MetadataObject->SetNumberField(TEXT("totalCount"), TotalCount);
+    MetadataObject->SetNumberField(TEXT("count"), MatchesArray.Num());
+    MetadataObject->SetNumberField(TEXT("limit"), Limit);
+    MetadataObject->SetNumberField(TEXT("offset"), Offset);
+    
+    RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
+    
+    // Encode straight to UTF-8; the cache keeps these bytes and answers hits with them unchanged
+    TArray<uint8> JsonBytes = MCPHttpServer::Encode(EBlueprintWireFormat::Json, [&RootObject](auto& Writer)
+    {
+        MCPHttpServer::WriteJsonObject(Writer, nullptr, RootObject);
+    });
+    
+    FBlueprintResultCache::Add(CacheKey, JsonBytes, MCPHttpServer::GetSourcePaths(Usages, &FBlueprintGraphUsage::BlueprintPath));
+    OnComplete(CreateJsonResponse(MoveTemp(JsonBytes)));
+    return true;
+}
+
+bool FMCPHttpServer::HandleComplete(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString Prefix;
+    int32 MaxResults = 10;
+    TOptional<EBlueprintCompletionKind> Kind;
+    
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    if (QueryParams.Contains(TEXT("prefix")))
     {
-        FString DetailLevelStr = QueryParams.FindChecked(TEXT("detailLevel"));
-        int32 DetailLevelValue = FCString::Atoi(*DetailLevelStr);
-        
-        // Convert string to enum (safely clamped to valid range)
-        DetailLevelValue = FMath::Clamp(DetailLevelValue, 0, 4);  // Updated to include Events level
-        DetailLevel = static_cast<EBlueprintDetailLevel>(DetailLevelValue);
+        Prefix = QueryParams.FindChecked(TEXT("prefix"));
     }
-    
-    // Parse pagination parameters
-    if (QueryParams.Contains(TEXT("limit")))
+    else
     {
-        FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
-        Limit = FCString::Atoi(*LimitStr);
-        Limit = FMath::Max(0, Limit); // Ensure limit is non-negative
+        OnComplete(CreateErrorResponse(400, TEXT("Missing 'prefix' parameter")));
+        return true;
     }
     
-    if (QueryParams.Contains(TEXT("offset")))
+    if (QueryParams.Contains(TEXT("k")))
     {
-        FString OffsetStr = QueryParams.FindChecked(TEXT("offset"));
-        Offset = FCString::Atoi(*OffsetStr);
-        Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
+        FString KStr = QueryParams.FindChecked(TEXT("k"));
+        MaxResults = FMath::Clamp(FCString::Atoi(*KStr), 1, 1000);
     }
     
-    // Get all blueprints with the specified detail level
-    TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(DetailLevel);
+    // Kind names in the same order as EBlueprintCompletionKind
+    static const TCHAR* KindNames[] = { TEXT("name"), TEXT("path"), TEXT("function"), TEXT("event") };
     
-    // Total count before pagination
-    int32 TotalCount = AllBlueprints.Num();
-    
-    // Apply pagination if limit is specified
-    if (Limit > 0 && AllBlueprints.Num() > 0)
+    if (QueryParams.Contains(TEXT("kind")))
     {
-        // Make sure offset is within range
-        Offset = FMath::Min(Offset, AllBlueprints.Num() - 1);
-        
-        // Calculate the end index
-        int32 EndIndex = (Limit > 0) ? FMath::Min(Offset + Limit, AllBlueprints.Num()) : AllBlueprints.Num();
+        const FString& KindStr = QueryParams.FindChecked(TEXT("kind"));
+        for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(KindNames); ++KindIndex)
+        {
+            if (KindStr == KindNames[KindIndex])
+            {
+                Kind = static_cast<EBlueprintCompletionKind>(KindIndex);
+            }
+        }
         
-        // Create a new array with only the selected range
-        TArray<FBlueprintData> PaginatedBlueprints;
-        for (int32 i = Offset; i < EndIndex; ++i)
+        if (!Kind.IsSet())
         {
-            PaginatedBlueprints.Add(AllBlueprints[i]);
+            OnComplete(CreateErrorResponse(400, TEXT("Invalid 'kind' parameter (expected name, path, function or event)")));
+            return true;
         }
+    }
+    
+    // Best-first walk of the catalog's completion trie, no scan
+    TArray<FBlueprintCompletion> Completions;
+    FBlueprintCatalog::Complete(Prefix, MaxResults, Kind, Completions);
+    
+    TArray<TSharedPtr<FJsonValue>> CompletionsArray;
+    for (const FBlueprintCompletion& Completion : Completions)
+    {
+        TSharedPtr<FJsonObject> CompletionObject = MakeShareable(new FJsonObject);
+        CompletionObject->SetStringField(TEXT("text"), Completion.Text);
+        CompletionObject->SetStringField(TEXT("kind"), KindNames[static_cast<int32>(Completion.Kind)]);
+        CompletionObject->SetNumberField(TEXT("score"), Completion.Score);
         
-        // Replace the original array with the paginated one
-        AllBlueprints = PaginatedBlueprints;
+        CompletionsArray.Add(MakeShareable(new FJsonValueObject(CompletionObject)));
     }
     
-    // Create response with pagination metadata
-    OnComplete(CreateJsonResponseWithMetadata(AllBlueprints, TotalCount, Limit, Offset));
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetStringField(TEXT("prefix"), Prefix);
+    RootObject->SetArrayField(TEXT("completions"), CompletionsArray);
+    
+    // Encoded straight to the negotiated format
+    OnComplete(CreateJsonResponse(RootObject, GetResponseFormat(Request)));
     return true;
 }
 
-bool FMCPHttpServer::HandleSearchBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+bool FMCPHttpServer::HandleGetTree(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
     // Extract query parameters
-    FString Query;
-    FString SearchType = TEXT("name");
+    FString Path = TEXT("/Game");
     int32 Limit = 0; // 0 means no limit
     int32 Offset = 0;
     
-    // Parse query string
     const TMap<FString, FString>& QueryParams = Request.QueryParams;
     
-    if (QueryParams.Contains(TEXT("query")))
-    {
-        Query = QueryParams.FindChecked(TEXT("query"));
-    }
-    else
-    {
-        OnComplete(CreateErrorResponse(400, TEXT("Missing 'query' parameter")));
-        return true;
-    }
-    
-    if (QueryParams.Contains(TEXT("type")))
+    if (QueryParams.Contains(TEXT("path")))
     {
-        SearchType = QueryParams.FindChecked(TEXT("type"));
+        Path = QueryParams.FindChecked(TEXT("path")).TrimStartAndEnd();
     }
     
-    // Parse pagination parameters
     if (QueryParams.Contains(TEXT("limit")))
     {
         FString LimitStr = QueryParams.FindChecked(TEXT("limit"));
@@ -193,70 +1218,202 @@ bool FMCPHttpServer::HandleSearchBlueprints(const FHttpServerRequest& Request, c
         Offset = FMath::Max(0, Offset); // Ensure offset is non-negative
     }
     
-    // Parse detail level from query parameters (default to Basic if not specified)
-    EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic;
+    // Read straight from the catalog's folder tree, the counts are already aggregated
+    FBlueprintFolderListing Listing;
+    if (!FBlueprintCatalog::GetFolderListing(Path, Listing))
+    {
+        OnComplete(CreateErrorResponse(404, FString::Printf(TEXT("No blueprints found in folder: %s"), *Path)));
+        return true;
+    }
     
-    if (QueryParams.Contains(TEXT("detailLevel")))
+    TArray<TSharedPtr<FJsonValue>> FoldersArray;
+    for (const FBlueprintFolderInfo& Subfolder : Listing.Subfolders)
     {
-        FString DetailLevelStr = QueryParams.FindChecked(TEXT("detailLevel"));
-        int32 DetailLevelValue = FCString::Atoi(*DetailLevelStr);
+        TSharedPtr<FJsonObject> FolderObject = MakeShareable(new FJsonObject);
+        FolderObject->SetStringField(TEXT("name"), Subfolder.Name);
+        FolderObject->SetStringField(TEXT("path"), Subfolder.Path);
+        FolderObject->SetNumberField(TEXT("blueprintCount"), Subfolder.BlueprintCount);
+        FolderObject->SetNumberField(TEXT("nodeCount"), Subfolder.NodeCount);
+        FolderObject->SetNumberField(TEXT("blueprintsWithGraphData"), Subfolder.BlueprintsWithGraphData);
         
-        // Convert string to enum (safely clamped to valid range)
-        DetailLevelValue = FMath::Clamp(DetailLevelValue, 0, 3);  // Updated to include Graph level
-        DetailLevel = static_cast<EBlueprintDetailLevel>(DetailLevelValue);
+        FoldersArray.Add(MakeShareable(new FJsonValueObject(FolderObject)));
     }
     
-    // Perform the search based on search type
-    TArray<FBlueprintData> Results;
+    // Direct blueprints by name; only this folder's entries are touched
+    TArray<const FBlueprintCatalogEntry*> DirectEntries;
+    for (int32 EntryId : Listing.EntryIds)
+    {
+        if (const FBlueprintCatalogEntry* Entry = FBlueprintCatalog::GetEntry(EntryId))
+        {
+            DirectEntries.Add(Entry);
+        }
+    }
+    DirectEntries.Sort([](const FBlueprintCatalogEntry& A, const FBlueprintCatalogEntry& B)
+    {
+        return A.Data.Name < B.Data.Name;
+    });
     
-    if (SearchType == TEXT("name"))
+    // Total count before pagination
+    int32 TotalCount = DirectEntries.Num();
+    
+    // Calculate the page range
+    int32 StartIndex = FMath::Min(Offset, TotalCount);
+    int32 EndIndex = (Limit > 0) ? FMath::Min(StartIndex + Limit, TotalCount) : TotalCount;
+    
+    TArray<TSharedPtr<FJsonValue>> BlueprintsArray;
+    for (int32 i = StartIndex; i < EndIndex; ++i)
     {
-        Results = FBlueprintSearcher::SearchByName(Query, DetailLevel);
+        const FBlueprintCatalogEntry& Entry = *DirectEntries[i];
+        
+        TSharedPtr<FJsonObject> BlueprintObject = MakeShareable(new FJsonObject);
+        BlueprintObject->SetStringField(TEXT("name"), Entry.Data.Name);
+        BlueprintObject->SetStringField(TEXT("path"), Entry.Data.Path);
+        BlueprintObject->SetStringField(TEXT("parentClass"), Entry.Data.ParentClass);
+        
+        // Node counts are only known once the blueprint's graphs have been summarized
+        if (Entry.bHasMemberData)
+        {
+            int32 NodeCount = 0;
+            for (const FBlueprintGraphSummary& Summary : Entry.GraphSummaries)
+            {
+                NodeCount += Summary.Nodes.Num();
+            }
+            BlueprintObject->SetNumberField(TEXT("nodeCount"), NodeCount);
+        }
+        
+        BlueprintsArray.Add(MakeShareable(new FJsonValueObject(BlueprintObject)));
     }
-    else if (SearchType == TEXT("parentClass"))
+    
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetStringField(TEXT("path"), Listing.Folder.Path);
+    RootObject->SetNumberField(TEXT("blueprintCount"), Listing.Folder.BlueprintCount);
+    RootObject->SetNumberField(TEXT("nodeCount"), Listing.Folder.NodeCount);
+    RootObject->SetNumberField(TEXT("blueprintsWithGraphData"), Listing.Folder.BlueprintsWithGraphData);
+    RootObject->SetArrayField(TEXT("folders"), FoldersArray);
+    RootObject->SetArrayField(TEXT("blueprints"), BlueprintsArray);
+    
+    // Add metadata
+    TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
+    MetadataObject->SetNumberField(TEXT("totalCount"), TotalCount);
+    MetadataObject->SetNumberField(TEXT("count"), BlueprintsArray.Num());
+    MetadataObject->SetNumberField(TEXT("limit"), Limit);
+    MetadataObject->SetNumberField(TEXT("offset"), Offset);
+    
+    RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
+    
+    // Encoded straight to the negotiated format
+    OnComplete(CreateJsonResponse(RootObject, GetResponseFormat(Request)));
+    return true;
+}
+
+bool FMCPHttpServer::HandleGetTop(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    // Extract query parameters
+    FString MetricStr = TEXT("nodes");
+    int32 MaxResults = 50;
+    
+    const TMap<FString, FString>& QueryParams = Request.QueryParams;
+    
+    if (QueryParams.Contains(TEXT("metric")))
     {
-        Results = FBlueprintSearcher::SearchByParentClass(Query, DetailLevel);
+        MetricStr = QueryParams.FindChecked(TEXT("metric"));
     }
-    else if (SearchType == TEXT("function"))
+    
+    if (QueryParams.Contains(TEXT("k")))
     {
-        Results = FBlueprintSearcher::SearchByFunction(Query, TArray<FString>(), DetailLevel);
+        FString KStr = QueryParams.FindChecked(TEXT("k"));
+        MaxResults = FMath::Clamp(FCString::Atoi(*KStr), 1, 1000);
     }
-    else if (SearchType == TEXT("variable"))
+    
+    // Metric names in the same order as EBlueprintLeaderboardMetric
+    static const TCHAR* MetricNames[] = { TEXT("nodes"), TEXT("graphs"), TEXT("variables"), TEXT("references"), TEXT("size") };
+    static_assert(UE_ARRAY_COUNT(MetricNames) == static_cast<int32>(EBlueprintLeaderboardMetric::Count), "Metric names out of sync with EBlueprintLeaderboardMetric");
+    
+    TOptional<EBlueprintLeaderboardMetric> Metric;
+    for (int32 MetricIndex = 0; MetricIndex < UE_ARRAY_COUNT(MetricNames); ++MetricIndex)
     {
-        Results = FBlueprintSearcher::SearchByVariable(Query, FString(), DetailLevel);
+        if (MetricStr == MetricNames[MetricIndex])
+        {
+            Metric = static_cast<EBlueprintLeaderboardMetric>(MetricIndex);
+        }
     }
-    else
+    
+    if (!Metric.IsSet())
     {
-        TMap<FString, FString> SearchParams;
-        SearchParams.Add(SearchType, Query);
-        Results = FBlueprintSearcher::SearchWithParameters(SearchParams, DetailLevel);
+        OnComplete(CreateErrorResponse(400, TEXT("Invalid 'metric' parameter (expected nodes, graphs, variables, references or size)")));
+        return true;
     }
     
-    // Total count before pagination
-    int32 TotalCount = Results.Num();
+    TArray<FBlueprintTopEntry> TopEntries = FBlueprintSearcher::GetTopBlueprints(Metric.GetValue(), MaxResults);
     
-    // Apply pagination if limit is specified
-    if (Limit > 0 && Results.Num() > 0)
+    TArray<TSharedPtr<FJsonValue>> BlueprintsArray;
+    for (int32 i = 0; i < TopEntries.Num(); ++i)
     {
-        // Make sure offset is within range
-        Offset = FMath::Min(Offset, Results.Num() - 1);
-        
-        // Calculate the end index
-        int32 EndIndex = (Limit > 0) ? FMath::Min(Offset + Limit, Results.Num()) : Results.Num();
+        const FBlueprintTopEntry& TopEntry = TopEntries[i];
         
-        // Create a new array with only the selected range
-        TArray<FBlueprintData> PaginatedResults;
-        for (int32 i = Offset; i < EndIndex; ++i)
-        {
-            PaginatedResults.Add(Results[i]);
-        }
+        TSharedPtr<FJsonObject> BlueprintObject = MakeShareable(new FJsonObject);
+        BlueprintObject->SetNumberField(TEXT("rank"), i + 1);
+        BlueprintObject->SetStringField(TEXT("name"), TopEntry.BlueprintName);
+        BlueprintObject->SetStringField(TEXT("path"), TopEntry.BlueprintPath);
+        BlueprintObject->SetNumberField(TEXT("value"), TopEntry.Value);
         
-        // Replace the original array with the paginated one
-        Results = PaginatedResults;
+        BlueprintsArray.Add(MakeShareable(new FJsonValueObject(BlueprintObject)));
     }
     
-    // Create response with search results including pagination metadata
-    OnComplete(CreateJsonResponseWithMetadata(Results, TotalCount, Limit, Offset));
+    // Create root object
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetStringField(TEXT("metric"), MetricNames[static_cast<int32>(Metric.GetValue())]);
+    RootObject->SetArrayField(TEXT("blueprints"), BlueprintsArray);
+    
+    // Encoded straight to the negotiated format
+    OnComplete(CreateJsonResponse(RootObject, GetResponseFormat(Request)));
+    return true;
+}
+
+bool FMCPHttpServer::HandleGetCacheStats(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    const FBlueprintResultCacheStats Stats = FBlueprintResultCache::GetStats();
+    const int64 Lookups = Stats.Hits + Stats.Misses;
+    
+    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
+    RootObject->SetNumberField(TEXT("hits"), Stats.Hits);
+    RootObject->SetNumberField(TEXT("misses"), Stats.Misses);
+    RootObject->SetNumberField(TEXT("hitRate"), Lookups > 0 ? static_cast<double>(Stats.Hits) / Lookups : 0.0);
+    RootObject->SetNumberField(TEXT("invalidations"), Stats.Invalidations);
+    RootObject->SetNumberField(TEXT("entries"), Stats.NumEntries);
+    RootObject->SetNumberField(TEXT("capacity"), Stats.Capacity);
+    RootObject->SetNumberField(TEXT("generation"), static_cast<double>(Stats.Generation));
+    
+    // Response sizes before and after content encoding
+    const FBlueprintCompressionStats CompressionStats = FBlueprintResponseCompression::GetStats();
+    TSharedPtr<FJsonObject> CompressionObject = MakeShareable(new FJsonObject);
+    CompressionObject->SetNumberField(TEXT("responses"), CompressionStats.Responses);
+    CompressionObject->SetNumberField(TEXT("compressedResponses"), CompressionStats.CompressedResponses);
+    CompressionObject->SetNumberField(TEXT("rawBytes"), CompressionStats.RawBytes);
+    CompressionObject->SetNumberField(TEXT("sentBytes"), CompressionStats.SentBytes);
+    CompressionObject->SetNumberField(TEXT("compressedRawBytes"), CompressionStats.CompressedRawBytes);
+    CompressionObject->SetNumberField(TEXT("compressedBytes"), CompressionStats.CompressedBytes);
+    CompressionObject->SetNumberField(TEXT("compressionRatio"),
+        CompressionStats.CompressedBytes > 0 ? static_cast<double>(CompressionStats.CompressedRawBytes) / CompressionStats.CompressedBytes : 0.0);
+    CompressionObject->SetNumberField(TEXT("compressMilliseconds"), CompressionStats.CompressSeconds * 1000.0);
+    CompressionObject->SetNumberField(TEXT("minCompressBytes"), FBlueprintResponseCompression::MinCompressBytes);
+    RootObject->SetObjectField(TEXT("compression"), CompressionObject);
+    
+    // Serialized blueprints reused by /blueprints/all
+    const FBlueprintFragmentCacheStats FragmentStats = FBlueprintFragmentCache::GetStats();
+    const int64 FragmentLookups = FragmentStats.Hits + FragmentStats.Misses;
+    TSharedPtr<FJsonObject> FragmentsObject = MakeShareable(new FJsonObject);
+    FragmentsObject->SetNumberField(TEXT("hits"), FragmentStats.Hits);
+    FragmentsObject->SetNumberField(TEXT("misses"), FragmentStats.Misses);
+    FragmentsObject->SetNumberField(TEXT("hitRate"), FragmentLookups > 0 ? static_cast<double>(FragmentStats.Hits) / FragmentLookups : 0.0);
+    FragmentsObject->SetNumberField(TEXT("entries"), FragmentStats.NumEntries);
+    FragmentsObject->SetNumberField(TEXT("bytes"), FragmentStats.NumBytes);
+    FragmentsObject->SetNumberField(TEXT("maxBytes"), FragmentStats.MaxBytes);
+    RootObject->SetObjectField(TEXT("fragments"), FragmentsObject);
+    
+    // Encoded straight to the negotiated format
+    OnComplete(CreateJsonResponse(RootObject, GetResponseFormat(Request)));
     return true;
 }
 
@@ -353,6 +1510,8 @@ bool FMCPHttpServer::HandleGetBlueprintByPath(const FHttpServerRequest& Request,
                 Blueprint.Graphs = FilteredGraphs;
             }
             
+            const int32 MatchingGraphCount = Blueprint.Graphs.Num();
+            
             // Apply graph pagination
             if (Blueprint.Graphs.Num() > 0)
             {
@@ -407,34 +1566,23 @@ bool FMCPHttpServer::HandleGetBlueprintByPath(const FHttpServerRequest& Request,
                             
                             Graph.Connections = FilteredConnections;
                             
-                            // Add node pagination metadata to the graph
-                            TSharedPtr<FJsonObject> NodePaginationMetadata = MakeShareable(new FJsonObject);
-                            NodePaginationMetadata->SetNumberField(TEXT("totalNodes"), TotalNodeCount);
-                            NodePaginationMetadata->SetNumberField(TEXT("returnedNodes"), Graph.Nodes.Num());
-                            NodePaginationMetadata->SetNumberField(TEXT("maxNodes"), MaxNodesPerGraph);
-                            
-                            FString MetadataJson;
-                            TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&MetadataJson);
-                            FJsonSerializer::Serialize(NodePaginationMetadata.ToSharedRef(), JsonWriter);
-                            
-                            Graph.Metadata.Add(TEXT("pagination"), MetadataJson);
+                            // Add node pagination to the graph
+                            FBlueprintNodePagination& NodePagination = Graph.Pagination.Emplace();
+                            NodePagination.TotalNodes = TotalNodeCount;
+                            NodePagination.ReturnedNodes = Graph.Nodes.Num();
+                            NodePagination.MaxNodes = MaxNodesPerGraph;
                         }
                     }
                 }
             }
             
-            // Add graph pagination metadata to the blueprint
-            TSharedPtr<FJsonObject> GraphPaginationMetadata = MakeShareable(new FJsonObject);
-            GraphPaginationMetadata->SetNumberField(TEXT("totalGraphs"), TotalGraphCount);
-            GraphPaginationMetadata->SetNumberField(TEXT("returnedGraphs"), Blueprint.Graphs.Num());
-            GraphPaginationMetadata->SetNumberField(TEXT("maxGraphs"), MaxGraphs);
-            GraphPaginationMetadata->SetNumberField(TEXT("graphOffset"), GraphOffset);
-            
-            FString MetadataJson;
-            TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&MetadataJson);
-            FJsonSerializer::Serialize(GraphPaginationMetadata.ToSharedRef(), JsonWriter);
-            
-            Blueprint.Metadata.Add(TEXT("graphPagination"), MetadataJson);
+            // Add graph pagination to the blueprint
+            FBlueprintGraphPagination& GraphPagination = Blueprint.GraphPagination.Emplace();
+            GraphPagination.TotalGraphs = TotalGraphCount;
+            GraphPagination.ReturnedGraphs = Blueprint.Graphs.Num();
+            GraphPagination.MaxGraphs = MaxGraphs;
+            GraphPagination.GraphOffset = GraphOffset;
+            GraphPagination.HasMore = GraphOffset + Blueprint.Graphs.Num() < MatchingGraphCount;
         }
         
         // Create array with single blueprint
@@ -442,7 +1590,7 @@ bool FMCPHttpServer::HandleGetBlueprintByPath(const FHttpServerRequest& Request,
         BlueprintArray.Add(Blueprint);
         
         // Create response with blueprint data
-        OnComplete(CreateJsonResponse(BlueprintArray));
+        OnComplete(CreateJsonResponse(BlueprintArray, GetResponseFormat(Request), GetSerializationOptions(Request)));
     }
     else
     {
@@ -521,7 +1669,7 @@ bool FMCPHttpServer::HandleGetFunctionGraph(const FHttpServerRequest& Request, c
     BlueprintArray.Add(FunctionBlueprint);
     
     // Create response with blueprint data
-    OnComplete(CreateJsonResponse(BlueprintArray));
+    OnComplete(CreateJsonResponse(BlueprintArray, GetResponseFormat(Request), GetSerializationOptions(Request)));
     return true;
 }
 
@@ -575,37 +1723,22 @@ bool FMCPHttpServer::HandleGetNodesByType(const FHttpServerRequest& Request, con
         FBlueprintGraphData FilteredGraph = Graph;
         FilteredGraph.Nodes.Empty();
         
-        // Filter nodes of the specified type
+        // Filter nodes of the specified type, remembering their ids for the connection filter
+        TSet<FString> IncludedNodeIds;
         for (const FBlueprintNodeData& Node : Graph.Nodes)
         {
             if (Node.NodeType.Contains(NodeType))
             {
                 FilteredGraph.Nodes.Add(Node);
+                IncludedNodeIds.Add(Node.NodeId);
             }
         }
         
-        // Filter connections to only include those connected to the filtered nodes
+        // Only include connections where both source and target nodes are included
         FilteredGraph.Connections.Empty();
         for (const FBlueprintConnectionData& Connection : Graph.Connections)
         {
-            bool SourceNodeIncluded = false;
-            bool TargetNodeIncluded = false;
-            
-            // Check if source and target nodes are included in the filtered nodes
-            for (const FBlueprintNodeData& Node : FilteredGraph.Nodes)
-            {
-                if (Node.NodeId == Connection.SourceNodeId)
-                {
-                    SourceNodeIncluded = true;
-                }
-                if (Node.NodeId == Connection.TargetNodeId)
-                {
-                    TargetNodeIncluded = true;
-                }
-            }
-            
-            // Only include connections where both source and target nodes are included
-            if (SourceNodeIncluded && TargetNodeIncluded)
+            if (IncludedNodeIds.Contains(Connection.SourceNodeId) && IncludedNodeIds.Contains(Connection.TargetNodeId))
             {
                 FilteredGraph.Connections.Add(Connection);
             }
@@ -623,7 +1756,7 @@ bool FMCPHttpServer::HandleGetNodesByType(const FHttpServerRequest& Request, con
     BlueprintArray.Add(FilteredBlueprint);
     
     // Create response with blueprint data
-    OnComplete(CreateJsonResponse(BlueprintArray));
+    OnComplete(CreateJsonResponse(BlueprintArray, GetResponseFormat(Request), GetSerializationOptions(Request)));
     return true;
 }
 
@@ -659,8 +1792,23 @@ bool FMCPHttpServer::HandleGetDocumentation(const FHttpServerRequest& Request, c
 
 TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(const FString& JsonContent)
 {
-    // In UE 5.5, we need to use the FHttpServerResponse::Create method
-    TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(JsonContent, TEXT("application/json"));
+    // Transcode once into the body instead of letting the response make its own converted copy
+    TArray<uint8> JsonBytes;
+    JsonBytes.Reserve(JsonContent.Len());
+    FBlueprintUtf8JsonWriter::AppendUtf8(JsonBytes, JsonContent);
+    
+    return CreateJsonResponse(MoveTemp(JsonBytes));
+}
+
+TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(TArray<uint8>&& JsonBytes)
+{
+    return CreateEncodedResponse(MoveTemp(JsonBytes), EBlueprintWireFormat::Json);
+}
+
+TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateEncodedResponse(TArray<uint8>&& Body, EBlueprintWireFormat Format)
+{
+    // The body is moved into the response, not copied
+    TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Body), FBlueprintBinaryWriter::GetContentType(Format));
     
     // Set the response code
     Response->Code = EHttpServerResponseCodes::Ok;
@@ -669,43 +1817,62 @@ TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(const FString
     Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), TArray<FString>{TEXT("*")});
     Response->Headers.Add(TEXT("Access-Control-Allow-Methods"), TArray<FString>{TEXT("GET, OPTIONS")});
     Response->Headers.Add(TEXT("Access-Control-Allow-Headers"), TArray<FString>{TEXT("Content-Type, Authorization")});
+    Response->Headers.Add(TEXT("Vary"), TArray<FString>{TEXT("Accept")});
     
     return Response;
 }
 
-TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(const TArray<FBlueprintData>& BlueprintsData)
+TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(const TArray<FBlueprintData>& BlueprintsData, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options)
+{
+    // Stream straight to the wire encoding so graph-sized responses never exist as UTF-16
+    return CreateEncodedResponse(MCPHttpServer::Encode(Format, [&BlueprintsData, &Options](auto& Writer)
+    {
+        Writer.WriteObjectStart();
+        FBlueprintDataSerializer::WriteBlueprintsField(Writer, BlueprintsData, Options);
+        Writer.WriteObjectEnd();
+    }), Format);
+}
+
+TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponse(const TSharedPtr<FJsonObject>& RootObject, EBlueprintWireFormat Format)
+{
+    return CreateEncodedResponse(MCPHttpServer::Encode(Format, [&RootObject](auto& Writer)
+    {
+        MCPHttpServer::WriteJsonObject(Writer, nullptr, RootObject);
+    }), Format);
+}
+
+EBlueprintWireFormat FMCPHttpServer::GetResponseFormat(const FHttpServerRequest& Request)
 {
-    // Create a JSON array to store blueprint JSON objects
-    TArray<TSharedPtr<FJsonValue>> BlueprintJsonArray;
+    const TArray<FString>* AcceptValues = Request.Headers.Find(TEXT("Accept"));
+    if (!AcceptValues)
+    {
+        return EBlueprintWireFormat::Json;
+    }
+    
+    return FBlueprintBinaryWriter::NegotiateFormat(FString::Join(*AcceptValues, TEXT(",")));
+}
+
+FBlueprintSerializationOptions FMCPHttpServer::GetSerializationOptions(const FHttpServerRequest& Request)
+{
+    FBlueprintSerializationOptions Options;
     
-    // Convert each blueprint to a JSON object and add to array
-    for (const FBlueprintData& Blueprint : BlueprintsData)
+    if (const FString* Compact = Request.QueryParams.Find(TEXT("compact")))
     {
-        // Get JSON string for this blueprint
-        FString BlueprintJson = FMCPIntegration::BlueprintDataToJSON(Blueprint);
-        
-        // Parse the JSON string back to a JSON object
-        TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(BlueprintJson);
-        TSharedPtr<FJsonObject> BlueprintJsonObject;
-        
-        if (FJsonSerializer::Deserialize(JsonReader, BlueprintJsonObject) && BlueprintJsonObject.IsValid())
-        {
-            // Add JSON object to array
-            BlueprintJsonArray.Add(MakeShareable(new FJsonValueObject(BlueprintJsonObject)));
-        }
+        Options.bCompactGraphs = Compact->ToBool();
     }
     
-    // Create root object
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    RootObject->SetArrayField(TEXT("blueprints"), BlueprintJsonArray);
+    // Clients written against API version 2 get defaults left out unless they opt out
+    if (const FString* ApiVersion = Request.QueryParams.Find(TEXT("apiVersion")))
+    {
+        Options.bOmitDefaults = FCString::Atoi(**ApiVersion) >= 2;
+    }
     
-    // Serialize to string
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter);
+    if (const FString* OmitDefaults = Request.QueryParams.Find(TEXT("omitDefaults")))
+    {
+        Options.bOmitDefaults = OmitDefaults->ToBool();
+    }
     
-    // Create response
-    return CreateJsonResponse(OutputString);
+    return Options;
 }
 
 TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateErrorResponse(int32 ErrorCode, const FString& ErrorMessage)
@@ -736,48 +1903,30 @@ TUniquePtr<FHttpServerResponse> FMCPHttpServer::CreateJsonResponseWithMetadata(
     const TArray<FBlueprintData>& BlueprintsData,
     int32 TotalCount,
     int32 Limit,
-    int32 Offset)
+    int32 Offset,
+    bool bTotalCountExact,
+    EBlueprintWireFormat Format,
+    const FBlueprintSerializationOptions& Options)
 {
-    // Create a JSON array to store blueprint JSON objects
-    TArray<TSharedPtr<FJsonValue>> BlueprintJsonArray;
-    
-    // Convert each blueprint to a JSON object and add to array
-    for (const FBlueprintData& Blueprint : BlueprintsData)
+    return CreateEncodedResponse(MCPHttpServer::Encode(Format, [&](auto& Writer)
     {
-        // Get JSON string for this blueprint
-        FString BlueprintJson = FMCPIntegration::BlueprintDataToJSON(Blueprint);
-        
-        // Parse the JSON string back to a JSON object
-        TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(BlueprintJson);
-        TSharedPtr<FJsonObject> BlueprintJsonObject;
-        
-        if (FJsonSerializer::Deserialize(JsonReader, BlueprintJsonObject) && BlueprintJsonObject.IsValid())
-        {
-            // Add JSON object to array
-            BlueprintJsonArray.Add(MakeShareable(new FJsonValueObject(BlueprintJsonObject)));
-        }
-    }
-    
-    // Create root object
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    RootObject->SetArrayField(TEXT("blueprints"), BlueprintJsonArray);
-    
-    // Add metadata
-    TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
-    MetadataObject->SetNumberField(TEXT("totalCount"), TotalCount);
-    MetadataObject->SetNumberField(TEXT("count"), BlueprintsData.Num());
-    MetadataObject->SetNumberField(TEXT("limit"), Limit);
-    MetadataObject->SetNumberField(TEXT("offset"), Offset);
-    
-    RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
-    
-    // Serialize to string
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter);
-    
-    // Create response
-    return CreateJsonResponse(OutputString);
+        MCPHttpServer::WriteBlueprintsWithMetadata(Writer, BlueprintsData, TotalCount, Limit, Offset, bTotalCountExact, Options);
+    }), Format);
+}
+
+TArray<uint8> FMCPHttpServer::SerializeWithMetadata(
+    const TArray<FBlueprintData>& BlueprintsData,
+    int32 TotalCount,
+    int32 Limit,
+    int32 Offset,
+    bool bTotalCountExact,
+    const FBlueprintSerializationOptions& Options)
+{
+    // Stream blueprints and metadata into UTF-8 in a single pass, never holding the response as UTF-16
+    return MCPHttpServer::Encode(EBlueprintWireFormat::Json, [&](auto& Writer)
+    {
+        MCPHttpServer::WriteBlueprintsWithMetadata(Writer, BlueprintsData, TotalCount, Limit, Offset, bTotalCountExact, Options);
+    });
 }
 
 bool FMCPHttpServer::HandleGetEventNodes(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -862,12 +2011,7 @@ bool FMCPHttpServer::HandleGetEventNodes(const FHttpServerRequest& Request, cons
         RootObject->SetStringField(TEXT("filteredByEvent"), EventName);
     }
     
-    // Serialize JSON to string
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
-    
-    OnComplete(CreateJsonResponse(JsonString));
+    OnComplete(CreateJsonResponse(RootObject, GetResponseFormat(Request)));
     return true;
 }
 
@@ -943,120 +2087,21 @@ bool FMCPHttpServer::HandleGetEventGraph(const FHttpServerRequest& Request, cons
     }
     
     // Get the first graph which should be our event graph
-    FBlueprintGraphData EventGraph = BlueprintData.GetValue().Graphs[0];
-    
-    // Create JSON response with the event graph
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    
-    // Add basic information
-    RootObject->SetStringField(TEXT("blueprintName"), Blueprint->GetName());
-    RootObject->SetStringField(TEXT("blueprintPath"), BlueprintPath);
-    RootObject->SetStringField(TEXT("eventName"), EventName);
-    
-    // Add graph information
-    TSharedPtr<FJsonObject> GraphObject = MakeShareable(new FJsonObject);
-    
-    // Set graph properties
-    GraphObject->SetStringField(TEXT("name"), EventGraph.Name);
-    GraphObject->SetStringField(TEXT("type"), EventGraph.GraphType);
-    
-    // Add nodes array
-    TArray<TSharedPtr<FJsonValue>> NodesArray;
-    for (const FBlueprintNodeData& NodeData : EventGraph.Nodes)
-    {
-        TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
-        
-        // Add node properties
-        NodeObject->SetStringField(TEXT("id"), NodeData.NodeId);
-        NodeObject->SetStringField(TEXT("type"), NodeData.NodeType);
-        NodeObject->SetStringField(TEXT("title"), NodeData.Title);
-        NodeObject->SetNumberField(TEXT("positionX"), NodeData.PositionX);
-        NodeObject->SetNumberField(TEXT("positionY"), NodeData.PositionY);
-        
-        if (!NodeData.Comment.IsEmpty())
-        {
-            NodeObject->SetStringField(TEXT("comment"), NodeData.Comment);
-        }
-        
-        // Add input pins
-        TArray<TSharedPtr<FJsonValue>> InputPinsArray;
-        for (const FBlueprintPinData& PinData : NodeData.InputPins)
-        {
-            TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
-            PinObject->SetStringField(TEXT("id"), PinData.PinId);
-            PinObject->SetStringField(TEXT("name"), PinData.Name);
-            PinObject->SetBoolField(TEXT("isExecution"), PinData.IsExecution);
-            PinObject->SetStringField(TEXT("dataType"), PinData.DataType);
-            PinObject->SetBoolField(TEXT("isConnected"), PinData.IsConnected);
-            
-            if (!PinData.DefaultValue.IsEmpty())
-            {
-                PinObject->SetStringField(TEXT("defaultValue"), PinData.DefaultValue);
-            }
-            
-            InputPinsArray.Add(MakeShareable(new FJsonValueObject(PinObject)));
-        }
-        NodeObject->SetArrayField(TEXT("inputPins"), InputPinsArray);
-        
-        // Add output pins
-        TArray<TSharedPtr<FJsonValue>> OutputPinsArray;
-        for (const FBlueprintPinData& PinData : NodeData.OutputPins)
-        {
-            TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
-            PinObject->SetStringField(TEXT("id"), PinData.PinId);
-            PinObject->SetStringField(TEXT("name"), PinData.Name);
-            PinObject->SetBoolField(TEXT("isExecution"), PinData.IsExecution);
-            PinObject->SetStringField(TEXT("dataType"), PinData.DataType);
-            PinObject->SetBoolField(TEXT("isConnected"), PinData.IsConnected);
-            
-            if (!PinData.DefaultValue.IsEmpty())
-            {
-                PinObject->SetStringField(TEXT("defaultValue"), PinData.DefaultValue);
-            }
-            
-            OutputPinsArray.Add(MakeShareable(new FJsonValueObject(PinObject)));
-        }
-        NodeObject->SetArrayField(TEXT("outputPins"), OutputPinsArray);
-        
-        // Add node to array
-        NodesArray.Add(MakeShareable(new FJsonValueObject(NodeObject)));
-    }
-    GraphObject->SetArrayField(TEXT("nodes"), NodesArray);
-    
-    // Add connections array
-    TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-    for (const FBlueprintConnectionData& ConnectionData : EventGraph.Connections)
-    {
-        TSharedPtr<FJsonObject> ConnectionObject = MakeShareable(new FJsonObject);
-        ConnectionObject->SetStringField(TEXT("sourceNodeId"), ConnectionData.SourceNodeId);
-        ConnectionObject->SetStringField(TEXT("sourcePinId"), ConnectionData.SourcePinId);
-        ConnectionObject->SetStringField(TEXT("targetNodeId"), ConnectionData.TargetNodeId);
-        ConnectionObject->SetStringField(TEXT("targetPinId"), ConnectionData.TargetPinId);
-        
-        ConnectionsArray.Add(MakeShareable(new FJsonValueObject(ConnectionObject)));
-    }
-    GraphObject->SetArrayField(TEXT("connections"), ConnectionsArray);
+    const FBlueprintGraphData& EventGraph = BlueprintData.GetValue().Graphs[0];
+    const FString BlueprintName = Blueprint->GetName();
+    const FBlueprintSerializationOptions Options = GetSerializationOptions(Request);
+    const EBlueprintWireFormat Format = GetResponseFormat(Request);
     
-    // Add metadata if available
-    if (EventGraph.Metadata.Num() > 0)
+    // The graph uses the same layout as the graphs of /blueprints/path
+    OnComplete(CreateEncodedResponse(MCPHttpServer::Encode(Format, [&](auto& Writer)
     {
-        TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
-        for (const TPair<FString, FString>& Pair : EventGraph.Metadata)
-        {
-            MetadataObject->SetStringField(Pair.Key, Pair.Value);
-        }
-        GraphObject->SetObjectField(TEXT("metadata"), MetadataObject);
-    }
-    
-    // Add graph to root object
-    RootObject->SetObjectField(TEXT("graph"), GraphObject);
-    
-    // Serialize JSON to string
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
-    
-    OnComplete(CreateJsonResponse(JsonString));
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("blueprintName"), BlueprintName);
+        Writer.WriteValue(TEXT("blueprintPath"), BlueprintPath);
+        Writer.WriteValue(TEXT("eventName"), EventName);
+        FBlueprintDataSerializer::WriteObject(Writer, TEXT("graph"), EventGraph, Options);
+        Writer.WriteObjectEnd();
+    }), Format));
     return true;
 }
 
@@ -2,6 +2,7 @@
 #include "HttpModule.h"
 #include "BlueprintAnalyzer/Public/BlueprintData.h"
 #include "BlueprintAnalyzer/Public/BlueprintDataExtractor.h"
+#include "BlueprintAnalyzer/Public/BlueprintDataSerializer.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -10,12 +11,54 @@
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
 #include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPluginManager.h"
 
 // Initialize static members
 FString FMCPIntegration::ServerURL;
 FString FMCPIntegration::APIKey;
 bool FMCPIntegration::bInitialized = false;
 
+namespace MCPIntegration
+{
+    /**
+     * Read a top-level string field of a JSON document without building a DOM
+     * @param JSON Document to read
+     * @param Identifier Name of the field
+     * @param OutValue Value of the field
+     * @return Whether the field was found
+     */
+    bool ReadStringField(const FString& JSON, const TCHAR* Identifier, FString& OutValue)
+    {
+        TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JSON);
+        
+        EJsonNotation Notation;
+        if (!JsonReader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+        {
+            return false;
+        }
+        
+        while (JsonReader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+        {
+            if (Notation == EJsonNotation::String && JsonReader->GetIdentifier() == Identifier)
+            {
+                OutValue = JsonReader->GetValueAsString();
+                return true;
+            }
+            
+            const bool bSkipped = Notation == EJsonNotation::ObjectStart ? JsonReader->SkipObject()
+                : Notation == EJsonNotation::ArrayStart ? JsonReader->SkipArray()
+                : true;
+            if (!bSkipped)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+}
+
 void FMCPIntegration::Initialize(const FString& InServerURL, const FString& InAPIKey)
 {
     ServerURL = InServerURL;
@@ -132,27 +175,8 @@ void FMCPIntegration::SendBlueprintsData(const TArray<FBlueprintData>& Blueprint
         return;
     }
     
-    // Create a JSON array of blueprint data
-    TSharedPtr<FJsonObject> BlueprintsObject = MakeShareable(new FJsonObject);
-    TArray<TSharedPtr<FJsonValue>> BlueprintArray;
-    
-    for (const FBlueprintData& BlueprintData : BlueprintsData)
-    {
-        // Parse individual blueprint JSON
-        TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(BlueprintDataToJSON(BlueprintData));
-        TSharedPtr<FJsonObject> BlueprintObject;
-        if (FJsonSerializer::Deserialize(JsonReader, BlueprintObject))
-        {
-            BlueprintArray.Add(MakeShareable(new FJsonValueObject(BlueprintObject)));
-        }
-    }
-    
-    BlueprintsObject->SetArrayField(TEXT("blueprints"), BlueprintArray);
-    
-    // Convert to string for the tool parameter
-    FString BlueprintsJsonPayload;
-    TSharedRef<TJsonWriter<>> BlueprintsJsonWriter = TJsonWriterFactory<>::Create(&BlueprintsJsonPayload);
-    FJsonSerializer::Serialize(BlueprintsObject.ToSharedRef(), BlueprintsJsonWriter);
+    // Convert blueprint data to JSON for the tool parameter
+    FString BlueprintsJsonPayload = BlueprintsToJSON(BlueprintsData);
     
     // Create MCP tool request payload
     TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
@@ -258,42 +282,13 @@ void FMCPIntegration::ProcessQuery(const FString& Query, TFunction<void(const TA
         
         if (bSucceeded && HttpResponse.IsValid() && HttpResponse->GetResponseCode() == 200)
         {
-            // Parse the JSON response
-            FString ResponseContent = HttpResponse->GetContentAsString();
-            TSharedPtr<FJsonObject> JsonObject;
-            TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ResponseContent);
-            
-            if (FJsonSerializer::Deserialize(JsonReader, JsonObject) && JsonObject->HasField(TEXT("result")))
+            // The tool result is a JSON document carried as a string; both are read as token streams, without a DOM
+            FString ResultStr;
+            if (MCPIntegration::ReadStringField(HttpResponse->GetContentAsString(), TEXT("result"), ResultStr)
+                && !JSONToBlueprints(ResultStr, Results))
             {
-                FString ResultStr = JsonObject->GetStringField(TEXT("result"));
-                
-                // Try to parse the result as JSON
-                TSharedPtr<FJsonObject> ResultObject;
-                TSharedRef<TJsonReader<>> ResultReader = TJsonReaderFactory<>::Create(ResultStr);
-                
-                if (FJsonSerializer::Deserialize(ResultReader, ResultObject))
-                {
-                    // Extract blueprint data from response if it's properly formatted
-                    if (ResultObject->HasField(TEXT("blueprints")))
-                    {
-                        TArray<TSharedPtr<FJsonValue>> BlueprintsJson = ResultObject->GetArrayField(TEXT("blueprints"));
-                        
-                        for (const TSharedPtr<FJsonValue>& BlueprintValue : BlueprintsJson)
-                        {
-                            if (BlueprintValue->Type == EJson::Object)
-                            {
-                                TSharedPtr<FJsonObject> BlueprintObject = BlueprintValue->AsObject();
-                                FString BlueprintJson;
-                                TSharedRef<TJsonWriter<>> BlueprintWriter = TJsonWriterFactory<>::Create(&BlueprintJson);
-                                FJsonSerializer::Serialize(BlueprintObject.ToSharedRef(), BlueprintWriter);
-                                
-                                // Convert to FBlueprintData
-                                FBlueprintData BlueprintData = JSONToBlueprintData(BlueprintJson);
-                                Results.Add(BlueprintData);
-                            }
-                        }
-                    }
-                }
+                UE_LOG(LogTemp, Warning, TEXT("MCP query result is not a valid blueprint list"));
+                Results.Reset();
             }
         }
         
@@ -372,179 +367,11 @@ void FMCPIntegration::OnResponseReceived(FHttpRequestPtr HttpRequest, FHttpRespo
 
 FString FMCPIntegration::BlueprintDataToJSON(const FBlueprintData& BlueprintData)
 {
-    // Create the JSON structure
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    
-    // Add basic info
-    RootObject->SetStringField(TEXT("name"), BlueprintData.Name);
-    RootObject->SetStringField(TEXT("path"), BlueprintData.Path);
-    RootObject->SetStringField(TEXT("parentClass"), BlueprintData.ParentClass);
-    
-    // Add functions
-    TArray<TSharedPtr<FJsonValue>> FunctionsArray;
-    for (const FBlueprintFunctionData& Function : BlueprintData.Functions)
-    {
-        TSharedPtr<FJsonObject> FunctionObject = MakeShareable(new FJsonObject);
-        FunctionObject->SetStringField(TEXT("name"), Function.Name);
-        FunctionObject->SetBoolField(TEXT("isEvent"), Function.IsEvent);
-        FunctionObject->SetStringField(TEXT("returnType"), Function.ReturnType);
-        FunctionObject->SetStringField(TEXT("description"), Function.Description);
-        FunctionObject->SetBoolField(TEXT("isCallable"), Function.IsCallable);
-        FunctionObject->SetBoolField(TEXT("isPure"), Function.IsPure);
-        
-        // Add parameters
-        TArray<TSharedPtr<FJsonValue>> ParamsArray;
-        for (const FBlueprintParamData& Param : Function.Params)
-        {
-            TSharedPtr<FJsonObject> ParamObject = MakeShareable(new FJsonObject);
-            ParamObject->SetStringField(TEXT("name"), Param.Name);
-            ParamObject->SetStringField(TEXT("type"), Param.Type);
-            ParamObject->SetBoolField(TEXT("isOutput"), Param.IsOutput);
-            ParamObject->SetStringField(TEXT("defaultValue"), Param.DefaultValue);
-            
-            ParamsArray.Add(MakeShareable(new FJsonValueObject(ParamObject)));
-        }
-        
-        FunctionObject->SetArrayField(TEXT("params"), ParamsArray);
-        FunctionsArray.Add(MakeShareable(new FJsonValueObject(FunctionObject)));
-    }
-    
-    RootObject->SetArrayField(TEXT("functions"), FunctionsArray);
-    
-    // Add variables
-    TArray<TSharedPtr<FJsonValue>> VariablesArray;
-    for (const FBlueprintVariableData& Variable : BlueprintData.Variables)
-    {
-        TSharedPtr<FJsonObject> VariableObject = MakeShareable(new FJsonObject);
-        VariableObject->SetStringField(TEXT("name"), Variable.Name);
-        VariableObject->SetStringField(TEXT("type"), Variable.Type);
-        VariableObject->SetStringField(TEXT("defaultValue"), Variable.DefaultValue);
-        VariableObject->SetBoolField(TEXT("isExposed"), Variable.IsExposed);
-        VariableObject->SetBoolField(TEXT("isReadOnly"), Variable.IsReadOnly);
-        VariableObject->SetBoolField(TEXT("isReplicated"), Variable.IsReplicated);
-        VariableObject->SetStringField(TEXT("category"), Variable.Category);
-        
-        VariablesArray.Add(MakeShareable(new FJsonValueObject(VariableObject)));
-    }
-    
-    RootObject->SetArrayField(TEXT("variables"), VariablesArray);
-    
-    // Add graph data
-    if (BlueprintData.Graphs.Num() > 0)
-    {
-        TArray<TSharedPtr<FJsonValue>> GraphsArray;
-        for (const FBlueprintGraphData& Graph : BlueprintData.Graphs)
-        {
-            TSharedPtr<FJsonObject> GraphObject = MakeShareable(new FJsonObject);
-            GraphObject->SetStringField(TEXT("name"), Graph.Name);
-            GraphObject->SetStringField(TEXT("graphType"), Graph.GraphType);
-            
-            // Add graph metadata if available
-            if (Graph.Metadata.Num() > 0)
-            {
-                TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
-                for (const TPair<FString, FString>& MetadataItem : Graph.Metadata)
-                {
-                    MetadataObject->SetStringField(MetadataItem.Key, MetadataItem.Value);
-                }
-                GraphObject->SetObjectField(TEXT("metadata"), MetadataObject);
-            }
-            
-            // Add nodes
-            TArray<TSharedPtr<FJsonValue>> NodesArray;
-            for (const FBlueprintNodeData& Node : Graph.Nodes)
-            {
-                TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
-                NodeObject->SetStringField(TEXT("nodeId"), Node.NodeId);
-                NodeObject->SetStringField(TEXT("nodeType"), Node.NodeType);
-                NodeObject->SetStringField(TEXT("title"), Node.Title);
-                NodeObject->SetNumberField(TEXT("positionX"), Node.PositionX);
-                NodeObject->SetNumberField(TEXT("positionY"), Node.PositionY);
-                NodeObject->SetStringField(TEXT("comment"), Node.Comment);
-                
-                // Add input pins
-                TArray<TSharedPtr<FJsonValue>> InputPinsArray;
-                for (const FBlueprintPinData& Pin : Node.InputPins)
-                {
-                    TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
-                    PinObject->SetStringField(TEXT("pinId"), Pin.PinId);
-                    PinObject->SetStringField(TEXT("name"), Pin.Name);
-                    PinObject->SetBoolField(TEXT("isExecution"), Pin.IsExecution);
-                    PinObject->SetStringField(TEXT("dataType"), Pin.DataType);
-                    PinObject->SetBoolField(TEXT("isConnected"), Pin.IsConnected);
-                    PinObject->SetStringField(TEXT("defaultValue"), Pin.DefaultValue);
-                    PinObject->SetBoolField(TEXT("isInput"), Pin.IsInput);
-                    
-                    InputPinsArray.Add(MakeShareable(new FJsonValueObject(PinObject)));
-                }
-                NodeObject->SetArrayField(TEXT("inputPins"), InputPinsArray);
-                
-                // Add output pins
-                TArray<TSharedPtr<FJsonValue>> OutputPinsArray;
-                for (const FBlueprintPinData& Pin : Node.OutputPins)
-                {
-                    TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
-                    PinObject->SetStringField(TEXT("pinId"), Pin.PinId);
-                    PinObject->SetStringField(TEXT("name"), Pin.Name);
-                    PinObject->SetBoolField(TEXT("isExecution"), Pin.IsExecution);
-                    PinObject->SetStringField(TEXT("dataType"), Pin.DataType);
-                    PinObject->SetBoolField(TEXT("isConnected"), Pin.IsConnected);
-                    PinObject->SetStringField(TEXT("defaultValue"), Pin.DefaultValue);
-                    PinObject->SetBoolField(TEXT("isInput"), Pin.IsInput);
-                    
-                    OutputPinsArray.Add(MakeShareable(new FJsonValueObject(PinObject)));
-                }
-                NodeObject->SetArrayField(TEXT("outputPins"), OutputPinsArray);
-                
-                // Add node properties
-                TSharedPtr<FJsonObject> PropertiesObject = MakeShareable(new FJsonObject);
-                for (const TPair<FString, FString>& Property : Node.Properties)
-                {
-                    PropertiesObject->SetStringField(Property.Key, Property.Value);
-                }
-                NodeObject->SetObjectField(TEXT("properties"), PropertiesObject);
-                
-                NodesArray.Add(MakeShareable(new FJsonValueObject(NodeObject)));
-            }
-            GraphObject->SetArrayField(TEXT("nodes"), NodesArray);
-            
-            // Add connections
-            TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-            for (const FBlueprintConnectionData& Connection : Graph.Connections)
-            {
-                TSharedPtr<FJsonObject> ConnectionObject = MakeShareable(new FJsonObject);
-                ConnectionObject->SetStringField(TEXT("sourceNodeId"), Connection.SourceNodeId);
-                ConnectionObject->SetStringField(TEXT("sourcePinId"), Connection.SourcePinId);
-                ConnectionObject->SetStringField(TEXT("targetNodeId"), Connection.TargetNodeId);
-                ConnectionObject->SetStringField(TEXT("targetPinId"), Connection.TargetPinId);
-                
-                ConnectionsArray.Add(MakeShareable(new FJsonValueObject(ConnectionObject)));
-            }
-            GraphObject->SetArrayField(TEXT("connections"), ConnectionsArray);
-            
-            GraphsArray.Add(MakeShareable(new FJsonValueObject(GraphObject)));
-        }
-        RootObject->SetArrayField(TEXT("graphs"), GraphsArray);
-    }
-    
-    // Add description
-    RootObject->SetStringField(TEXT("description"), BlueprintData.Description);
-    
-    // Add blueprint metadata if available
-    if (BlueprintData.Metadata.Num() > 0)
-    {
-        TSharedPtr<FJsonObject> MetadataObject = MakeShareable(new FJsonObject);
-        for (const TPair<FString, FString>& MetadataItem : BlueprintData.Metadata)
-        {
-            MetadataObject->SetStringField(MetadataItem.Key, MetadataItem.Value);
-        }
-        RootObject->SetObjectField(TEXT("metadata"), MetadataObject);
-    }
-    
-    // Convert to string
+    // Stream the blueprint straight into the output string, no intermediate JSON objects
     FString OutputString;
     TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter);
+    FBlueprintDataSerializer::WriteBlueprint(JsonWriter.Get(), BlueprintData);
+    JsonWriter->Close();
     
     return OutputString;
 }
@@ -553,150 +380,22 @@ FBlueprintData FMCPIntegration::JSONToBlueprintData(const FString& JSON)
 {
     FBlueprintData BlueprintData;
     
-    // Parse the JSON
-    TSharedPtr<FJsonObject> JsonObject;
+    // Fill the struct straight from the token stream, with the same field tables as the writers
     TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JSON);
-    
-    if (FJsonSerializer::Deserialize(JsonReader, JsonObject))
+    if (!FBlueprintDataSerializer::ReadObject(JsonReader.Get(), BlueprintData))
     {
-        // Basic info
-        BlueprintData.Name = JsonObject->GetStringField(TEXT("name"));
-        BlueprintData.Path = JsonObject->GetStringField(TEXT("path"));
-        
-        if (JsonObject->HasField(TEXT("parentClass")))
-        {
-            BlueprintData.ParentClass = JsonObject->GetStringField(TEXT("parentClass"));
-        }
-        
-        // Functions
-        if (JsonObject->HasField(TEXT("functions")))
-        {
-            TArray<TSharedPtr<FJsonValue>> FunctionsArray = JsonObject->GetArrayField(TEXT("functions"));
-            
-            for (const TSharedPtr<FJsonValue>& FunctionValue : FunctionsArray)
-            {
-                if (FunctionValue->Type == EJson::Object)
-                {
-                    TSharedPtr<FJsonObject> FunctionObject = FunctionValue->AsObject();
-                    FBlueprintFunctionData FunctionData;
-                    
-                    FunctionData.Name = FunctionObject->GetStringField(TEXT("name"));
-                    FunctionData.IsEvent = FunctionObject->GetBoolField(TEXT("isEvent"));
-                    FunctionData.ReturnType = FunctionObject->GetStringField(TEXT("returnType"));
-                    FunctionData.Description = FunctionObject->GetStringField(TEXT("description"));
-                    FunctionData.IsCallable = FunctionObject->GetBoolField(TEXT("isCallable"));
-                    FunctionData.IsPure = FunctionObject->GetBoolField(TEXT("isPure"));
-                    
-                    // Parameters
-                    if (FunctionObject->HasField(TEXT("params")))
-                    {
-                        TArray<TSharedPtr<FJsonValue>> ParamsArray = FunctionObject->GetArrayField(TEXT("params"));
-                        
-                        for (const TSharedPtr<FJsonValue>& ParamValue : ParamsArray)
-                        {
-                            if (ParamValue->Type == EJson::Object)
-                            {
-                                TSharedPtr<FJsonObject> ParamObject = ParamValue->AsObject();
-                                FBlueprintParamData ParamData;
-                                
-                                ParamData.Name = ParamObject->GetStringField(TEXT("name"));
-                                ParamData.Type = ParamObject->GetStringField(TEXT("type"));
-                                ParamData.IsOutput = ParamObject->GetBoolField(TEXT("isOutput"));
-                                ParamData.DefaultValue = ParamObject->GetStringField(TEXT("defaultValue"));
-                                
-                                FunctionData.Params.Add(ParamData);
-                            }
-                        }
-                    }
-                    
-                    BlueprintData.Functions.Add(FunctionData);
-                }
-            }
-        }
-        
-        // Variables
-        if (JsonObject->HasField(TEXT("variables")))
-        {
-            TArray<TSharedPtr<FJsonValue>> VariablesArray = JsonObject->GetArrayField(TEXT("variables"));
-            
-            for (const TSharedPtr<FJsonValue>& VariableValue : VariablesArray)
-            {
-                if (VariableValue->Type == EJson::Object)
-                {
-                    TSharedPtr<FJsonObject> VariableObject = VariableValue->AsObject();
-                    FBlueprintVariableData VariableData;
-                    
-                    VariableData.Name = VariableObject->GetStringField(TEXT("name"));
-                    VariableData.Type = VariableObject->GetStringField(TEXT("type"));
-                    VariableData.DefaultValue = VariableObject->GetStringField(TEXT("defaultValue"));
-                    VariableData.IsExposed = VariableObject->GetBoolField(TEXT("isExposed"));
-                    VariableData.IsReadOnly = VariableObject->GetBoolField(TEXT("isReadOnly"));
-                    VariableData.IsReplicated = VariableObject->GetBoolField(TEXT("isReplicated"));
-                    VariableData.Category = VariableObject->GetStringField(TEXT("category"));
-                    
-                    BlueprintData.Variables.Add(VariableData);
-                }
-            }
-        }
-        
-        // Description
-        if (JsonObject->HasField(TEXT("description")))
-        {
-            BlueprintData.Description = JsonObject->GetStringField(TEXT("description"));
-        }
-        
-        // Metadata
-        if (JsonObject->HasField(TEXT("metadata")))
-        {
-            TSharedPtr<FJsonObject> MetadataObject = JsonObject->GetObjectField(TEXT("metadata"));
-            for (const auto& MetadataItem : MetadataObject->Values)
-            {
-                if (MetadataItem.Value->Type == EJson::String)
-                {
-                    BlueprintData.Metadata.Add(MetadataItem.Key, MetadataItem.Value->AsString());
-                }
-            }
-        }
-        
-        // Graphs
-        if (JsonObject->HasField(TEXT("graphs")))
-        {
-            TArray<TSharedPtr<FJsonValue>> GraphsArray = JsonObject->GetArrayField(TEXT("graphs"));
-            
-            for (const TSharedPtr<FJsonValue>& GraphValue : GraphsArray)
-            {
-                if (GraphValue->Type == EJson::Object)
-                {
-                    TSharedPtr<FJsonObject> GraphObject = GraphValue->AsObject();
-                    FBlueprintGraphData GraphData;
-                    
-                    GraphData.Name = GraphObject->GetStringField(TEXT("name"));
-                    GraphData.GraphType = GraphObject->GetStringField(TEXT("graphType"));
-                    
-                    // Graph metadata
-                    if (GraphObject->HasField(TEXT("metadata")))
-                    {
-                        TSharedPtr<FJsonObject> MetadataObject = GraphObject->GetObjectField(TEXT("metadata"));
-                        for (const auto& MetadataItem : MetadataObject->Values)
-                        {
-                            if (MetadataItem.Value->Type == EJson::String)
-                            {
-                                GraphData.Metadata.Add(MetadataItem.Key, MetadataItem.Value->AsString());
-                            }
-                        }
-                    }
-                    
-                    // Process nodes and connections (add when implementing graph loading)
-                    
-                    BlueprintData.Graphs.Add(GraphData);
-                }
-            }
-        }
+        UE_LOG(LogTemp, Warning, TEXT("Failed to parse blueprint JSON: %s"), *JsonReader->GetErrorMessage());
     }
     
     return BlueprintData;
 }
 
+bool FMCPIntegration::JSONToBlueprints(const FString& JSON, TArray<FBlueprintData>& OutBlueprints)
+{
+    TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JSON);
+    return FBlueprintDataSerializer::ReadBlueprintsField(JsonReader.Get(), OutBlueprints);
+}
+
 // Declare static members
 FTimerHandle FMCPIntegration::ExportTimerHandle;
 float FMCPIntegration::ExportIntervalSeconds = 60.0f; // Default 60 seconds
@@ -710,79 +409,16 @@ bool FMCPIntegration::ExportBlueprintsToFile()
     // Use the BlueprintDataExtractor to get all blueprints
     AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints();
     
-    // Convert to JSON
+    // Stream the export array straight into the file contents
     FString BlueprintsJson;
-    
-    // Create a JSON array
-    TArray<TSharedPtr<FJsonValue>> JsonArray;
-    
-    // Add each blueprint to the array
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BlueprintsJson);
+    Writer->WriteArrayStart();
     for (const FBlueprintData& Blueprint : AllBlueprints)
     {
-        TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-        
-        // Basic blueprint info
-        JsonObject->SetStringField(TEXT("name"), Blueprint.Name);
-        JsonObject->SetStringField(TEXT("path"), Blueprint.Path);
-        JsonObject->SetStringField(TEXT("description"), Blueprint.Description);
-        JsonObject->SetStringField(TEXT("parent_class"), Blueprint.ParentClass);
-        
-        // Functions
-        TArray<TSharedPtr<FJsonValue>> FunctionsArray;
-        for (const FBlueprintFunctionData& Function : Blueprint.Functions)
-        {
-            TSharedPtr<FJsonObject> FunctionObject = MakeShareable(new FJsonObject);
-            FunctionObject->SetStringField(TEXT("name"), Function.Name);
-            FunctionObject->SetBoolField(TEXT("is_event"), Function.IsEvent);
-            FunctionObject->SetBoolField(TEXT("is_pure"), Function.IsPure);
-            FunctionObject->SetBoolField(TEXT("is_callable"), Function.IsCallable);
-            FunctionObject->SetStringField(TEXT("return_type"), Function.ReturnType);
-            FunctionObject->SetStringField(TEXT("description"), Function.Description);
-            
-            // Function parameters
-            TArray<TSharedPtr<FJsonValue>> ParametersArray;
-            for (const FBlueprintParamData& Param : Function.Params)
-            {
-                TSharedPtr<FJsonObject> ParamObject = MakeShareable(new FJsonObject);
-                ParamObject->SetStringField(TEXT("name"), Param.Name);
-                ParamObject->SetStringField(TEXT("type"), Param.Type);
-                ParamObject->SetBoolField(TEXT("is_output"), Param.IsOutput);
-                ParamObject->SetStringField(TEXT("default_value"), Param.DefaultValue);
-                
-                ParametersArray.Add(MakeShareable(new FJsonValueObject(ParamObject)));
-            }
-            
-            FunctionObject->SetArrayField(TEXT("parameters"), ParametersArray);
-            FunctionsArray.Add(MakeShareable(new FJsonValueObject(FunctionObject)));
-        }
-        
-        JsonObject->SetArrayField(TEXT("functions"), FunctionsArray);
-        
-        // Variables
-        TArray<TSharedPtr<FJsonValue>> VariablesArray;
-        for (const FBlueprintVariableData& Variable : Blueprint.Variables)
-        {
-            TSharedPtr<FJsonObject> VariableObject = MakeShareable(new FJsonObject);
-            VariableObject->SetStringField(TEXT("name"), Variable.Name);
-            VariableObject->SetStringField(TEXT("type"), Variable.Type);
-            VariableObject->SetStringField(TEXT("category"), Variable.Category);
-            VariableObject->SetStringField(TEXT("default_value"), Variable.DefaultValue);
-            VariableObject->SetBoolField(TEXT("is_exposed"), Variable.IsExposed);
-            VariableObject->SetBoolField(TEXT("is_read_only"), Variable.IsReadOnly);
-            VariableObject->SetBoolField(TEXT("is_replicated"), Variable.IsReplicated);
-            
-            VariablesArray.Add(MakeShareable(new FJsonValueObject(VariableObject)));
-        }
-        
-        JsonObject->SetArrayField(TEXT("variables"), VariablesArray);
-        
-        // Add to main array
-        JsonArray.Add(MakeShareable(new FJsonValueObject(JsonObject)));
+        FBlueprintDataSerializer::WriteExportBlueprint(Writer.Get(), Blueprint);
     }
-    
-    // Convert to string
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BlueprintsJson);
-    FJsonSerializer::Serialize(JsonArray, Writer);
+    Writer->WriteArrayEnd();
+    Writer->Close();
     
     // Get the file path
     FString FilePath = GetExportFilePath();
@@ -865,34 +501,116 @@ float FMCPIntegration::GetExportInterval()
 // Convert multiple blueprints to JSON
 FString FMCPIntegration::BlueprintsToJSON(const TArray<FBlueprintData>& Blueprints)
 {
-    // Create a JSON array to store blueprint JSON objects
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    TArray<TSharedPtr<FJsonValue>> BlueprintJsonArray;
+    // Stream all blueprints into one string in a single pass
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutputString);
+    JsonWriter->WriteObjectStart();
+    FBlueprintDataSerializer::WriteBlueprintsField(JsonWriter.Get(), Blueprints);
+    JsonWriter->WriteObjectEnd();
+    JsonWriter->Close();
     
-    // Convert each blueprint to a JSON object and add to array
-    for (const FBlueprintData& Blueprint : Blueprints)
+    return OutputString;
+}
+
+namespace MCPIntegration
+{
+    /**
+     * Time the streaming blueprint parser against a DOM parse of the same documents and check that what it
+     * reads serializes back to the same JSON
+     * Parses every .json file in Directory (default: the GameDoc folder next to the plugin, where the fixtures
+     * ship) and a listing of up to MaxBlueprints of the project's own blueprints at graph detail.
+     * Usage: BlueprintAnalyzer.BenchmarkJsonParser [Iterations] [MaxBlueprints] [Directory]
+     */
+    void BenchmarkJsonParser(const TArray<FString>& Args)
     {
-        // Get JSON string for this blueprint
-        FString BlueprintJson = BlueprintDataToJSON(Blueprint);
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+        const int32 MaxBlueprints = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 20;
+        
+        FString Directory;
+        if (Args.Num() > 2)
+        {
+            Directory = Args[2];
+        }
+        else if (const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("BlueprintAnalyzer")))
+        {
+            Directory = FPaths::ConvertRelativePathToFull(FPaths::Combine(Plugin->GetBaseDir(), TEXT(".."), TEXT("GameDoc")));
+        }
+        
+        if (!IFileManager::Get().DirectoryExists(*Directory))
+        {
+            UE_LOG(LogTemp, Error, TEXT("No fixture directory at '%s'. Usage: BlueprintAnalyzer.BenchmarkJsonParser [Iterations] [MaxBlueprints] [Directory]"), *Directory);
+            return;
+        }
+        
+        TArray<TPair<FString, FString>> Documents;
+        
+        TArray<FString> FileNames;
+        IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.json")), true, false);
+        for (const FString& FileName : FileNames)
+        {
+            FString Json;
+            if (FFileHelper::LoadFileToString(Json, *FPaths::Combine(Directory, FileName)))
+            {
+                Documents.Emplace(FileName, MoveTemp(Json));
+            }
+        }
+        
+        TArray<FBlueprintData> Blueprints;
+        const TArray<FBlueprintData> AllBlueprints = FBlueprintDataExtractor::GetAllBlueprints(EBlueprintDetailLevel::Basic);
+        for (int32 Index = 0; Index < AllBlueprints.Num() && Index < MaxBlueprints; ++Index)
+        {
+            TOptional<FBlueprintData> BlueprintData = FBlueprintDataExtractor::GetBlueprintByPath(AllBlueprints[Index].Path, EBlueprintDetailLevel::Graph);
+            if (BlueprintData.IsSet())
+            {
+                Blueprints.Add(MoveTemp(BlueprintData.GetValue()));
+            }
+        }
+        if (Blueprints.Num() > 0)
+        {
+            Documents.Emplace(FString::Printf(TEXT("%d project blueprints"), Blueprints.Num()), FMCPIntegration::BlueprintsToJSON(Blueprints));
+        }
         
-        // Parse the JSON string back to a JSON object
-        TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(BlueprintJson);
-        TSharedPtr<FJsonObject> BlueprintJsonObject;
+        UE_LOG(LogTemp, Log, TEXT("JSON parser benchmark over %d documents from %s, %d iterations (DOM is the parse alone, without filling structs)"),
+            Documents.Num(), *Directory, Iterations);
         
-        if (FJsonSerializer::Deserialize(JsonReader, BlueprintJsonObject) && BlueprintJsonObject.IsValid())
+        for (const TPair<FString, FString>& Document : Documents)
         {
-            // Add JSON object to array
-            BlueprintJsonArray.Add(MakeShareable(new FJsonValueObject(BlueprintJsonObject)));
+            const double DomStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                TSharedPtr<FJsonObject> JsonObject;
+                TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Document.Value);
+                FJsonSerializer::Deserialize(JsonReader, JsonObject);
+            }
+            const double DomSeconds = (FPlatformTime::Seconds() - DomStart) / Iterations;
+            
+            TArray<FBlueprintData> Parsed;
+            bool bParsed = true;
+            const double StreamStart = FPlatformTime::Seconds();
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                Parsed.Reset();
+                TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Document.Value);
+                bParsed &= FBlueprintDataSerializer::ReadBlueprintsField(JsonReader.Get(), Parsed);
+            }
+            const double StreamSeconds = (FPlatformTime::Seconds() - StreamStart) / Iterations;
+            
+            // Whatever was read must survive another write and read unchanged
+            const FString Written = FMCPIntegration::BlueprintsToJSON(Parsed);
+            TArray<FBlueprintData> Reparsed;
+            TSharedRef<TJsonReader<>> ReparseReader = TJsonReaderFactory<>::Create(Written);
+            const bool bRoundTrip = FBlueprintDataSerializer::ReadBlueprintsField(ReparseReader.Get(), Reparsed)
+                && FMCPIntegration::BlueprintsToJSON(Reparsed) == Written;
+            
+            UE_LOG(LogTemp, Log, TEXT("  %-32s %9d chars  %d blueprints  DOM %8.3f ms  stream %8.3f ms  %.1fx%s"),
+                *Document.Key, Document.Value.Len(), Parsed.Num(), DomSeconds * 1000.0, StreamSeconds * 1000.0,
+                StreamSeconds > 0.0 ? DomSeconds / StreamSeconds : 0.0,
+                !bParsed ? TEXT("  PARSE FAILED") : bRoundTrip ? TEXT("") : TEXT("  ROUND TRIP MISMATCH"));
         }
     }
     
-    // Add the array to the root object
-    RootObject->SetArrayField(TEXT("blueprints"), BlueprintJsonArray);
-    
-    // Serialize to string
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), JsonWriter);
-    
-    return OutputString;
-}
\ No newline at end of file
+    FAutoConsoleCommand BenchmarkJsonParserCommand(
+        TEXT("BlueprintAnalyzer.BenchmarkJsonParser"),
+        TEXT("Compare the streaming blueprint parser with a DOM parse over JSON fixtures. Usage: BlueprintAnalyzer.BenchmarkJsonParser [Iterations] [MaxBlueprints] [Directory]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkJsonParser));
+}
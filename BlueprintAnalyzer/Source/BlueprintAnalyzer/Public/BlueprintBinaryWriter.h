@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FBlueprintUtf8JsonWriter;
+
+/**
+ * Enum defining the encodings blueprint data can be served in
+ */
+enum class EBlueprintWireFormat : uint8
+{
+    /** UTF-8 JSON (application/json) */
+    Json = 0,
+
+    /** CBOR, RFC 8949 (application/cbor) */
+    Cbor = 1,
+
+    /** MessagePack (application/msgpack) */
+    MessagePack = 2
+};
+
+/**
+ * Writer that encodes the JSON data model as CBOR or MessagePack.
+ * Has the TJsonWriter interface used by FBlueprintDataSerializer, so binary responses come from the
+ * same traversal as JSON ones and carry the same objects, field names and values. Integers and
+ * booleans keep their type instead of being spelled out as text, and no quoting or escaping is needed,
+ * which is what makes the format cheaper to decode on the client.
+ *
+ * CBOR containers use indefinite lengths. MessagePack needs element counts up front, so containers get
+ * a 32-bit count that is patched when they close; small containers are then shrunk to the one byte form.
+ */
+class BLUEPRINTANALYZER_API FBlueprintBinaryWriter
+{
+public:
+    /**
+     * Create a writer
+     * @param InFormat Cbor or MessagePack
+     * @param InitialCapacity Number of bytes to reserve up front
+     */
+    explicit FBlueprintBinaryWriter(EBlueprintWireFormat InFormat, int32 InitialCapacity = 4096);
+
+    /** Start and end objects and arrays, as a value or as the field named by Identifier */
+    void WriteObjectStart();
+    void WriteObjectStart(FStringView Identifier);
+    void WriteObjectEnd();
+    void WriteArrayStart();
+    void WriteArrayStart(FStringView Identifier);
+    void WriteArrayEnd();
+
+    /** Write array elements */
+    void WriteValue(FStringView Value);
+    void WriteValue(const FString& Value);
+    void WriteValue(const TCHAR* Value);
+    void WriteValue(bool Value);
+    void WriteValue(int32 Value);
+    void WriteValue(int64 Value);
+    void WriteValue(double Value);
+    void WriteNull();
+
+    /** Write object fields */
+    void WriteValue(FStringView Identifier, FStringView Value);
+    void WriteValue(FStringView Identifier, const FString& Value);
+    void WriteValue(FStringView Identifier, const TCHAR* Value);
+    void WriteValue(FStringView Identifier, bool Value);
+    void WriteValue(FStringView Identifier, int32 Value);
+    void WriteValue(FStringView Identifier, int64 Value);
+    void WriteValue(FStringView Identifier, double Value);
+    void WriteNull(FStringView Identifier);
+
+    /**
+     * Write an array element that is already encoded, e.g. a cached blueprint object
+     * @param Encoded One complete value in this writer's encoding
+     */
+    void WriteRawValue(TConstArrayView<uint8> Encoded);
+
+    /**
+     * Finish writing; checks that every object and array was closed
+     * @return True if the output is a complete value
+     */
+    bool Close();
+
+    /**
+     * Take the written bytes, leaving the writer empty
+     * @return The encoded document
+     */
+    TArray<uint8> MoveBytes();
+
+    /**
+     * Decode a CBOR or MessagePack document produced by this writer back into JSON
+     * Used to check that both encodings carry exactly what the JSON response does.
+     * @param Bytes Encoded document
+     * @param Format Cbor or MessagePack
+     * @param Writer JSON writer receiving the decoded document
+     * @return False if the document is malformed or uses items this writer never produces
+     */
+    static bool DecodeToJson(TConstArrayView<uint8> Bytes, EBlueprintWireFormat Format, FBlueprintUtf8JsonWriter& Writer);
+
+    /**
+     * Get the MIME type of a format
+     * @param Format Format to describe
+     * @return e.g. "application/cbor"
+     */
+    static const TCHAR* GetContentType(EBlueprintWireFormat Format);
+
+    /**
+     * Pick the response format from an Accept header
+     * The supported type with the highest quality wins, earlier entries break ties; JSON is the default.
+     * @param AcceptHeader Value of the Accept header, may be empty
+     * @return The negotiated format
+     */
+    static EBlueprintWireFormat NegotiateFormat(FStringView AcceptHeader);
+
+private:
+    /** An open object or array */
+    struct FScope
+    {
+        /** Offset of the container header in the output */
+        int32 HeaderOffset = 0;
+
+        /** Number of values (or fields) written so far */
+        uint32 Count = 0;
+
+        /** Whether the container is an object */
+        bool bObject = false;
+    };
+
+    /** Count a new value in the innermost container */
+    void BeginValue();
+
+    /** Write a field name as the key of the next map entry */
+    void WriteKey(FStringView Identifier);
+
+    /** Open a container after its key (if any) was written */
+    void OpenScope(bool bObject);
+
+    /** Close the innermost container */
+    void CloseScope(bool bObject);
+
+    /** Append encoded scalars */
+    void AppendString(FStringView Value);
+    void AppendBool(bool Value);
+    void AppendInteger(int64 Value);
+    void AppendDouble(double Value);
+    void AppendNull();
+
+    /** Append a CBOR initial byte with its argument */
+    void AppendCborHead(uint8 MajorType, uint64 Argument);
+
+    /** Append Value big-endian in NumBytes bytes */
+    void AppendBigEndian(uint64 Value, int32 NumBytes);
+
+    /** Output encoding */
+    EBlueprintWireFormat Format;
+
+    /** Output buffer */
+    TArray<uint8> Bytes;
+
+    /** Open containers, innermost last */
+    TArray<FScope, TInlineAllocator<32>> Scopes;
+};
@@ -0,0 +1,496 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintData.h"
+#include "BlueprintTrigramIndex.h"
+#include "BlueprintRankedIndex.h"
+#include "BlueprintNameArena.h"
+#include "BlueprintSignatureIndex.h"
+#include "BlueprintCompletionTrie.h"
+#include "BlueprintPathTree.h"
+#include "BlueprintLeaderboard.h"
+
+struct FAssetData;
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
+
+/**
+ * Enum defining where in a graph a piece of indexed text comes from
+ */
+enum class EBlueprintGraphTextField : uint8
+{
+    /** Title of a node */
+    NodeTitle = 0,
+
+    /** Comment bubble attached to a node */
+    NodeComment = 1,
+
+    /** Text of a comment box */
+    CommentBox = 2,
+
+    /** Literal default value of an unconnected input pin */
+    PinDefaultValue = 3
+};
+
+/**
+ * Data structure representing one piece of graph text in the catalog
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphText
+{
+    /** Id of the catalog entry the text belongs to, or INDEX_NONE for a free slot */
+    int32 EntryId = INDEX_NONE;
+
+    /** Name of the graph containing the node */
+    FString GraphName;
+
+    /** Id of the node, matching the node ids in graph data */
+    FString NodeId;
+
+    /** Title of the node */
+    FString NodeTitle;
+
+    /** Which part of the node the text comes from */
+    EBlueprintGraphTextField Field = EBlueprintGraphTextField::NodeTitle;
+
+    /** Name of the pin for pin default values */
+    FString PinName;
+
+    /** The text itself */
+    FString Text;
+};
+
+/**
+ * Data structure representing one node of a graph summary
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphSummaryNode
+{
+    /** Id of the node, matching the node ids in graph data */
+    FString NodeId;
+
+    /** Class of the node, e.g. K2Node_CallFunction */
+    FString NodeClass;
+
+    /** Title of the node */
+    FString Title;
+
+    /** Name of the event the node implements (ReceiveTick, a custom event's name, ...); empty for other nodes */
+    FString EventName;
+
+    /** Indices of the nodes this node's exec outputs lead to */
+    TArray<int32> ExecSuccessors;
+
+    /** Indices of the nodes this node's data outputs feed */
+    TArray<int32> DataSuccessors;
+};
+
+/**
+ * Data structure representing the structure of one graph: its nodes and the exec and data edges between them
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphSummary
+{
+    /** Name of the graph */
+    FString GraphName;
+
+    /** Nodes of the graph; edges refer to nodes by index into this array */
+    TArray<FBlueprintGraphSummaryNode> Nodes;
+};
+
+/**
+ * Data structure referring to one graph of a catalog entry
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphRef
+{
+    /** Id of the catalog entry */
+    int32 EntryId = INDEX_NONE;
+
+    /** Index of the graph in the entry's graph summaries */
+    int32 GraphIndex = INDEX_NONE;
+};
+
+/**
+ * Data structure representing one blueprint in the catalog
+ */
+struct BLUEPRINTANALYZER_API FBlueprintCatalogEntry
+{
+    /** Blueprint data; basic fields are always set, functions/variables only once bHasMemberData is true */
+    FBlueprintData Data;
+
+    /** Asset registry tags of the blueprint, available without loading it */
+    TMap<FName, FString> AssetTags;
+
+    /** Ids of the entry's graph texts, collected with the member data */
+    TArray<int32> GraphTextIds;
+
+    /** Node and edge structure of every graph, collected with the member data */
+    TArray<FBlueprintGraphSummary> GraphSummaries;
+
+    /** Packages the blueprint's package depends on, from the asset registry (script packages excluded) */
+    TArray<FName> Dependencies;
+
+    /** Size of the blueprint's package on disk in bytes, 0 if unknown */
+    int64 PackageSize = 0;
+
+    /** Catalog generation in which the asset itself last changed */
+    uint64 Revision = 0;
+
+    /** Whether functions and variables have been extracted (Medium detail) */
+    bool bHasMemberData = false;
+
+    /** Whether this slot holds a live blueprint (removed slots are reused) */
+    bool bIsValid = false;
+};
+
+/**
+ * In-memory catalog of every blueprint in the project.
+ * Built once from the asset registry and kept up to date incrementally from asset registry
+ * and package save events, so searches never have to re-query the registry or re-load assets.
+ */
+class BLUEPRINTANALYZER_API FBlueprintCatalog
+{
+public:
+    /**
+     * Register for asset change notifications. The catalog itself is built lazily on first use.
+     */
+    static void Initialize();
+
+    /**
+     * Unregister asset change notifications and drop all cached data
+     */
+    static void Shutdown();
+
+    /**
+     * Build the catalog from the asset registry if it hasn't been built yet
+     */
+    static void EnsureBuilt();
+
+    /**
+     * Get the generation counter, incremented whenever an asset is added, removed, updated, renamed or saved
+     * (lazily extracted member data doesn't move it)
+     * @return Current catalog generation
+     */
+    static uint64 GetGeneration();
+
+    /**
+     * Get the ids of all live entries in catalog order
+     * @param OutIds Array receiving the entry ids
+     */
+    static void GetAllEntryIds(TArray<int32>& OutIds);
+
+    /**
+     * Get the number of live entries
+     * @return Number of blueprints in the catalog
+     */
+    static int32 GetNumEntries();
+
+    /**
+     * Get the number of live entries whose function and variable data has been extracted
+     * @return Number of blueprints with member data
+     */
+    static int32 GetNumEntriesWithMemberData();
+
+    /**
+     * Get an entry by id
+     * @param EntryId Id of the entry
+     * @return The entry, or nullptr if the id is not a live entry
+     */
+    static const FBlueprintCatalogEntry* GetEntry(int32 EntryId);
+
+    /**
+     * Find the entry id for a blueprint object path
+     * @param Path Object path of the blueprint
+     * @return The entry id, or INDEX_NONE if not found
+     */
+    static int32 FindEntryId(const FString& Path);
+
+    /**
+     * Check whether a blueprint has unsaved edits, which its catalog revision doesn't reflect until it is saved
+     * @param Path Object path of the blueprint
+     * @return True if the blueprint's package is loaded and dirty
+     */
+    static bool HasUnsavedChanges(const FString& Path);
+
+    /**
+     * Make sure function and variable data has been extracted for the given entries
+     * @param EntryIds Ids of the entries that need member data
+     */
+    static void EnsureMemberData(TConstArrayView<int32> EntryIds);
+
+    /**
+     * Load the blueprints of the given entries in one batch
+     * Blueprints that are already in memory are reused without touching the loader.
+     * @param EntryIds Ids of the entries to load
+     * @param OutBlueprints Loaded blueprints in the same order as EntryIds (nullptr where loading failed)
+     */
+    static void LoadBlueprints(TConstArrayView<int32> EntryIds, TArray<UBlueprint*>& OutBlueprints);
+
+    /**
+     * Find all entries whose field contains the needle (case-insensitive)
+     * Uses the trigram index when possible and falls back to a vectorized arena scan for short needles.
+     * Member fields (functions, variables) are only searched on entries with member data.
+     * @param Field Field to search
+     * @param Needle Substring to search for
+     * @param OutIds Sorted ids of the matching entries
+     */
+    static void FindSubstring(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutIds);
+
+    /**
+     * Find all entries whose field contains the needle by scanning the packed name arena, without the trigram index
+     * @param Field Field to search (any field but GraphText)
+     * @param Needle Substring to search for; must not be empty
+     * @param OutIds Sorted ids of the matching entries
+     */
+    static void ScanSubstring(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutIds);
+
+    /**
+     * Estimate how many entries FindSubstring would return without running it
+     * @param Field Field to search
+     * @param Needle Substring to search for
+     * @return Upper bound on the number of matches, or INDEX_NONE if the needle is too short for the index
+     */
+    static int32 EstimateSubstring(EBlueprintSearchField Field, const FString& Needle);
+
+    /**
+     * Check whether an entry's field contains the needle (case-insensitive)
+     * @param Entry Entry to check
+     * @param Field Field to check
+     * @param Needle Substring to search for
+     * @return True if any text of the field contains the needle
+     */
+    static bool FieldContains(const FBlueprintCatalogEntry& Entry, EBlueprintSearchField Field, const FString& Needle);
+
+    /**
+     * Collect the texts of a field for an entry
+     * @param Entry Entry to read
+     * @param Field Field to collect
+     * @param OutTexts Array receiving the texts
+     */
+    static void GetFieldTexts(const FBlueprintCatalogEntry& Entry, EBlueprintSearchField Field, TArray<FString>& OutTexts);
+
+    /**
+     * Rank entries against a free-text query with BM25, tolerating typos
+     * Member texts (functions, variables, descriptions, comments) are only ranked on entries with member data.
+     * @param Query Free-text query
+     * @param MaxResults Maximum number of hits to return
+     * @param OutHits Hits sorted by descending score
+     * @param OutTotalMatches Optional number of entries matching at least one query token
+     */
+    static void RankedSearch(const FString& Query, int32 MaxResults, TArray<FBlueprintRankedHit>& OutHits, int32* OutTotalMatches = nullptr);
+
+    /**
+     * Find all functions with a matching signature
+     * Only covers entries with member data.
+     * @param Query Signature to look up
+     * @param OutMatches Matching functions, by entry id and index into the entry's functions
+     */
+    static void FindSignature(const FBlueprintSignatureQuery& Query, TArray<FBlueprintSignatureMatch>& OutMatches);
+
+    /**
+     * Find all entries with at least one node of the given class
+     * Only covers entries with member data.
+     * @param NodeClass Node class, with or without the K2Node_ prefix (case-insensitive)
+     * @param OutIds Sorted ids of the matching entries
+     */
+    static void FindEntriesWithNodeClass(const FString& NodeClass, TArray<int32>& OutIds);
+
+    /**
+     * Find all graphs with at least one node of the given class
+     * Only covers entries with member data.
+     * @param NodeClass Node class, with or without the K2Node_ prefix (case-insensitive)
+     * @param OutGraphs Matching graphs, sorted by entry id and graph index
+     */
+    static void FindGraphsWithNodeClass(const FString& NodeClass, TArray<FBlueprintGraphRef>& OutGraphs);
+
+    /**
+     * Find all graphs implementing the given event
+     * Only covers entries with member data.
+     * @param EventName Event name such as ReceiveTick, Tick or BeginPlay (case-insensitive)
+     * @param OutGraphs Matching graphs, sorted by entry id and graph index
+     */
+    static void FindGraphsWithEvent(const FString& EventName, TArray<FBlueprintGraphRef>& OutGraphs);
+
+    /**
+     * Bring a node class name to the form used as posting list key
+     * @param NodeClass Node class such as K2Node_CallFunction or CallFunction
+     * @return Lower-case class name without the K2Node_ prefix
+     */
+    static FString NormalizeNodeClass(const FString& NodeClass);
+
+    /**
+     * Bring an event name to the form used as posting list key, so ReceiveTick, Tick and Event Tick agree
+     * @param EventName Event name
+     * @return Lower-case event name without spaces and without the Receive or Event prefix
+     */
+    static FString NormalizeEventName(const FString& EventName);
+
+    /**
+     * Complete a prefix to blueprint names, paths, function names and event names
+     * Names and paths rank by blueprint size, functions and events by the number of blueprints defining them.
+     * Function and event names only come from entries with member data.
+     * @param Prefix Prefix to complete (case-insensitive)
+     * @param MaxResults Number of completions to return
+     * @param Kind Only return completions of this kind, if set
+     * @param OutCompletions Completions sorted by descending score
+     */
+    static void Complete(const FString& Prefix, int32 MaxResults, TOptional<EBlueprintCompletionKind> Kind, TArray<FBlueprintCompletion>& OutCompletions);
+
+    /**
+     * List a content folder with recursive blueprint and node counts
+     * Node counts only cover entries with member data.
+     * @param PackagePath Folder to list, e.g. /Game/Characters; empty or / lists the mount points
+     * @param OutListing Counts, subfolders and direct blueprints (entry ids) of the folder
+     * @return False if no blueprint lives in or below the folder
+     */
+    static bool GetFolderListing(const FString& PackagePath, FBlueprintFolderListing& OutListing);
+
+    /**
+     * Get the entries ranked highest by a metric
+     * Node, graph and variable counts only cover entries with member data; reference counts
+     * count the other blueprints depending on an entry's package.
+     * @param Metric Metric to rank by
+     * @param MaxResults Number of entries to return
+     * @param OutSlots Entry ids and metric values by descending value; entries with a value of 0 are left out
+     */
+    static void GetTop(EBlueprintLeaderboardMetric Metric, int32 MaxResults, TArray<FBlueprintLeaderboardSlot>& OutSlots);
+
+    /**
+     * Find all graph texts containing the needle (case-insensitive)
+     * Only covers entries with member data.
+     * @param Needle Substring to search for
+     * @param OutIds Sorted ids of the matching graph texts
+     */
+    static void FindGraphText(const FString& Needle, TArray<int32>& OutIds);
+
+    /**
+     * Get a graph text by id
+     * @param GraphTextId Id of the graph text
+     * @return The graph text, or nullptr if the id is not in use
+     */
+    static const FBlueprintGraphText* GetGraphText(int32 GraphTextId);
+
+private:
+    /** Asset registry and package save callbacks */
+    static void OnAssetAdded(const FAssetData& AssetData);
+    static void OnAssetRemoved(const FAssetData& AssetData);
+    static void OnAssetUpdated(const FAssetData& AssetData);
+    static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    static void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+    /**
+     * Add a blueprint asset to the catalog or update its basic data
+     * @param AssetData Asset registry data for the blueprint
+     * @return The entry id
+     */
+    static int32 AddOrUpdateAsset(const FAssetData& AssetData);
+
+    /**
+     * Remove an entry from the catalog
+     * @param EntryId Id of the entry to remove
+     */
+    static void RemoveEntry(int32 EntryId);
+
+    /**
+     * Re-extract function and variable data for an entry from a loaded blueprint
+     * @param EntryId Id of the entry to refresh
+     * @param Blueprint The loaded blueprint
+     */
+    static void RefreshMemberData(int32 EntryId, UBlueprint* Blueprint);
+
+    /**
+     * Collect node titles, comments and pin default values from all graphs of a loaded blueprint
+     * @param EntryId Id of the entry the texts belong to
+     * @param Blueprint The loaded blueprint
+     */
+    static void CollectGraphTexts(int32 EntryId, UBlueprint* Blueprint);
+
+    /**
+     * Remove all graph texts of an entry from the graph text index
+     * @param EntryId Id of the entry
+     */
+    static void ClearGraphTexts(int32 EntryId);
+
+    /**
+     * Collect the nodes and exec/data edges of all graphs of a loaded blueprint
+     * @param EntryId Id of the entry the summaries belong to
+     * @param Blueprint The loaded blueprint
+     */
+    static void CollectGraphSummaries(int32 EntryId, UBlueprint* Blueprint);
+
+    /**
+     * Add or remove all of an entry's texts to/from the trigram and ranked indexes
+     * @param EntryId Id of the entry
+     */
+    static void IndexEntry(int32 EntryId);
+    static void UnindexEntry(int32 EntryId);
+
+    /**
+     * Change the number of blueprints referencing a package, moving its entry on the reference leaderboard
+     * @param PackageName Referenced package
+     * @param Delta Change of the reference count
+     */
+    static void AdjustReferenceCount(FName PackageName, int32 Delta);
+
+    /** All entries, indexed by entry id */
+    static TArray<FBlueprintCatalogEntry> Entries;
+
+    /** Ids of removed entries available for reuse */
+    static TArray<int32> FreeEntryIds;
+
+    /** Map from object path to entry id */
+    static TMap<FString, int32> PathToEntryId;
+
+    /** Trigram index over names, paths, parent classes, functions and variables */
+    static FBlueprintTrigramIndex TrigramIndex;
+
+    /** Packed lower-cased copy of the trigram-indexed strings for scans the index cannot serve */
+    static FBlueprintNameArena NameArena;
+
+    /** Hash index over function signatures */
+    static FBlueprintSignatureIndex SignatureIndex;
+
+    /** Prefix trie over names, paths, function names and event names */
+    static FBlueprintCompletionTrie CompletionTrie;
+
+    /** Folder tree over package paths with recursive blueprint and node counts */
+    static FBlueprintPathTree PathTree;
+
+    /** Ordered indexes for each leaderboard metric */
+    static FBlueprintLeaderboard Leaderboards[static_cast<int32>(EBlueprintLeaderboardMetric::Count)];
+
+    /** Number of catalog blueprints depending on each package */
+    static TMap<FName, int32> IncomingReferenceCounts;
+
+    /** Map from package name to entry id */
+    static TMap<FName, int32> PackageToEntryId;
+
+    /** BM25 index over names, members, descriptions and node comments */
+    static FBlueprintRankedIndex RankedIndex;
+
+    /** All graph texts, indexed by graph text id */
+    static TArray<FBlueprintGraphText> GraphTexts;
+
+    /** Ids of removed graph texts available for reuse */
+    static TArray<int32> FreeGraphTextIds;
+
+    /** Trigram index over graph texts, keyed by graph text id */
+    static FBlueprintTrigramIndex GraphTextIndex;
+
+    /** Graphs keyed by normalized node class, sorted by entry id and graph index */
+    static TMap<FString, TArray<FBlueprintGraphRef>> NodeClassPostings;
+
+    /** Graphs keyed by normalized name of the events they implement, sorted by entry id and graph index */
+    static TMap<FString, TArray<FBlueprintGraphRef>> EventPostings;
+
+    /** Incremented whenever an asset is added, removed, updated, renamed or saved */
+    static uint64 Generation;
+
+    /** Whether the catalog has been built from the asset registry */
+    static bool bBuilt;
+
+    /** Delegate handles for change notifications */
+    static FDelegateHandle AssetAddedHandle;
+    static FDelegateHandle AssetRemovedHandle;
+    static FDelegateHandle AssetUpdatedHandle;
+    static FDelegateHandle AssetRenamedHandle;
+    static FDelegateHandle PackageSavedHandle;
+};
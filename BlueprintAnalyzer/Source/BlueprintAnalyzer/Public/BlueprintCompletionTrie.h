@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Enum defining what a completion term stands for
+ */
+enum class EBlueprintCompletionKind : uint8
+{
+    /** Blueprint asset name */
+    Name = 0,
+
+    /** Blueprint object path */
+    Path = 1,
+
+    /** Function name */
+    Function = 2,
+
+    /** Event name */
+    Event = 3
+};
+
+/**
+ * Data structure representing one completion
+ */
+struct BLUEPRINTANALYZER_API FBlueprintCompletion
+{
+    /** Completed text, in the casing it was first added with */
+    FString Text;
+
+    /** What the text stands for */
+    EBlueprintCompletionKind Kind = EBlueprintCompletionKind::Name;
+
+    /** Ranking score: blueprint size for names and paths, number of blueprints for functions and events */
+    int32 Score = 0;
+};
+
+/**
+ * Case-insensitive prefix trie over catalog terms for type-ahead completion.
+ * Every node keeps the best score in its subtree, so a top-k query descends to the prefix
+ * and then expands nodes best-first, touching only the few branches that can still
+ * contribute instead of enumerating every term under the prefix.
+ * Terms are reference counted: the same function name in several blueprints is one term
+ * whose score is the sum of what each blueprint contributed.
+ */
+class BLUEPRINTANALYZER_API FBlueprintCompletionTrie
+{
+public:
+    /**
+     * Add a reference to a term
+     * @param Kind What the term stands for
+     * @param Text Term text
+     * @param Score Score this reference contributes; must be positive
+     */
+    void Add(EBlueprintCompletionKind Kind, const FString& Text, int32 Score);
+
+    /**
+     * Remove a reference added with Add
+     * @param Kind What the term stands for
+     * @param Text Term text
+     * @param Score Score the reference contributed
+     */
+    void Remove(EBlueprintCompletionKind Kind, const FString& Text, int32 Score);
+
+    /**
+     * Find the best-scoring terms starting with a prefix (case-insensitive)
+     * @param Prefix Prefix to complete; empty returns the best terms overall
+     * @param MaxResults Number of completions to return
+     * @param Kind Only return terms of this kind, if set
+     * @param OutCompletions Completions sorted by descending score
+     */
+    void Complete(const FString& Prefix, int32 MaxResults, TOptional<EBlueprintCompletionKind> Kind, TArray<FBlueprintCompletion>& OutCompletions) const;
+
+    /**
+     * Remove all terms
+     */
+    void Reset();
+
+private:
+    /**
+     * Data structure representing one trie node
+     */
+    struct FNode
+    {
+        /** Child nodes keyed by the next lower-cased character, sorted by character */
+        TArray<TPair<TCHAR, int32>, TInlineAllocator<2>> Children;
+
+        /** Terms ending at this node, one per kind */
+        TArray<int32, TInlineAllocator<1>> TermIds;
+
+        /** Index of the parent node, INDEX_NONE for the root */
+        int32 Parent = INDEX_NONE;
+
+        /** Best term score in this node's subtree, 0 if the subtree holds no terms */
+        int32 MaxScore = 0;
+    };
+
+    /**
+     * Data structure representing one term
+     */
+    struct FTerm
+    {
+        FString Text;
+        EBlueprintCompletionKind Kind = EBlueprintCompletionKind::Name;
+        int32 Score = 0;
+        int32 RefCount = 0;
+        int32 NodeIndex = INDEX_NONE;
+    };
+
+    /**
+     * Find the node for a lower-cased key, optionally creating the path to it
+     * @return Index of the node, or INDEX_NONE if it doesn't exist and bCreate is false
+     */
+    int32 FindNode(const FString& Key, bool bCreate);
+
+    /** Const lookup of the node for a lower-cased key */
+    int32 FindNode(const FString& Key) const;
+
+    /**
+     * Recompute MaxScore from a node up to the root after one of its terms changed
+     * @param NodeIndex Node whose terms changed
+     */
+    void UpdateMaxScores(int32 NodeIndex);
+
+    /** Nodes, the root is index 0 */
+    TArray<FNode> Nodes;
+
+    /** Terms, indexed by term id */
+    TArray<FTerm> Terms;
+
+    /** Ids of removed terms available for reuse */
+    TArray<int32> FreeTermIds;
+};
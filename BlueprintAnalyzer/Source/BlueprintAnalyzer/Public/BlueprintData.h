@@ -76,6 +76,9 @@ struct BLUEPRINTANALYZER_API FBlueprintParamData
     /** Type of the parameter as a string */
     FString Type;
     
+    /** Full pin type including the referenced class, struct or enum and container, e.g. "Actor" or "Array<Vector>" */
+    FString FullType;
+    
     /** Whether this parameter is an output parameter */
     bool IsOutput = false;
     
@@ -215,6 +218,42 @@ struct BLUEPRINTANALYZER_API FBlueprintConnectionData
     FString TargetPinId;
 };
 
+/**
+ * Data structure representing how the nodes of a graph were cut to a node limit
+ */
+struct BLUEPRINTANALYZER_API FBlueprintNodePagination
+{
+    /** Number of nodes in the graph before the limit */
+    int32 TotalNodes = 0;
+    
+    /** Number of nodes included */
+    int32 ReturnedNodes = 0;
+    
+    /** Node limit that was applied */
+    int32 MaxNodes = 0;
+};
+
+/**
+ * Data structure representing which page of a blueprint's graphs is included
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphPagination
+{
+    /** Number of graphs in the blueprint before filtering and paging */
+    int32 TotalGraphs = 0;
+    
+    /** Number of graphs included */
+    int32 ReturnedGraphs = 0;
+    
+    /** Graph limit that was applied (0 = unlimited) */
+    int32 MaxGraphs = 0;
+    
+    /** Index of the first included graph among the graphs matching the filter */
+    int32 GraphOffset = 0;
+    
+    /** Whether more matching graphs follow this page */
+    bool HasMore = false;
+};
+
 /**
  * Data structure representing a complete graph in a blueprint
  */
@@ -234,6 +273,9 @@ struct BLUEPRINTANALYZER_API FBlueprintGraphData
     
     /** Additional metadata such as pagination information */
     TMap<FString, FString> Metadata;
+    
+    /** Set when the graph was cut to a node limit */
+    TOptional<FBlueprintNodePagination> Pagination;
 };
 
 /**
@@ -266,6 +308,87 @@ struct BLUEPRINTANALYZER_API FBlueprintReferenceData
     TMap<FString, FString> Properties;
 };
 
+/**
+ * Data structure representing a text match inside a blueprint graph
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphTextMatch
+{
+    /** Name of the blueprint containing the match */
+    FString BlueprintName;
+    
+    /** Path to the blueprint containing the match */
+    FString BlueprintPath;
+    
+    /** Name of the graph containing the node */
+    FString GraphName;
+    
+    /** Unique ID of the matching node */
+    FString NodeId;
+    
+    /** Title of the matching node */
+    FString NodeTitle;
+    
+    /** Field that matched (title, comment, commentBox, pinDefaultValue) */
+    FString Field;
+    
+    /** Name of the pin for pin default value matches */
+    FString PinName;
+    
+    /** Full text of the matched field */
+    FString Text;
+};
+
+/**
+ * Data structure representing an occurrence of a structural pattern inside a blueprint graph
+ */
+struct BLUEPRINTANALYZER_API FBlueprintPatternMatch
+{
+    /** Name of the blueprint containing the match */
+    FString BlueprintName;
+    
+    /** Path to the blueprint containing the match */
+    FString BlueprintPath;
+    
+    /** Name of the graph containing the matched nodes */
+    FString GraphName;
+    
+    /** Unique IDs of the matched nodes, one per pattern step */
+    TArray<FString> NodeIds;
+    
+    /** Titles of the matched nodes, one per pattern step */
+    TArray<FString> NodeTitles;
+};
+
+/**
+ * Data structure representing the graphs of one blueprint that use a node class or implement an event
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphUsage
+{
+    /** Name of the blueprint */
+    FString BlueprintName;
+    
+    /** Path to the blueprint */
+    FString BlueprintPath;
+    
+    /** Names of the graphs containing the node class or event */
+    TArray<FString> GraphNames;
+};
+
+/**
+ * Data structure representing one blueprint on a leaderboard
+ */
+struct BLUEPRINTANALYZER_API FBlueprintTopEntry
+{
+    /** Name of the blueprint */
+    FString BlueprintName;
+    
+    /** Path to the blueprint */
+    FString BlueprintPath;
+    
+    /** Value of the ranking metric */
+    int64 Value = 0;
+};
+
 /**
  * Data structure representing a complete blueprint
  */
@@ -297,4 +420,7 @@ struct BLUEPRINTANALYZER_API FBlueprintData
     
     /** Additional metadata such as pagination information */
     TMap<FString, FString> Metadata;
+    
+    /** Set when the graphs were filtered or paged */
+    TOptional<FBlueprintGraphPagination> GraphPagination;
 };
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "BlueprintData.h"
 
+struct FAssetData;
+struct FEdGraphPinType;
+
 /**
  * A class that handles extraction of blueprint data, including functions, variables, and connections
  */
@@ -31,6 +34,13 @@ public:
 	                                                   int32 MaxGraphs = 0,
 	                                                   int32 MaxNodes = 0);
 	   
+	/**
+	 * Extract basic data (name, path, parent class) from asset registry data without loading the asset
+	 * @param AssetData Asset registry data of the blueprint
+	 * @return Structured blueprint data with only the basic fields set
+	 */
+	static FBlueprintData ExtractBasicData(const FAssetData& AssetData);
+	   
 	/**
 	 * Extract detailed data from a blueprint asset
 	 * @param Blueprint The blueprint object to extract data from
@@ -53,6 +63,15 @@ public:
 	 * @return Array of reference data structures
 	 */
 	static TArray<FBlueprintReferenceData> GetBlueprintReferences(const FString& Path, bool bIncludeIndirect = false);
+	
+	/**
+	 * Describe a pin type by what it holds rather than just its category
+	 * Object, class, struct and enum pins are named after the referenced type, real pins are "float"
+	 * like in the editor, and containers wrap the element type, e.g. "Actor", "Array<Vector>", "Map<Name,int>".
+	 * @param PinType The pin type to describe
+	 * @return Full type name
+	 */
+	static FString GetFullPinType(const FEdGraphPinType& PinType);
     
 private:
 	/**
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintData.h"
+
+/**
+ * Flags describing how a field takes part in serialization
+ */
+enum class EBlueprintFieldFlags : uint8
+{
+    None = 0,
+
+    /** Left out whenever it is empty, in every layout */
+    OmitEmpty = 1 << 0,
+
+    /** Not part of the snake_case file export */
+    NotExported = 1 << 1
+};
+ENUM_CLASS_FLAGS(EBlueprintFieldFlags);
+
+/**
+ * Compile-time description of one serialized member of a blueprint data struct
+ */
+template <typename InStructType, typename InMemberType>
+struct TBlueprintField
+{
+    using StructType = InStructType;
+    using MemberType = InMemberType;
+
+    /** Field name in API responses (camelCase) */
+    const TCHAR* Name;
+
+    /** Field name in the file export (snake_case) */
+    const TCHAR* ExportName;
+
+    /** The described member */
+    MemberType StructType::* Member;
+
+    /** How the field takes part in serialization */
+    EBlueprintFieldFlags Flags;
+
+    /** Bit of the boolean in the "flags" column of compact graphs, 0 if it has none */
+    uint8 CompactFlag;
+};
+
+/**
+ * Describe a field
+ * @param Name Field name in API responses
+ * @param ExportName Field name in the file export
+ * @param Member The described member
+ * @param Flags How the field takes part in serialization
+ * @param CompactFlag Bit of a boolean in the "flags" column of compact graphs
+ */
+template <typename StructType, typename MemberType>
+constexpr TBlueprintField<StructType, MemberType> BlueprintField(
+    const TCHAR* Name,
+    const TCHAR* ExportName,
+    MemberType StructType::* Member,
+    EBlueprintFieldFlags Flags = EBlueprintFieldFlags::None,
+    uint8 CompactFlag = 0)
+{
+    return TBlueprintField<StructType, MemberType>{ Name, ExportName, Member, Flags, CompactFlag };
+}
+
+/**
+ * Field tables of the blueprint data structs.
+ * Each specialization lists the serialized fields once, in the order clients have always received
+ * them; Visit calls the visitor with each field's descriptor, so writers and readers for every
+ * layout are instantiated from the same list. Members without a descriptor are never serialized;
+ * optional members are written as a nested object only while they are set.
+ */
+template <typename StructType>
+struct TBlueprintFields;
+
+template <>
+struct TBlueprintFields<FBlueprintParamData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintParamData::Name));
+        Visitor(BlueprintField(TEXT("type"), TEXT("type"), &FBlueprintParamData::Type));
+        Visitor(BlueprintField(TEXT("fullType"), TEXT("full_type"), &FBlueprintParamData::FullType, EBlueprintFieldFlags::NotExported));
+        Visitor(BlueprintField(TEXT("isOutput"), TEXT("is_output"), &FBlueprintParamData::IsOutput));
+        Visitor(BlueprintField(TEXT("defaultValue"), TEXT("default_value"), &FBlueprintParamData::DefaultValue));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintFunctionData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintFunctionData::Name));
+        Visitor(BlueprintField(TEXT("isEvent"), TEXT("is_event"), &FBlueprintFunctionData::IsEvent));
+        Visitor(BlueprintField(TEXT("returnType"), TEXT("return_type"), &FBlueprintFunctionData::ReturnType));
+        Visitor(BlueprintField(TEXT("description"), TEXT("description"), &FBlueprintFunctionData::Description));
+        Visitor(BlueprintField(TEXT("isCallable"), TEXT("is_callable"), &FBlueprintFunctionData::IsCallable));
+        Visitor(BlueprintField(TEXT("isPure"), TEXT("is_pure"), &FBlueprintFunctionData::IsPure));
+        Visitor(BlueprintField(TEXT("params"), TEXT("parameters"), &FBlueprintFunctionData::Params));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintVariableData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintVariableData::Name));
+        Visitor(BlueprintField(TEXT("type"), TEXT("type"), &FBlueprintVariableData::Type));
+        Visitor(BlueprintField(TEXT("defaultValue"), TEXT("default_value"), &FBlueprintVariableData::DefaultValue));
+        Visitor(BlueprintField(TEXT("isExposed"), TEXT("is_exposed"), &FBlueprintVariableData::IsExposed));
+        Visitor(BlueprintField(TEXT("isReadOnly"), TEXT("is_read_only"), &FBlueprintVariableData::IsReadOnly));
+        Visitor(BlueprintField(TEXT("isReplicated"), TEXT("is_replicated"), &FBlueprintVariableData::IsReplicated));
+        Visitor(BlueprintField(TEXT("category"), TEXT("category"), &FBlueprintVariableData::Category));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintPinData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("pinId"), TEXT("pin_id"), &FBlueprintPinData::PinId));
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintPinData::Name));
+        Visitor(BlueprintField(TEXT("isExecution"), TEXT("is_execution"), &FBlueprintPinData::IsExecution, EBlueprintFieldFlags::None, 2));
+        Visitor(BlueprintField(TEXT("dataType"), TEXT("data_type"), &FBlueprintPinData::DataType));
+        Visitor(BlueprintField(TEXT("isConnected"), TEXT("is_connected"), &FBlueprintPinData::IsConnected, EBlueprintFieldFlags::None, 4));
+        Visitor(BlueprintField(TEXT("defaultValue"), TEXT("default_value"), &FBlueprintPinData::DefaultValue));
+        Visitor(BlueprintField(TEXT("isInput"), TEXT("is_input"), &FBlueprintPinData::IsInput, EBlueprintFieldFlags::None, 1));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintNodeData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("nodeId"), TEXT("node_id"), &FBlueprintNodeData::NodeId));
+        Visitor(BlueprintField(TEXT("nodeType"), TEXT("node_type"), &FBlueprintNodeData::NodeType));
+        Visitor(BlueprintField(TEXT("title"), TEXT("title"), &FBlueprintNodeData::Title));
+        Visitor(BlueprintField(TEXT("positionX"), TEXT("position_x"), &FBlueprintNodeData::PositionX));
+        Visitor(BlueprintField(TEXT("positionY"), TEXT("position_y"), &FBlueprintNodeData::PositionY));
+        Visitor(BlueprintField(TEXT("comment"), TEXT("comment"), &FBlueprintNodeData::Comment));
+        Visitor(BlueprintField(TEXT("inputPins"), TEXT("input_pins"), &FBlueprintNodeData::InputPins));
+        Visitor(BlueprintField(TEXT("outputPins"), TEXT("output_pins"), &FBlueprintNodeData::OutputPins));
+        Visitor(BlueprintField(TEXT("properties"), TEXT("properties"), &FBlueprintNodeData::Properties));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintConnectionData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("sourceNodeId"), TEXT("source_node_id"), &FBlueprintConnectionData::SourceNodeId));
+        Visitor(BlueprintField(TEXT("sourcePinId"), TEXT("source_pin_id"), &FBlueprintConnectionData::SourcePinId));
+        Visitor(BlueprintField(TEXT("targetNodeId"), TEXT("target_node_id"), &FBlueprintConnectionData::TargetNodeId));
+        Visitor(BlueprintField(TEXT("targetPinId"), TEXT("target_pin_id"), &FBlueprintConnectionData::TargetPinId));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintNodePagination>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("totalNodes"), TEXT("total_nodes"), &FBlueprintNodePagination::TotalNodes));
+        Visitor(BlueprintField(TEXT("returnedNodes"), TEXT("returned_nodes"), &FBlueprintNodePagination::ReturnedNodes));
+        Visitor(BlueprintField(TEXT("maxNodes"), TEXT("max_nodes"), &FBlueprintNodePagination::MaxNodes));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintGraphPagination>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("totalGraphs"), TEXT("total_graphs"), &FBlueprintGraphPagination::TotalGraphs));
+        Visitor(BlueprintField(TEXT("returnedGraphs"), TEXT("returned_graphs"), &FBlueprintGraphPagination::ReturnedGraphs));
+        Visitor(BlueprintField(TEXT("maxGraphs"), TEXT("max_graphs"), &FBlueprintGraphPagination::MaxGraphs));
+        Visitor(BlueprintField(TEXT("graphOffset"), TEXT("graph_offset"), &FBlueprintGraphPagination::GraphOffset));
+        Visitor(BlueprintField(TEXT("hasMore"), TEXT("has_more"), &FBlueprintGraphPagination::HasMore));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintGraphData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintGraphData::Name));
+        Visitor(BlueprintField(TEXT("graphType"), TEXT("graph_type"), &FBlueprintGraphData::GraphType));
+        Visitor(BlueprintField(TEXT("metadata"), TEXT("metadata"), &FBlueprintGraphData::Metadata, EBlueprintFieldFlags::OmitEmpty));
+        Visitor(BlueprintField(TEXT("nodes"), TEXT("nodes"), &FBlueprintGraphData::Nodes));
+        Visitor(BlueprintField(TEXT("connections"), TEXT("connections"), &FBlueprintGraphData::Connections));
+        Visitor(BlueprintField(TEXT("pagination"), TEXT("pagination"), &FBlueprintGraphData::Pagination));
+    }
+};
+
+template <>
+struct TBlueprintFields<FBlueprintData>
+{
+    template <typename VisitorType>
+    static void Visit(VisitorType&& Visitor)
+    {
+        Visitor(BlueprintField(TEXT("name"), TEXT("name"), &FBlueprintData::Name));
+        Visitor(BlueprintField(TEXT("path"), TEXT("path"), &FBlueprintData::Path));
+        Visitor(BlueprintField(TEXT("parentClass"), TEXT("parent_class"), &FBlueprintData::ParentClass));
+        Visitor(BlueprintField(TEXT("functions"), TEXT("functions"), &FBlueprintData::Functions));
+        Visitor(BlueprintField(TEXT("variables"), TEXT("variables"), &FBlueprintData::Variables));
+        Visitor(BlueprintField(TEXT("graphs"), TEXT("graphs"), &FBlueprintData::Graphs, EBlueprintFieldFlags::OmitEmpty | EBlueprintFieldFlags::NotExported));
+        Visitor(BlueprintField(TEXT("description"), TEXT("description"), &FBlueprintData::Description));
+        Visitor(BlueprintField(TEXT("metadata"), TEXT("metadata"), &FBlueprintData::Metadata, EBlueprintFieldFlags::OmitEmpty | EBlueprintFieldFlags::NotExported));
+        Visitor(BlueprintField(TEXT("graphPagination"), TEXT("graph_pagination"), &FBlueprintData::GraphPagination, EBlueprintFieldFlags::NotExported));
+    }
+};
@@ -0,0 +1,605 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintData.h"
+#include "BlueprintStringTable.h"
+#include "BlueprintDataFields.h"
+#include "Serialization/JsonReader.h"
+
+/**
+ * Options controlling how blueprint data is laid out in a response
+ */
+struct BLUEPRINTANALYZER_API FBlueprintSerializationOptions
+{
+    /**
+     * Write graphs as column arrays that refer to a per-response string table instead of one object per
+     * node, pin and connection; the table is written as a top-level "strings" array
+     */
+    bool bCompactGraphs = false;
+
+    /**
+     * Leave out fields holding their type's default: empty strings, false, 0 and empty arrays or objects.
+     * Clients treat a missing field as that default. Compact graph columns are positional and keep every entry.
+     */
+    bool bOmitDefaults = false;
+};
+
+/**
+ * Single-pass serialization of blueprint data.
+ * The traversals write fields straight into a writer instead of building a JSON DOM first, so a
+ * response costs one walk over the data and one output buffer however many graphs it contains.
+ * WriterType is any writer with the TJsonWriter interface: WriteObjectStart/WriteObjectEnd,
+ * WriteArrayStart/WriteArrayEnd and WriteValue, each with and without an identifier.
+ * Every writer and reader here is instantiated from the field tables in BlueprintDataFields.h, so
+ * the API, export and compact layouts and the JSON, CBOR and MessagePack encodings share one
+ * traversal per struct and cannot drift apart.
+ */
+class BLUEPRINTANALYZER_API FBlueprintDataSerializer
+{
+public:
+    /**
+     * Write one blueprint as an object value
+     * Graphs are always written as objects here, since a compact graph needs the string table of a whole response.
+     * @param Writer Writer positioned where a value is expected
+     * @param BlueprintData Blueprint to write
+     * @param Options Layout options
+     */
+    template <typename WriterType>
+    static void WriteBlueprint(WriterType& Writer, const FBlueprintData& BlueprintData, const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions())
+    {
+        WriteObject(Writer, BlueprintData, Options);
+    }
+
+    /**
+     * Write any described struct (blueprint, function, graph, node, ...) as an object value
+     * @param Writer Writer positioned where a value is expected
+     * @param Value Struct to write
+     * @param Options Layout options; compact graphs are ignored
+     */
+    template <typename WriterType, typename StructType>
+    static void WriteObject(WriterType& Writer, const StructType& Value, const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions())
+    {
+        const FWriteContext Context{ Options, nullptr, false };
+        Writer.WriteObjectStart();
+        WriteFields(Writer, Value, Context);
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Write any described struct as an object field
+     * @param Writer Writer positioned inside an object
+     * @param Identifier Name of the field
+     * @param Value Struct to write
+     * @param Options Layout options; compact graphs are ignored
+     */
+    template <typename WriterType, typename StructType>
+    static void WriteObject(WriterType& Writer, const TCHAR* Identifier, const StructType& Value, const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions())
+    {
+        const FWriteContext Context{ Options, nullptr, false };
+        Writer.WriteObjectStart(Identifier);
+        WriteFields(Writer, Value, Context);
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Write a "blueprints" array field with one object per blueprint
+     * With compact graphs, a "strings" array field holding the string table follows it.
+     * @param Writer Writer positioned inside an object
+     * @param Blueprints Blueprints to write
+     * @param Options Layout options
+     */
+    template <typename WriterType>
+    static void WriteBlueprintsField(WriterType& Writer, TConstArrayView<FBlueprintData> Blueprints, const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions())
+    {
+        FBlueprintStringTable StringTable;
+        const FWriteContext Context{ Options, Options.bCompactGraphs ? &StringTable : nullptr, false };
+
+        Writer.WriteArrayStart(TEXT("blueprints"));
+        for (const FBlueprintData& BlueprintData : Blueprints)
+        {
+            Writer.WriteObjectStart();
+            WriteFields(Writer, BlueprintData, Context);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+
+        // Indices are handed out while the graphs are written, so the table can only follow them
+        if (Context.Strings)
+        {
+            Writer.WriteArrayStart(TEXT("strings"));
+            for (FStringView Text : Context.Strings->GetStrings())
+            {
+                Writer.WriteValue(FString(Text));
+            }
+            Writer.WriteArrayEnd();
+        }
+    }
+
+    /**
+     * Write one blueprint in the snake_case layout of the periodic file export (no graphs)
+     * @param Writer Writer positioned where a value is expected
+     * @param BlueprintData Blueprint to write
+     */
+    template <typename WriterType>
+    static void WriteExportBlueprint(WriterType& Writer, const FBlueprintData& BlueprintData)
+    {
+        const FBlueprintSerializationOptions Options;
+        const FWriteContext Context{ Options, nullptr, true };
+        Writer.WriteObjectStart();
+        WriteFields(Writer, BlueprintData, Context);
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Read any described struct from a JSON token stream in the API object layout, without building a DOM
+     * Unknown fields are skipped and a missing field reads as its type's default, matching the omitDefaults
+     * layout; compact graphs are not readable.
+     * @param Reader Reader whose next token starts the object
+     * @param OutValue Struct to fill
+     * @return Whether the object was read up to its end
+     */
+    template <typename CharType, typename StructType>
+    static bool ReadObject(TJsonReader<CharType>& Reader, StructType& OutValue)
+    {
+        EJsonNotation Notation;
+        return Reader.ReadNext(Notation) && Notation == EJsonNotation::ObjectStart && ReadFields(Reader, OutValue);
+    }
+
+    /**
+     * Read the "blueprints" array of a response document, skipping every other field
+     * @param Reader Reader whose next token starts the document
+     * @param OutBlueprints Array the blueprints are appended to
+     * @return Whether the document was read up to its end
+     */
+    template <typename CharType>
+    static bool ReadBlueprintsField(TJsonReader<CharType>& Reader, TArray<FBlueprintData>& OutBlueprints)
+    {
+        EJsonNotation Notation;
+        if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+        {
+            return false;
+        }
+
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ObjectEnd)
+            {
+                return true;
+            }
+
+            const bool bRead = Notation == EJsonNotation::ArrayStart && FCString::Strcmp(*Reader.GetIdentifier(), TEXT("blueprints")) == 0
+                ? ReadArrayElements(Reader, OutBlueprints)
+                : SkipValue(Reader, Notation);
+            if (!bRead)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+private:
+    /** State shared by one serialization pass */
+    struct FWriteContext
+    {
+        /** Layout options */
+        const FBlueprintSerializationOptions& Options;
+
+        /** String table for compact graphs, null for the object layout */
+        FBlueprintStringTable* Strings;
+
+        /** Whether the snake_case export names are written instead of the API names */
+        bool bExport;
+    };
+
+    /** Write the fields of a struct, in the order of its field table */
+    template <typename WriterType, typename StructType>
+    static void WriteFields(WriterType& Writer, const StructType& Value, const FWriteContext& Context)
+    {
+        TBlueprintFields<StructType>::Visit([&Writer, &Value, &Context](const auto& Field)
+        {
+            if (Context.bExport && EnumHasAnyFlags(Field.Flags, EBlueprintFieldFlags::NotExported))
+            {
+                return;
+            }
+            WriteMember(Writer, Context.bExport ? Field.ExportName : Field.Name, Value.*Field.Member, Field.Flags, Context);
+        });
+    }
+
+    /** Write a string, boolean or integer field unless defaults are omitted and it holds the default of its type */
+    template <typename WriterType, typename ValueType>
+    static void WriteMember(WriterType& Writer, const TCHAR* Identifier, const ValueType& Value, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        if (!Context.Options.bOmitDefaults || Value != ValueType())
+        {
+            Writer.WriteValue(Identifier, Value);
+        }
+    }
+
+    /** Write an array field with one object per element */
+    template <typename WriterType, typename ElementType>
+    static void WriteMember(WriterType& Writer, const TCHAR* Identifier, const TArray<ElementType>& Value, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        if (ShouldWriteContainer(Value.Num(), Flags, Context))
+        {
+            Writer.WriteArrayStart(Identifier);
+            for (const ElementType& Element : Value)
+            {
+                WriteElement(Writer, Element, Context);
+            }
+            Writer.WriteArrayEnd();
+        }
+    }
+
+    /** Write a string map as an object field with one string field per key */
+    template <typename WriterType>
+    static void WriteMember(WriterType& Writer, const TCHAR* Identifier, const TMap<FString, FString>& Value, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        if (ShouldWriteContainer(Value.Num(), Flags, Context))
+        {
+            Writer.WriteObjectStart(Identifier);
+            for (const TPair<FString, FString>& Item : Value)
+            {
+                Writer.WriteValue(Item.Key, Item.Value);
+            }
+            Writer.WriteObjectEnd();
+        }
+    }
+
+    /** Write an optional struct as an object field while it is set */
+    template <typename WriterType, typename StructType>
+    static void WriteMember(WriterType& Writer, const TCHAR* Identifier, const TOptional<StructType>& Value, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        if (Value.IsSet())
+        {
+            Writer.WriteObjectStart(Identifier);
+            WriteFields(Writer, Value.GetValue(), Context);
+            Writer.WriteObjectEnd();
+        }
+    }
+
+    /** Whether an array or map field is written: always, unless it is empty and either its table or the options leave empty ones out */
+    static bool ShouldWriteContainer(int32 Num, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        return Num > 0 || !(Context.Options.bOmitDefaults || EnumHasAnyFlags(Flags, EBlueprintFieldFlags::OmitEmpty));
+    }
+
+    template <typename WriterType, typename StructType>
+    static void WriteElement(WriterType& Writer, const StructType& Element, const FWriteContext& Context)
+    {
+        Writer.WriteObjectStart();
+        WriteFields(Writer, Element, Context);
+        Writer.WriteObjectEnd();
+    }
+
+    /** Graphs switch to the column layout when the pass has a string table */
+    template <typename WriterType>
+    static void WriteElement(WriterType& Writer, const FBlueprintGraphData& Graph, const FWriteContext& Context)
+    {
+        Writer.WriteObjectStart();
+        if (Context.Strings)
+        {
+            TBlueprintFields<FBlueprintGraphData>::Visit([&Writer, &Graph, &Context](const auto& Field)
+            {
+                WriteCompactMember(Writer, Field.Name, Graph.*Field.Member, Field.Flags, Context);
+            });
+        }
+        else
+        {
+            WriteFields(Writer, Graph, Context);
+        }
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Compact graphs keep their scalar fields and metadata as they are and turn the node and connection
+     * arrays into columns: one array per field with one entry per row, in the order of the row's field table.
+     * Strings are indices into the string table, string maps are flat [key, value, key, value, ...] arrays
+     * per row, and booleans are packed into a "flags" column using each field's CompactFlag bit
+     * (pins: isInput 1, isExecution 2, isConnected 4).
+     */
+    template <typename WriterType, typename ValueType>
+    static void WriteCompactMember(WriterType& Writer, const TCHAR* Identifier, const ValueType& Value, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        WriteMember(Writer, Identifier, Value, Flags, Context);
+    }
+
+    /** Nodes are followed by a "pins" object listing the pins node by node, inputs first, with "node" holding the row of their node */
+    template <typename WriterType>
+    static void WriteCompactMember(WriterType& Writer, const TCHAR* Identifier, const TArray<FBlueprintNodeData>& Nodes, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        FBlueprintStringTable& Strings = *Context.Strings;
+
+        Writer.WriteObjectStart(Identifier);
+        WriteColumns<FBlueprintNodeData>(Writer, [&Nodes](auto&& OnRow)
+        {
+            for (const FBlueprintNodeData& Node : Nodes)
+            {
+                OnRow(Node);
+            }
+        }, Strings);
+        Writer.WriteObjectEnd();
+
+        Writer.WriteObjectStart(TEXT("pins"));
+        Writer.WriteArrayStart(TEXT("node"));
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            for (int32 PinIndex = Nodes[NodeIndex].InputPins.Num() + Nodes[NodeIndex].OutputPins.Num(); PinIndex > 0; --PinIndex)
+            {
+                Writer.WriteValue(NodeIndex);
+            }
+        }
+        Writer.WriteArrayEnd();
+        WriteColumns<FBlueprintPinData>(Writer, [&Nodes](auto&& OnRow)
+        {
+            for (const FBlueprintNodeData& Node : Nodes)
+            {
+                for (const FBlueprintPinData& Pin : Node.InputPins)
+                {
+                    OnRow(Pin);
+                }
+                for (const FBlueprintPinData& Pin : Node.OutputPins)
+                {
+                    OnRow(Pin);
+                }
+            }
+        }, Strings);
+        Writer.WriteObjectEnd();
+    }
+
+    template <typename WriterType>
+    static void WriteCompactMember(WriterType& Writer, const TCHAR* Identifier, const TArray<FBlueprintConnectionData>& Connections, EBlueprintFieldFlags Flags, const FWriteContext& Context)
+    {
+        Writer.WriteObjectStart(Identifier);
+        WriteColumns<FBlueprintConnectionData>(Writer, [&Connections](auto&& OnRow)
+        {
+            for (const FBlueprintConnectionData& Connection : Connections)
+            {
+                OnRow(Connection);
+            }
+        }, *Context.Strings);
+        Writer.WriteObjectEnd();
+    }
+
+    /**
+     * Write one column per field of StructType
+     * @param ForEachRow Callable invoking its argument with every row, in row order
+     */
+    template <typename StructType, typename WriterType, typename ForEachRowType>
+    static void WriteColumns(WriterType& Writer, const ForEachRowType& ForEachRow, FBlueprintStringTable& Strings)
+    {
+        int32 FlagMask = 0;
+        TBlueprintFields<StructType>::Visit([&Writer, &ForEachRow, &Strings, &FlagMask](const auto& Field)
+        {
+            WriteColumn(Writer, Field.Name, Field.Member, ForEachRow, Strings);
+            FlagMask |= Field.CompactFlag;
+        });
+
+        if (FlagMask != 0)
+        {
+            Writer.WriteArrayStart(TEXT("flags"));
+            ForEachRow([&Writer](const StructType& Row)
+            {
+                int32 RowFlags = 0;
+                TBlueprintFields<StructType>::Visit([&Row, &RowFlags](const auto& Field)
+                {
+                    RowFlags |= GetCompactFlag(Row, Field);
+                });
+                Writer.WriteValue(RowFlags);
+            });
+            Writer.WriteArrayEnd();
+        }
+    }
+
+    /** Booleans go to the "flags" column and nested arrays are flattened by the graph, so neither gets a column of its own */
+    template <typename WriterType, typename StructType, typename MemberType, typename ForEachRowType>
+    static void WriteColumn(WriterType& Writer, const TCHAR* Identifier, MemberType StructType::* Member, const ForEachRowType& ForEachRow, FBlueprintStringTable& Strings)
+    {
+    }
+
+    template <typename WriterType, typename StructType, typename ForEachRowType>
+    static void WriteColumn(WriterType& Writer, const TCHAR* Identifier, FString StructType::* Member, const ForEachRowType& ForEachRow, FBlueprintStringTable& Strings)
+    {
+        Writer.WriteArrayStart(Identifier);
+        ForEachRow([&Writer, Member, &Strings](const StructType& Row)
+        {
+            Writer.WriteValue(Strings.Add(Row.*Member));
+        });
+        Writer.WriteArrayEnd();
+    }
+
+    template <typename WriterType, typename StructType, typename ForEachRowType>
+    static void WriteColumn(WriterType& Writer, const TCHAR* Identifier, int32 StructType::* Member, const ForEachRowType& ForEachRow, FBlueprintStringTable& Strings)
+    {
+        Writer.WriteArrayStart(Identifier);
+        ForEachRow([&Writer, Member](const StructType& Row)
+        {
+            Writer.WriteValue(Row.*Member);
+        });
+        Writer.WriteArrayEnd();
+    }
+
+    template <typename WriterType, typename StructType, typename ForEachRowType>
+    static void WriteColumn(WriterType& Writer, const TCHAR* Identifier, TMap<FString, FString> StructType::* Member, const ForEachRowType& ForEachRow, FBlueprintStringTable& Strings)
+    {
+        Writer.WriteArrayStart(Identifier);
+        ForEachRow([&Writer, Member, &Strings](const StructType& Row)
+        {
+            Writer.WriteArrayStart();
+            for (const TPair<FString, FString>& Item : Row.*Member)
+            {
+                Writer.WriteValue(Strings.Add(Item.Key));
+                Writer.WriteValue(Strings.Add(Item.Value));
+            }
+            Writer.WriteArrayEnd();
+        });
+        Writer.WriteArrayEnd();
+    }
+
+    template <typename StructType, typename MemberType>
+    static int32 GetCompactFlag(const StructType& Row, const TBlueprintField<StructType, MemberType>& Field)
+    {
+        return 0;
+    }
+
+    template <typename StructType>
+    static int32 GetCompactFlag(const StructType& Row, const TBlueprintField<StructType, bool>& Field)
+    {
+        return Row.*Field.Member ? Field.CompactFlag : 0;
+    }
+
+    /**
+     * Read the fields of an object whose start token was just read, up to and including its end
+     * Fields are matched against the struct's table as they arrive, so no DOM or per-field lookup map is built.
+     */
+    template <typename CharType, typename StructType>
+    static bool ReadFields(TJsonReader<CharType>& Reader, StructType& OutValue)
+    {
+        // Start from the wire defaults, which differ from the struct defaults for pins' isInput
+        TBlueprintFields<StructType>::Visit([&OutValue](const auto& Field)
+        {
+            using MemberType = typename TDecay<decltype(Field)>::Type::MemberType;
+            OutValue.*Field.Member = MemberType();
+        });
+
+        EJsonNotation Notation;
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ObjectEnd)
+            {
+                return true;
+            }
+
+            const FString& Identifier = Reader.GetIdentifier();
+            bool bKnown = false;
+            bool bRead = true;
+            TBlueprintFields<StructType>::Visit([&Reader, Notation, &Identifier, &OutValue, &bKnown, &bRead](const auto& Field)
+            {
+                if (!bKnown && FCString::Strcmp(*Identifier, Field.Name) == 0)
+                {
+                    bKnown = true;
+                    bRead = ReadMember(Reader, Notation, OutValue.*Field.Member);
+                }
+            });
+
+            if (!(bKnown ? bRead : SkipValue(Reader, Notation)))
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /** Values of an unexpected type are skipped and leave the field at its default */
+    template <typename CharType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, FString& OutValue)
+    {
+        if (Notation == EJsonNotation::String)
+        {
+            OutValue = Reader.GetValueAsString();
+            return true;
+        }
+        return SkipValue(Reader, Notation);
+    }
+
+    template <typename CharType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, bool& OutValue)
+    {
+        if (Notation == EJsonNotation::Boolean)
+        {
+            OutValue = Reader.GetValueAsBoolean();
+            return true;
+        }
+        return SkipValue(Reader, Notation);
+    }
+
+    template <typename CharType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, int32& OutValue)
+    {
+        if (Notation == EJsonNotation::Number)
+        {
+            OutValue = static_cast<int32>(Reader.GetValueAsNumber());
+            return true;
+        }
+        return SkipValue(Reader, Notation);
+    }
+
+    template <typename CharType, typename ElementType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, TArray<ElementType>& OutValue)
+    {
+        return Notation == EJsonNotation::ArrayStart ? ReadArrayElements(Reader, OutValue) : SkipValue(Reader, Notation);
+    }
+
+    template <typename CharType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, TMap<FString, FString>& OutValue)
+    {
+        if (Notation != EJsonNotation::ObjectStart)
+        {
+            return SkipValue(Reader, Notation);
+        }
+
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ObjectEnd)
+            {
+                return true;
+            }
+
+            if (Notation == EJsonNotation::String)
+            {
+                OutValue.Add(Reader.GetIdentifier(), Reader.GetValueAsString());
+            }
+            else if (!SkipValue(Reader, Notation))
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    template <typename CharType, typename StructType>
+    static bool ReadMember(TJsonReader<CharType>& Reader, EJsonNotation Notation, TOptional<StructType>& OutValue)
+    {
+        return Notation == EJsonNotation::ObjectStart ? ReadFields(Reader, OutValue.Emplace()) : SkipValue(Reader, Notation);
+    }
+
+    /** Read the elements of an array whose start token was just read, appending one struct per object */
+    template <typename CharType, typename ElementType>
+    static bool ReadArrayElements(TJsonReader<CharType>& Reader, TArray<ElementType>& OutValue)
+    {
+        EJsonNotation Notation;
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ArrayEnd)
+            {
+                return true;
+            }
+
+            const bool bRead = Notation == EJsonNotation::ObjectStart
+                ? ReadFields(Reader, OutValue.AddDefaulted_GetRef())
+                : SkipValue(Reader, Notation);
+            if (!bRead)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /** Skip the value whose first token was just read */
+    template <typename CharType>
+    static bool SkipValue(TJsonReader<CharType>& Reader, EJsonNotation Notation)
+    {
+        switch (Notation)
+        {
+        case EJsonNotation::ObjectStart:
+            return Reader.SkipObject();
+        case EJsonNotation::ArrayStart:
+            return Reader.SkipArray();
+        case EJsonNotation::Error:
+            return false;
+        default:
+            return true;
+        }
+    }
+};
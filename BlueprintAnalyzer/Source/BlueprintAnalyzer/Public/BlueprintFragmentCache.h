@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "BlueprintData.h"
+#include "BlueprintBinaryWriter.h"
+#include "BlueprintDataSerializer.h"
+
+/**
+ * Data structure representing the counters of the fragment cache
+ */
+struct BLUEPRINTANALYZER_API FBlueprintFragmentCacheStats
+{
+    /** Blueprints served from a cached fragment */
+    int64 Hits = 0;
+
+    /** Blueprints that had to be extracted and serialized */
+    int64 Misses = 0;
+
+    /** Fragments currently cached */
+    int32 NumEntries = 0;
+
+    /** Total size of the cached fragments in bytes */
+    int64 NumBytes = 0;
+
+    /** Maximum total size of the cached fragments in bytes */
+    int64 MaxBytes = 0;
+};
+
+/**
+ * Cache of serialized blueprint objects keyed by blueprint, detail level, wire format and layout.
+ * A fragment is one complete blueprint object in the format's encoding, so list responses are
+ * assembled by copying fragments into the blueprints array instead of extracting and serializing
+ * every blueprint again. Each fragment carries the catalog revision of its blueprint and is only
+ * returned while the blueprint's revision is unchanged; least recently used fragments are evicted
+ * once the byte budget is reached.
+ */
+class BLUEPRINTANALYZER_API FBlueprintFragmentCache
+{
+public:
+    /** Maximum number of cached fragments */
+    static constexpr int32 MaxEntries = 32768;
+
+    /** Maximum total size of the cached fragments in bytes */
+    static constexpr int64 MaxBytes = 256 * 1024 * 1024;
+
+    /**
+     * Look up the fragment of a blueprint
+     * @param Path Object path of the blueprint
+     * @param DetailLevel Detail level the fragment was extracted at
+     * @param Format Encoding of the fragment
+     * @param Options Layout the fragment was written with; compact graphs are never cached
+     * @param Revision Current catalog revision of the blueprint
+     * @return The fragment, or null if none is cached for this revision
+     */
+    static TSharedPtr<const TArray<uint8>> Find(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options, uint64 Revision);
+
+    /**
+     * Cache the fragment of a blueprint, replacing any older revision
+     * @param Path Object path of the blueprint
+     * @param DetailLevel Detail level the fragment was extracted at
+     * @param Format Encoding of the fragment
+     * @param Options Layout the fragment was written with
+     * @param Revision Catalog revision of the blueprint the fragment was serialized from
+     * @param Fragment Encoded blueprint object
+     */
+    static void Add(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options, uint64 Revision, const TSharedRef<const TArray<uint8>>& Fragment);
+
+    /**
+     * Get the hit and miss counters and the cache size
+     * @return Current counters
+     */
+    static FBlueprintFragmentCacheStats GetStats();
+
+    /**
+     * Drop all cached fragments and reset the counters
+     */
+    static void Reset();
+
+private:
+    /** A cached fragment and the revision it was serialized from */
+    struct FFragment
+    {
+        uint64 Revision = 0;
+        TSharedPtr<const TArray<uint8>> Bytes;
+    };
+
+    /**
+     * Build the cache key of a fragment
+     * @return Key combining the detail level, format, layout and path
+     */
+    static FString MakeKey(const FString& Path, EBlueprintDetailLevel DetailLevel, EBlueprintWireFormat Format, const FBlueprintSerializationOptions& Options);
+
+    /**
+     * Remove a cached fragment and its bytes from the total
+     * @param Key Key of the fragment
+     */
+    static void Remove(const FString& Key);
+
+    /** Cached fragments keyed by MakeKey */
+    static TLruCache<FString, FFragment> Fragments;
+
+    /** Total size of the cached fragments */
+    static int64 NumBytes;
+
+    /** Counters */
+    static int64 Hits;
+    static int64 Misses;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FBlueprintGraphSummary;
+struct FBlueprintGraphSummaryNode;
+
+/**
+ * Enum defining how two consecutive nodes of a pattern have to be connected
+ */
+enum class EBlueprintPatternEdge : uint8
+{
+    /** An exec output of the first node is wired directly to the second (-exec-> or ->) */
+    Exec = 0,
+
+    /** A data output of the first node feeds an input of the second (-data->) */
+    Data = 1,
+
+    /** The second node runs somewhere after the first along exec wires (-exec*->) */
+    ExecReachable = 2
+};
+
+/**
+ * Data structure representing one node of a graph pattern
+ */
+struct BLUEPRINTANALYZER_API FBlueprintPatternStep
+{
+    /** Node class to match, normalized like catalog node classes; empty matches any node */
+    FString NodeClass;
+
+    /** Substring the node title has to contain (case-insensitive); empty matches any title */
+    FString Title;
+};
+
+/**
+ * Data structure representing a parsed graph pattern: a chain of nodes and the edges between them
+ */
+struct BLUEPRINTANALYZER_API FBlueprintGraphPattern
+{
+    /** Nodes of the chain, in order */
+    TArray<FBlueprintPatternStep> Steps;
+
+    /** Edges between consecutive steps; Edges[i] connects Steps[i] and Steps[i + 1] */
+    TArray<EBlueprintPatternEdge> Edges;
+};
+
+/**
+ * Parser and matcher for structural graph patterns such as
+ *   Event[Tick] -exec-> DynamicCast
+ *   MacroInstance[For Each Loop] -exec*-> CallFunction[Get All Actors Of Class]
+ *   CallFunction[Get Player Character] -data-> DynamicCast
+ * A step is a node class (with or without the K2Node_ prefix, or * for any node) optionally
+ * followed by a title substring in brackets. Matching is a backtracking subgraph search over
+ * the catalog's graph summaries; every node of a match is distinct.
+ */
+class BLUEPRINTANALYZER_API FBlueprintPatternMatcher
+{
+public:
+    /**
+     * Parse a pattern expression
+     * @param Expression The pattern text
+     * @param OutError Description of the syntax error if parsing fails
+     * @return The parsed pattern, or nullptr on error
+     */
+    static TSharedPtr<FBlueprintGraphPattern> Parse(const FString& Expression, FString& OutError);
+
+    /**
+     * Find all occurrences of a pattern in one graph
+     * @param Graph Graph summary to search
+     * @param Pattern Parsed pattern
+     * @param MaxMatches Stop after this many matches (0 for no limit)
+     * @param OutMatches Node indices of each match, one per pattern step
+     */
+    static void Match(const FBlueprintGraphSummary& Graph, const FBlueprintGraphPattern& Pattern, int32 MaxMatches, TArray<TArray<int32>>& OutMatches);
+
+    /**
+     * Check whether a graph node fits a pattern step
+     * @param Step Pattern step
+     * @param Node Graph node
+     * @return True if the class and title constraints hold
+     */
+    static bool StepMatches(const FBlueprintPatternStep& Step, const FBlueprintGraphSummaryNode& Node);
+
+private:
+    /**
+     * Extend a partial match by the next step, backtracking over every candidate successor
+     * @param Graph Graph summary being searched
+     * @param Pattern Parsed pattern
+     * @param MaxMatches Stop after this many matches (0 for no limit)
+     * @param Current Node indices matched so far
+     * @param OutMatches Completed matches
+     * @return False once MaxMatches has been reached
+     */
+    static bool Extend(const FBlueprintGraphSummary& Graph, const FBlueprintGraphPattern& Pattern, int32 MaxMatches,
+                       TArray<int32>& Current, TArray<TArray<int32>>& OutMatches);
+
+    /**
+     * Collect the nodes reachable from a node over an edge kind
+     * @param Graph Graph summary being searched
+     * @param NodeIndex Node to start from
+     * @param Edge Edge kind to follow
+     * @param OutSuccessors Indices of the reachable nodes
+     */
+    static void GetSuccessors(const FBlueprintGraphSummary& Graph, int32 NodeIndex, EBlueprintPatternEdge Edge, TArray<int32>& OutSuccessors);
+};
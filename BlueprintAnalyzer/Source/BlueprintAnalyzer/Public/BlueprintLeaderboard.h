@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Enum defining the metrics blueprints can be ranked by
+ */
+enum class EBlueprintLeaderboardMetric : uint8
+{
+    /** Total number of nodes over all graphs */
+    NodeCount = 0,
+
+    /** Number of graphs */
+    GraphCount = 1,
+
+    /** Number of variables */
+    VariableCount = 2,
+
+    /** Number of other blueprints referencing the blueprint's package */
+    ReferenceCount = 3,
+
+    /** Size of the package on disk in bytes */
+    PackageSize = 4,
+
+    /** Number of metrics */
+    Count
+};
+
+/**
+ * Data structure representing one ranked entry of a leaderboard
+ */
+struct BLUEPRINTANALYZER_API FBlueprintLeaderboardSlot
+{
+    /** Id of the entry (catalog entry id) */
+    int32 EntryId = INDEX_NONE;
+
+    /** Metric value of the entry */
+    int64 Value = 0;
+};
+
+/**
+ * Entries ordered by descending metric value, ties broken by ascending entry id.
+ * Kept sorted on every change, so the top k is a prefix of the array; an update is a
+ * binary search plus one move of the tail, which stays cheap at project scale.
+ * Entries with a value of 0 are not stored.
+ */
+class BLUEPRINTANALYZER_API FBlueprintLeaderboard
+{
+public:
+    /**
+     * Add an entry
+     * @param EntryId Id of the entry (catalog entry id)
+     * @param Value Metric value of the entry
+     */
+    void Add(int32 EntryId, int64 Value);
+
+    /**
+     * Remove an entry with the value it was added with
+     * @param EntryId Id of the entry (catalog entry id)
+     * @param Value Metric value the entry was added with
+     */
+    void Remove(int32 EntryId, int64 Value);
+
+    /**
+     * Get the highest ranked entries
+     * @param MaxResults Number of entries to return
+     * @param OutSlots Entries by descending value
+     */
+    void GetTop(int32 MaxResults, TArray<FBlueprintLeaderboardSlot>& OutSlots) const;
+
+    /**
+     * Get the number of ranked entries (entries with a non-zero value)
+     */
+    int32 Num() const;
+
+    /**
+     * Remove all entries
+     */
+    void Reset();
+
+private:
+    /** Find the position of a slot, or where it would be inserted */
+    int32 LowerBound(int32 EntryId, int64 Value) const;
+
+    /** Ranked entries */
+    TArray<FBlueprintLeaderboardSlot> Slots;
+};
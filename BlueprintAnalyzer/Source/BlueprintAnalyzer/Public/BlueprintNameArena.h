@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintTrigramIndex.h"
+
+/**
+ * Packed, case-folded copy of the catalog's searchable strings for brute-force substring scans.
+ * Every field keeps its strings lower-cased and UTF-8 encoded in one contiguous byte arena,
+ * separated by zero bytes so a match can never span two strings. Scans use a vectorized
+ * first/last-byte filter and only compare the full needle where both bytes match, which
+ * serves the needles the trigram index cannot (shorter than three characters) without
+ * touching a single FString.
+ */
+class BLUEPRINTANALYZER_API FBlueprintNameArena
+{
+public:
+    /**
+     * Append the texts of one field of a document to the arena
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Field Field the texts belong to
+     * @param Texts All texts of this field for the document
+     */
+    void AddDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts);
+
+    /**
+     * Remove all texts of one field of a document from the arena
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Field Field to remove
+     */
+    void RemoveDocument(int32 DocumentId, EBlueprintSearchField Field);
+
+    /**
+     * Find all documents whose field contains the needle (case-insensitive)
+     * @param Field Field to scan
+     * @param Needle Substring to search for; must not be empty
+     * @param OutDocumentIds Sorted ids of the matching documents
+     */
+    void Find(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutDocumentIds) const;
+
+    /**
+     * Remove all documents from the arena
+     */
+    void Reset();
+
+    /**
+     * Get the number of bytes held by the arena, including dead space not yet compacted
+     * @return Allocated size in bytes
+     */
+    SIZE_T GetAllocatedSize() const;
+
+    /**
+     * Convert text to the arena's lower-cased UTF-8 form
+     * @param Text Text to convert
+     * @param OutBytes Array receiving the bytes (no terminator)
+     */
+    static void FoldText(const FString& Text, TArray<uint8>& OutBytes);
+
+    /**
+     * Find the first occurrence of a byte string with the vectorized first/last-byte filter
+     * @param Haystack Bytes to scan
+     * @param HaystackLength Number of bytes to scan
+     * @param Needle Bytes to look for
+     * @param NeedleLength Number of needle bytes, at least 1
+     * @return Index of the first match, or INDEX_NONE
+     */
+    static int32 FindBytes(const uint8* Haystack, int32 HaystackLength, const uint8* Needle, int32 NeedleLength);
+
+private:
+    /**
+     * Data structure representing one string stored in an arena
+     */
+    struct FRecord
+    {
+        /** Offset of the first byte in the arena */
+        int32 Offset;
+
+        /** Number of bytes, excluding the separator */
+        int32 Length;
+
+        /** Id of the owning document, or INDEX_NONE once removed */
+        int32 DocumentId;
+    };
+
+    /**
+     * Data structure representing the arena of one field
+     */
+    struct FFieldArena
+    {
+        /** Case-folded UTF-8 strings, each followed by a zero byte */
+        TArray<uint8> Bytes;
+
+        /** Records in arena order, so they are sorted by offset */
+        TArray<FRecord> Records;
+
+        /** Record indices of every document, needed to remove it again */
+        TMap<int32, TArray<int32>> DocumentRecords;
+
+        /** Bytes belonging to removed records */
+        int32 DeadBytes = 0;
+    };
+
+    /**
+     * Drop removed records and close the gaps they left
+     * @param Arena Arena to compact
+     */
+    static void Compact(FFieldArena& Arena);
+
+    /** Number of fields the arena covers */
+    static constexpr int32 NumFields = static_cast<int32>(EBlueprintSearchField::GraphText) + 1;
+
+    /** One arena per field so a scan only touches the bytes of the field it searches */
+    FFieldArena Arenas[NumFields];
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Data structure representing the aggregate counts of one folder, including all subfolders
+ */
+struct BLUEPRINTANALYZER_API FBlueprintFolderInfo
+{
+    /** Folder name, e.g. Characters */
+    FString Name;
+
+    /** Package path of the folder, e.g. /Game/Characters */
+    FString Path;
+
+    /** Number of blueprints in the folder and all subfolders */
+    int32 BlueprintCount = 0;
+
+    /** Number of those blueprints whose graphs have been summarized */
+    int32 BlueprintsWithGraphData = 0;
+
+    /** Total graph node count of the summarized blueprints */
+    int64 NodeCount = 0;
+};
+
+/**
+ * Data structure representing the contents of one folder
+ */
+struct BLUEPRINTANALYZER_API FBlueprintFolderListing
+{
+    /** The folder itself */
+    FBlueprintFolderInfo Folder;
+
+    /** Immediate subfolders containing at least one blueprint, sorted by name */
+    TArray<FBlueprintFolderInfo> Subfolders;
+
+    /** Ids of the blueprints directly in the folder (catalog entry ids), sorted */
+    TArray<int32> EntryIds;
+};
+
+/**
+ * Folder tree over the package paths of all catalog entries.
+ * Each folder keeps recursive blueprint and node counts that are adjusted along the
+ * folder's ancestor chain whenever an entry is added or removed, so listing a folder
+ * only reads that folder and its immediate children.
+ */
+class BLUEPRINTANALYZER_API FBlueprintPathTree
+{
+public:
+    /**
+     * Add an entry to the tree
+     * @param EntryId Id of the entry (catalog entry id)
+     * @param PackagePath Folder of the entry, e.g. /Game/Characters/Enemies
+     * @param NodeCount Graph node count of the entry
+     * @param bHasGraphData Whether NodeCount comes from summarized graphs
+     */
+    void AddEntry(int32 EntryId, const FString& PackagePath, int32 NodeCount, bool bHasGraphData);
+
+    /**
+     * Remove an entry with the same values it was added with
+     * @param EntryId Id of the entry (catalog entry id)
+     * @param PackagePath Folder of the entry
+     * @param NodeCount Graph node count the entry was added with
+     * @param bHasGraphData Whether the entry was added with graph data
+     */
+    void RemoveEntry(int32 EntryId, const FString& PackagePath, int32 NodeCount, bool bHasGraphData);
+
+    /**
+     * List a folder
+     * @param PackagePath Folder to list, e.g. /Game/Characters; empty or / lists the mount points
+     * @param OutListing Counts, subfolders and direct blueprints of the folder
+     * @return False if no blueprint lives in or below the folder
+     */
+    bool GetListing(const FString& PackagePath, FBlueprintFolderListing& OutListing) const;
+
+    /**
+     * Remove all folders
+     */
+    void Reset();
+
+    /**
+     * Get the folder part of a blueprint object path
+     * @param ObjectPath Object path such as /Game/Characters/BP_Hero.BP_Hero
+     * @return Package path such as /Game/Characters
+     */
+    static FString GetPackagePath(const FString& ObjectPath);
+
+private:
+    /**
+     * Data structure representing one folder
+     */
+    struct FFolder
+    {
+        FString Name;
+        FString Path;
+        int32 Parent = INDEX_NONE;
+        TMap<FString, int32> Children;
+        TArray<int32> EntryIds;
+        int32 BlueprintCount = 0;
+        int32 BlueprintsWithGraphData = 0;
+        int64 NodeCount = 0;
+    };
+
+    /**
+     * Find the folder for a package path, optionally creating it and its ancestors
+     * @return Index of the folder, or INDEX_NONE if it doesn't exist and bCreate is false
+     */
+    int32 FindFolder(const FString& PackagePath, bool bCreate);
+
+    /** Const lookup of the folder for a package path */
+    int32 FindFolder(const FString& PackagePath) const;
+
+    /** Copy a folder's counts into a folder info */
+    static void MakeInfo(const FFolder& Folder, FBlueprintFolderInfo& OutInfo);
+
+    /** Folders, the root (above the mount points) is index 0 */
+    TArray<FFolder> Folders;
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+struct FBlueprintCatalogEntry;
+
+/**
+ * Enum defining the node types of a compound blueprint query
+ */
+enum class EBlueprintQueryOp : uint8
+{
+    /** All children must match */
+    And = 0,
+
+    /** Any child must match */
+    Or = 1,
+
+    /** The single child must not match */
+    Not = 2,
+
+    /** A field predicate such as name:Player */
+    Predicate = 3
+};
+
+/**
+ * Enum defining the fields a query predicate can test
+ */
+enum class EBlueprintQueryField : uint8
+{
+    /** Blueprint asset name (asset registry) */
+    Name = 0,
+
+    /** Blueprint object path (asset registry) */
+    Path = 1,
+
+    /** Parent class name (asset registry) */
+    ParentClass = 2,
+
+    /** Asset registry tag, as tag:Key or tag:Key=Value */
+    Tag = 3,
+
+    /** Function name (needs the blueprint loaded once) */
+    Function = 4,
+
+    /** Variable name (needs the blueprint loaded once) */
+    Variable = 5
+};
+
+/**
+ * Data structure representing one node of a parsed query, annotated with its plan
+ */
+struct BLUEPRINTANALYZER_API FBlueprintQueryNode
+{
+    /** Node type */
+    EBlueprintQueryOp Op = EBlueprintQueryOp::Predicate;
+
+    /** Field tested by a predicate */
+    EBlueprintQueryField Field = EBlueprintQueryField::Name;
+
+    /** Substring a predicate looks for (tag value for tag predicates) */
+    FString Value;
+
+    /** Tag name for tag predicates */
+    FString TagKey;
+
+    /** Children of And/Or/Not nodes, in execution order once planned */
+    TArray<TSharedPtr<FBlueprintQueryNode>> Children;
+
+    /** Estimated number of matching blueprints (set by Plan) */
+    int32 EstimatedRows = 0;
+
+    /** Estimated cost of evaluating this node against every blueprint (set by Plan) */
+    double EstimatedCost = 0.0;
+
+    /** Whether evaluating this node needs function/variable data (set by Plan) */
+    bool bNeedsMemberData = false;
+};
+
+/**
+ * Parser, planner and executor for compound blueprint queries such as
+ *   parentClass:Character AND (function:Damage OR variable:Health) AND NOT path:/Game/Test
+ * Adjacent predicates without an operator are combined with AND.
+ * Values containing spaces or parentheses can be quoted: function:"Take Damage".
+ */
+class BLUEPRINTANALYZER_API FBlueprintQuery
+{
+public:
+    /**
+     * Parse a query expression
+     * @param Expression The query text
+     * @param OutError Description of the syntax error if parsing fails
+     * @return Root node of the query, or nullptr on error
+     */
+    static TSharedPtr<FBlueprintQueryNode> Parse(const FString& Expression, FString& OutError);
+
+    /**
+     * Estimate rows and cost for every node and reorder And children so cheap,
+     * selective predicates run first and member predicates only see survivors
+     * @param Root Root node of the query
+     */
+    static void Plan(const TSharedPtr<FBlueprintQueryNode>& Root);
+
+    /**
+     * Run a planned query against the catalog
+     * @param Root Root node of the planned query
+     * @param OutEntryIds Sorted catalog entry ids of the matching blueprints
+     */
+    static void Execute(const TSharedPtr<FBlueprintQueryNode>& Root, TArray<int32>& OutEntryIds);
+
+    /**
+     * Describe a planned query for explain output
+     * @param Root Root node of the planned query
+     * @return JSON object describing the plan tree with estimates
+     */
+    static TSharedPtr<FJsonObject> Explain(const TSharedPtr<FBlueprintQueryNode>& Root);
+
+private:
+    /**
+     * Evaluate a node against a sorted candidate set
+     * @param Node Node to evaluate
+     * @param Candidates Sorted entry ids that are still possible matches
+     * @param OutEntryIds Sorted entry ids of candidates matching the node
+     */
+    static void Evaluate(const FBlueprintQueryNode& Node, const TArray<int32>& Candidates, TArray<int32>& OutEntryIds);
+
+    /**
+     * Evaluate a predicate against a sorted candidate set
+     * @param Node Predicate node
+     * @param Candidates Sorted entry ids that are still possible matches
+     * @param OutEntryIds Sorted entry ids of candidates matching the predicate
+     */
+    static void EvaluatePredicate(const FBlueprintQueryNode& Node, const TArray<int32>& Candidates, TArray<int32>& OutEntryIds);
+
+    /**
+     * Check a single entry against a predicate
+     * @param Node Predicate node
+     * @param Entry Catalog entry to test
+     * @return True if the entry matches
+     */
+    static bool PredicateMatches(const FBlueprintQueryNode& Node, const FBlueprintCatalogEntry& Entry);
+
+    /**
+     * Estimate rows and cost for a node and its children
+     * @param Node Node to plan
+     * @param TotalRows Number of blueprints in the catalog
+     * @param UnloadedFraction Fraction of blueprints without member data
+     */
+    static void PlanNode(FBlueprintQueryNode& Node, int32 TotalRows, double UnloadedFraction);
+};
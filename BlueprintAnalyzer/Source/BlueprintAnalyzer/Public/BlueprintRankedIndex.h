@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Enum defining the text fields that contribute to ranked search, in decreasing weight
+ */
+enum class EBlueprintRankedField : uint8
+{
+    /** Blueprint asset name */
+    Name = 0,
+
+    /** Function and variable identifiers */
+    Member = 1,
+
+    /** Blueprint description and node comments */
+    Text = 2
+};
+
+/**
+ * Data structure representing one ranked search hit
+ */
+struct BLUEPRINTANALYZER_API FBlueprintRankedHit
+{
+    /** Id of the matching document (catalog entry id) */
+    int32 DocumentId = INDEX_NONE;
+
+    /** BM25 score, higher is better */
+    float Score = 0.0f;
+};
+
+/**
+ * Inverted index that ranks documents with BM25 and tolerates typos.
+ * Text is split into lower-case tokens on camelCase, digit and underscore boundaries,
+ * so "BP_PlayerCharacter" and "player character" share tokens. Query tokens are matched
+ * against the sorted term dictionary with a Levenshtein automaton, so misspelled
+ * queries still find the closest terms.
+ */
+class BLUEPRINTANALYZER_API FBlueprintRankedIndex
+{
+public:
+    /**
+     * Add the texts of one field of a document to the index
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Field Field the texts belong to, which decides their weight
+     * @param Texts All texts of this field for the document
+     */
+    void AddDocument(int32 DocumentId, EBlueprintRankedField Field, TConstArrayView<FString> Texts);
+
+    /**
+     * Remove a document and all of its fields from the index
+     * @param DocumentId Id of the document (catalog entry id)
+     */
+    void RemoveDocument(int32 DocumentId);
+
+    /**
+     * Find the best matching documents for a free-text query
+     * @param Query Free-text query, tokenized like the indexed text
+     * @param MaxResults Maximum number of hits to return
+     * @param OutHits Hits sorted by descending score
+     * @param OutTotalMatches Optional number of documents matching at least one query token
+     */
+    void Search(const FString& Query, int32 MaxResults, TArray<FBlueprintRankedHit>& OutHits, int32* OutTotalMatches = nullptr) const;
+
+    /**
+     * Remove all documents from the index
+     */
+    void Reset();
+
+    /**
+     * Split text into lower-case tokens on non-alphanumeric, camelCase and digit boundaries
+     * @param Text Text to tokenize
+     * @param OutTokens Array receiving the tokens
+     */
+    static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+
+private:
+    /**
+     * Data structure representing one document in a posting list
+     */
+    struct FPosting
+    {
+        /** Id of the document */
+        int32 DocumentId;
+
+        /** Field-weighted term frequency */
+        float TermFrequency;
+    };
+
+    /**
+     * Data structure representing the indexed state of a document
+     */
+    struct FDocumentInfo
+    {
+        /** Distinct terms of the document, needed to remove it again */
+        TArray<FString> Terms;
+
+        /** Field-weighted document length */
+        float Length = 0.0f;
+    };
+
+    /**
+     * Find all dictionary terms within the allowed edit distance of a query token
+     * @param Token Lower-case query token
+     * @param MaxEdits Maximum Levenshtein distance
+     * @param OutMatches Matching terms with their edit distance
+     */
+    void FindTerms(const FString& Token, int32 MaxEdits, TArray<TPair<const FString*, int32>>& OutMatches) const;
+
+    /**
+     * Rebuild the sorted term dictionary if terms were added or removed since the last search
+     */
+    void EnsureSortedTerms() const;
+
+    /** Posting lists keyed by term */
+    TMap<FString, TArray<FPosting>> Postings;
+
+    /** Indexed documents keyed by document id */
+    TMap<int32, FDocumentInfo> Documents;
+
+    /** Sum of all document lengths, for the average length */
+    float TotalLength = 0.0f;
+
+    /** Terms in lexical order so the automaton can share work between common prefixes */
+    mutable TArray<FString> SortedTerms;
+
+    /** Whether SortedTerms needs rebuilding */
+    mutable bool bSortedTermsDirty = false;
+};
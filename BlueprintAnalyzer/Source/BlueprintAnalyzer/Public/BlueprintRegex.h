@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+
+class FRegexPattern;
+
+/**
+ * Data structure representing the literals a regular expression needs in every match:
+ * each inner array is a set of alternatives of which at least one must occur, and every
+ * inner array must be satisfied. "^BP_(Enemy|Boss)_.*" needs { "BP_" } and { "Enemy", "Boss" }.
+ */
+struct BLUEPRINTANALYZER_API FBlueprintRegexLiterals
+{
+    /** Conjunction of disjunctions of literal substrings */
+    TArray<TArray<FString>> Required;
+};
+
+/**
+ * Compiled-pattern cache and prefilter analysis for regex searches.
+ * Patterns are compiled once and kept in a bounded LRU keyed by the pattern text. The literal
+ * analysis is deliberately conservative: anything it does not understand simply contributes no
+ * literal, so the prefilter can only ever widen the candidate set, never lose a match.
+ */
+class BLUEPRINTANALYZER_API FBlueprintRegex
+{
+public:
+    /** Maximum number of compiled patterns kept */
+    static constexpr int32 MaxCachedPatterns = 64;
+
+    /**
+     * Get the compiled, case-insensitive form of a pattern, compiling it on first use
+     * @param Pattern Regular expression text
+     * @return The compiled pattern
+     */
+    static TSharedRef<const FRegexPattern> FindOrCompile(const FString& Pattern);
+
+    /**
+     * Check the structure of a pattern and collect the literals every match has to contain
+     * @param Pattern Regular expression text
+     * @param OutLiterals Required literals; empty if the pattern gives nothing to prefilter on
+     * @param OutError Description of the problem if the pattern is malformed
+     * @return False if brackets or parentheses are unbalanced or the pattern ends in a lone backslash
+     */
+    static bool ExtractLiterals(const FString& Pattern, FBlueprintRegexLiterals& OutLiterals, FString& OutError);
+
+    /**
+     * Drop all compiled patterns
+     */
+    static void Reset();
+
+private:
+    /** Compiled patterns keyed by pattern text */
+    static TLruCache<FString, TSharedPtr<const FRegexPattern>> PatternCache;
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Enum defining the content encodings responses can be compressed with
+ */
+enum class EBlueprintContentEncoding : uint8
+{
+    /** Sent as is */
+    Identity = 0,
+
+    /** gzip, RFC 1952 */
+    Gzip = 1,
+
+    /** HTTP "deflate", which is the zlib format of RFC 1950 */
+    Deflate = 2
+};
+
+/**
+ * Data structure representing the counters of response compression
+ */
+struct BLUEPRINTANALYZER_API FBlueprintCompressionStats
+{
+    /** Responses sent */
+    int64 Responses = 0;
+
+    /** Responses sent compressed */
+    int64 CompressedResponses = 0;
+
+    /** Body bytes before compression, all responses */
+    int64 RawBytes = 0;
+
+    /** Body bytes actually sent, all responses */
+    int64 SentBytes = 0;
+
+    /** Body bytes before compression, compressed responses only */
+    int64 CompressedRawBytes = 0;
+
+    /** Body bytes after compression, compressed responses only */
+    int64 CompressedBytes = 0;
+
+    /** Time spent compressing on worker threads */
+    double CompressSeconds = 0.0;
+};
+
+/**
+ * Content encoding of HTTP responses with the engine's zlib backend.
+ * Graph responses are megabytes of repetitive text and shrink by an order of magnitude; small responses
+ * are not worth the latency and are sent as is. Counters may be updated from any thread.
+ */
+class BLUEPRINTANALYZER_API FBlueprintResponseCompression
+{
+public:
+    /** Bodies smaller than this are never compressed */
+    static constexpr int32 MinCompressBytes = 8 * 1024;
+
+    /**
+     * Pick the content encoding from an Accept-Encoding header
+     * The supported coding with the highest quality wins, gzip on ties; identity when nothing matches.
+     * zstd and br are not offered: the engine has no HTTP-compatible backend for them.
+     * @param AcceptEncoding Value of the Accept-Encoding header, may be empty
+     * @return The negotiated encoding
+     */
+    static EBlueprintContentEncoding NegotiateEncoding(FStringView AcceptEncoding);
+
+    /**
+     * Get the Content-Encoding token of an encoding
+     * @param Encoding Encoding to name
+     * @return e.g. "gzip"
+     */
+    static const TCHAR* GetEncodingName(EBlueprintContentEncoding Encoding);
+
+    /**
+     * Whether a body is large enough to compress
+     * @param BodySize Size of the body in bytes
+     * @return True if compressing is worth it
+     */
+    static bool ShouldCompress(int32 BodySize);
+
+    /**
+     * Compress a body in place; safe on any thread
+     * @param InOutBody Body to compress, left unchanged when compression fails or doesn't make it smaller
+     * @param Encoding Gzip or Deflate
+     * @return True if the body was replaced with its compressed form
+     */
+    static bool Compress(TArray<uint8>& InOutBody, EBlueprintContentEncoding Encoding);
+
+    /**
+     * Count a sent response
+     * @param RawBytes Body size before compression
+     * @param SentBytes Body size sent
+     * @param bCompressed Whether the body was compressed
+     * @param CompressSeconds Time spent compressing
+     */
+    static void RecordResponse(int64 RawBytes, int64 SentBytes, bool bCompressed, double CompressSeconds);
+
+    /**
+     * Get the compression counters
+     * @return Current counters
+     */
+    static FBlueprintCompressionStats GetStats();
+
+    /**
+     * Reset the counters
+     */
+    static void Reset();
+
+private:
+    /** Guards Stats, which worker threads update */
+    static FCriticalSection StatsLock;
+
+    /** Counters */
+    static FBlueprintCompressionStats Stats;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+
+/**
+ * Data structure representing the counters of the result cache
+ */
+struct BLUEPRINTANALYZER_API FBlueprintResultCacheStats
+{
+    /** Lookups answered from the cache */
+    int64 Hits = 0;
+
+    /** Lookups that had to run the search */
+    int64 Misses = 0;
+
+    /** Times the whole cache was dropped because the catalog changed */
+    int64 Invalidations = 0;
+
+    /** Responses currently cached */
+    int32 NumEntries = 0;
+
+    /** Maximum number of cached responses */
+    int32 Capacity = 0;
+
+    /** Catalog generation the cached responses belong to */
+    uint64 Generation = 0;
+};
+
+/**
+ * Cache of encoded search responses keyed by route and normalized query parameters.
+ * Responses are kept as the UTF-8 JSON bytes that were sent, so a hit is answered without
+ * re-serializing or transcoding.
+ * Every response belongs to the catalog generation it was computed in; the first lookup or
+ * insert after the generation moves on drops the whole cache, so any asset addition, change,
+ * rename, save or removal invalidates results without per-entry bookkeeping. Member data
+ * extracted lazily during a search doesn't move the generation.
+ * Unsaved edits don't move it either, so a response is neither cached nor served while any
+ * blueprint it was built from has a dirty package.
+ */
+class BLUEPRINTANALYZER_API FBlueprintResultCache
+{
+public:
+    /** Maximum number of cached responses */
+    static constexpr int32 MaxEntries = 256;
+
+    /** Responses larger than this (in bytes) are not cached */
+    static constexpr int32 MaxResponseLength = 1024 * 1024;
+
+    /**
+     * Build the cache key for a request
+     * Parameters are sorted, values trimmed and parameters equal to their default dropped, so
+     * "?type=name&query=Enemy" and "?query=Enemy " share one entry.
+     * @param Route Route of the request, e.g. /blueprints/search
+     * @param QueryParams Query parameters of the request
+     * @param Defaults Default values of the route's optional parameters
+     * @return The normalized key
+     */
+    static FString MakeKey(const FString& Route, const TMap<FString, FString>& QueryParams, const TMap<FString, FString>& Defaults);
+
+    /**
+     * Look up a cached response
+     * A response whose source blueprints have been edited since without saving counts as a miss.
+     * @param Key Key from MakeKey
+     * @return The cached response body, or null on a miss
+     */
+    static TSharedPtr<const TArray<uint8>> Find(const FString& Key);
+
+    /**
+     * Cache a response for the current catalog generation
+     * @param Key Key from MakeKey
+     * @param Response Encoded response body, copied only if it is small enough to be cached
+     * @param SourcePaths Object paths of the blueprints in the response; nothing is cached if any has unsaved edits
+     */
+    static void Add(const FString& Key, const TArray<uint8>& Response, const TArray<FString>& SourcePaths);
+
+    /**
+     * Get the hit, miss and invalidation counters
+     * @return Current counters
+     */
+    static FBlueprintResultCacheStats GetStats();
+
+    /**
+     * Drop all cached responses and reset the counters
+     */
+    static void Reset();
+
+private:
+    /**
+     * Drop the cached responses if the catalog has changed since they were computed
+     */
+    static void SyncGeneration();
+
+    /** A cached response and the blueprints it was built from */
+    struct FCachedResponse
+    {
+        TSharedPtr<const TArray<uint8>> Bytes;
+        TArray<FString> SourcePaths;
+    };
+
+    /**
+     * Check whether any of the blueprints has unsaved edits
+     * @param SourcePaths Object paths of the blueprints
+     * @return True if any package is dirty
+     */
+    static bool HasUnsavedChanges(const TArray<FString>& SourcePaths);
+
+    /** Cached responses keyed by normalized request */
+    static TLruCache<FString, FCachedResponse> Responses;
+
+    /** Catalog generation of the cached responses */
+    static uint64 Generation;
+
+    /** Counters */
+    static int64 Hits;
+    static int64 Misses;
+    static int64 Invalidations;
+};
@@ -2,6 +2,45 @@
 
 #include "CoreMinimal.h"
 #include "BlueprintData.h"
+#include "BlueprintQuery.h"
+#include "BlueprintTrigramIndex.h"
+#include "BlueprintSignatureIndex.h"
+#include "BlueprintGraphPattern.h"
+#include "BlueprintRegex.h"
+#include "BlueprintLeaderboard.h"
+
+struct FBlueprintCatalogEntry;
+struct FBlueprintGraphRef;
+
+/**
+ * Paging options for a blueprint search
+ */
+struct BLUEPRINTANALYZER_API FBlueprintSearchOptions
+{
+	/** Number of matches to skip */
+	int32 Offset = 0;
+
+	/** Maximum number of matches to return, 0 for all */
+	int32 Limit = 0;
+
+	/** Whether TotalCount must be exact; if false, searches that have to load blueprints stop once the page is filled and estimate the rest */
+	bool bExactCount = true;
+};
+
+/**
+ * Data structure representing one page of search results
+ */
+struct BLUEPRINTANALYZER_API FBlueprintSearchResult
+{
+	/** The requested page of matching blueprints */
+	TArray<FBlueprintData> Blueprints;
+
+	/** Total number of matches across all pages */
+	int32 TotalCount = 0;
+
+	/** Whether TotalCount is exact or extrapolated from the blueprints scanned */
+	bool bTotalCountExact = true;
+};
 
 /**
  * A class that handles searching for blueprints with various criteria
@@ -13,41 +52,189 @@ public:
 	 * Search blueprints by name
 	 * @param NameQuery The name or partial name to search for
 	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
-	 * @return Array of matching blueprint data
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
 	 */
-	static TArray<FBlueprintData> SearchByName(const FString& NameQuery, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic);
+	static FBlueprintSearchResult SearchByName(const FString& NameQuery, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
 	   
 	/**
 	 * Search blueprints by parent class
 	 * @param ParentClassName The parent class name to search for
 	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
-	 * @return Array of matching blueprint data
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
 	 */
-	static TArray<FBlueprintData> SearchByParentClass(const FString& ParentClassName, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic);
+	static FBlueprintSearchResult SearchByParentClass(const FString& ParentClassName, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
 	   
 	/**
 	 * Search blueprints by function signature
 	 * @param FunctionName The function name to search for
 	 * @param ParamTypes Optional array of parameter types to match
 	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
-	 * @return Array of matching blueprint data
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
 	 */
-	static TArray<FBlueprintData> SearchByFunction(const FString& FunctionName, const TArray<FString>& ParamTypes = TArray<FString>(), EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic);
+	static FBlueprintSearchResult SearchByFunction(const FString& FunctionName, const TArray<FString>& ParamTypes = TArray<FString>(), EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
 	   
+	/**
+	 * Search blueprints for functions with a given signature
+	 * @param Query Parameter and return types (full pin types, any order) and optional pure/event flags
+	 * @param DetailLevel Level of detail to extract (at least Medium, since matches are functions)
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of blueprints, with the names of the matching functions in Metadata["MatchedFunctions"]
+	 */
+	static FBlueprintSearchResult SearchBySignature(const FBlueprintSignatureQuery& Query, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
+
 	/**
 	 * Search blueprints by variable
 	 * @param VariableName The variable name to search for
 	 * @param VariableType Optional variable type to match
 	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
-	 * @return Array of matching blueprint data
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
 	 */
-	static TArray<FBlueprintData> SearchByVariable(const FString& VariableName, const FString& VariableType = FString(), EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic);
+	static FBlueprintSearchResult SearchByVariable(const FString& VariableName, const FString& VariableType = FString(), EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
 	   
 	/**
 	 * Search blueprints using custom parameters
 	 * @param SearchParams Map of search parameters and their values
 	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
-	 * @return Array of matching blueprint data
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
+	 */
+	static FBlueprintSearchResult SearchWithParameters(const TMap<FString, FString>& SearchParams, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
+
+	/**
+	 * Search blueprints with a compound query
+	 * @param Query Parsed and planned query (see FBlueprintQuery)
+	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
+	 */
+	static FBlueprintSearchResult SearchByQuery(const TSharedPtr<FBlueprintQueryNode>& Query, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
+
+	/**
+	 * Search blueprints by relevance to a free-text query, tolerating typos
+	 * Ranks names, descriptions, function and variable identifiers and node comments with BM25.
+	 * @param Query Free-text query such as "PlayerCharcter health"
+	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
+	 * @param Options Paging options; only the top Offset + Limit hits are ranked (Offset + DefaultRankedResults if no limit).
+	 *                bExactCount is ignored: ranked totals are always exact, as every match is scored
+	 * @return The requested page, best match first, with the score in Metadata["Score"], and the exact total count
+	 */
+	static FBlueprintSearchResult SearchRanked(const FString& Query, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
+
+	/**
+	 * Search blueprints with a regular expression over one field (case-insensitive)
+	 * Candidates come from the literals the pattern requires, so only those are run through the regex.
+	 * @param Field Field to match (name, path, parent class, function or variable names)
+	 * @param Pattern Regular expression such as ^BP_(Enemy|Boss)_.*
+	 * @param Literals Literals required by the pattern, from FBlueprintRegex::ExtractLiterals
+	 * @param DetailLevel Level of detail to extract (Basic, Medium, Full)
+	 * @param Options Paging options; only the requested page is hydrated
+	 * @return The requested page of matching blueprint data and the total count
+	 */
+	static FBlueprintSearchResult SearchByRegex(EBlueprintSearchField Field, const FString& Pattern, const FBlueprintRegexLiterals& Literals, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic, const FBlueprintSearchOptions& Options = FBlueprintSearchOptions());
+
+	/** Number of hits ranked past the offset when no limit is given */
+	static constexpr int32 DefaultRankedResults = 50;
+
+	/**
+	 * Search node titles, node comments, comment boxes and pin default values across all graphs
+	 * @param Query The text or partial text to search for
+	 * @return Array of matches, grouped by blueprint
+	 */
+	static TArray<FBlueprintGraphTextMatch> SearchGraphText(const FString& Query);
+
+	/**
+	 * Find occurrences of a structural pattern (node classes/titles joined by exec and data edges) across all graphs
+	 * Only blueprints containing every node class of the pattern are searched.
+	 * @param Pattern Parsed pattern
+	 * @param MaxMatches Stop after this many matches (0 for no limit)
+	 * @return Array of matches, grouped by blueprint
+	 */
+	static TArray<FBlueprintPatternMatch> SearchGraphPattern(const FBlueprintGraphPattern& Pattern, int32 MaxMatches = 0);
+
+	/**
+	 * Find every blueprint graph containing a node of the given class, from the project-wide node class postings
+	 * @param NodeClass Node class, with or without the K2Node_ prefix (e.g. K2Node_SpawnActorFromClass or SpawnActorFromClass)
+	 * @return Array of usages, one per blueprint
+	 */
+	static TArray<FBlueprintGraphUsage> FindNodeClassUsages(const FString& NodeClass);
+
+	/**
+	 * Find every blueprint graph implementing the given event, from the project-wide event postings
+	 * @param EventName Event name (e.g. ReceiveTick, Tick, BeginPlay or a custom event name)
+	 * @return Array of usages, one per blueprint
+	 */
+	static TArray<FBlueprintGraphUsage> FindEventImplementations(const FString& EventName);
+
+	/**
+	 * Get the blueprints ranked highest by a metric, from the catalog's ordered indexes
+	 * @param Metric Metric to rank by
+	 * @param MaxResults Number of blueprints to return
+	 * @return Blueprints by descending metric value
+	 */
+	static TArray<FBlueprintTopEntry> GetTopBlueprints(EBlueprintLeaderboardMetric Metric, int32 MaxResults);
+
+private:
+	/**
+	 * Collect the entries that contain the literals a regex requires
+	 * Literals long enough for the trigram index are preferred; shorter ones are only scanned for if there is nothing else.
+	 * @param Field Field to search
+	 * @param Literals Literals required by the pattern
+	 * @param OutEntryIds Sorted ids of the candidate entries
+	 */
+	static void GetRegexCandidates(EBlueprintSearchField Field, const FBlueprintRegexLiterals& Literals, TArray<int32>& OutEntryIds);
+
+	/**
+	 * Group catalog graph references by blueprint
+	 * @param Graphs Graph references sorted by entry id
+	 * @return Array of usages, one per blueprint
+	 */
+	static TArray<FBlueprintGraphUsage> MakeGraphUsages(const TArray<FBlueprintGraphRef>& Graphs);
+
+	/**
+	 * Find blueprints whose function or variable data matches a predicate
+	 * With an exact count every blueprint's member data is used; otherwise blueprints are
+	 * loaded in chunks and the scan stops as soon as the requested page is filled.
+	 * @param Field Indexed member field to narrow candidates with when scanning everything
+	 * @param Needle Substring the field has to contain
+	 * @param Predicate Full match test for one catalog entry
+	 * @param Options Paging options
+	 * @param OutEntryIds Ids of the matching entries found
+	 * @param OutTotalCount Total number of matches, exact or extrapolated
+	 * @param bOutExact Whether OutTotalCount is exact
+	 */
+	static void MatchMembers(EBlueprintSearchField Field, const FString& Needle, TFunctionRef<bool(const FBlueprintCatalogEntry&)> Predicate,
+	                         const FBlueprintSearchOptions& Options, TArray<int32>& OutEntryIds, int32& OutTotalCount, bool& bOutExact);
+
+	/**
+	 * Cut the requested page out of the matches and hydrate only that page
+	 * @param EntryIds Ids of all matching entries found, in result order
+	 * @param TotalCount Total number of matches
+	 * @param bTotalCountExact Whether TotalCount is exact
+	 * @param DetailLevel Level of detail to extract
+	 * @param Options Paging options
+	 * @return The hydrated page
+	 */
+	static FBlueprintSearchResult MakePage(const TArray<int32>& EntryIds, int32 TotalCount, bool bTotalCountExact,
+	                                       EBlueprintDetailLevel DetailLevel, const FBlueprintSearchOptions& Options);
+
+	/**
+	 * Turn catalog entries into search results at the requested detail level in one batch
+	 * Reuses the catalog's basic and medium data and batch loads blueprints for higher levels.
+	 * @param EntryIds Ids of the catalog entries to hydrate
+	 * @param DetailLevel Level of detail to extract
+	 * @return Array of blueprint data in the same order as EntryIds
+	 */
+	static TArray<FBlueprintData> HydrateResults(const TArray<int32>& EntryIds, EBlueprintDetailLevel DetailLevel);
+
+	/**
+	 * Copy catalog entries into search results
+	 * @param EntryIds Ids of the catalog entries to copy
+	 * @param bIncludeMembers Whether to keep function and variable data (Medium) or strip it (Basic)
+	 * @return Array of blueprint data in catalog order
 	 */
-	static TArray<FBlueprintData> SearchWithParameters(const TMap<FString, FString>& SearchParams, EBlueprintDetailLevel DetailLevel = EBlueprintDetailLevel::Basic);
+	static TArray<FBlueprintData> CollectResults(const TArray<int32>& EntryIds, bool bIncludeMembers);
 };
\ No newline at end of file
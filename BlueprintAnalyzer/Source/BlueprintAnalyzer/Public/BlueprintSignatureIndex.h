@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BlueprintData.h"
+
+/**
+ * Data structure describing a function signature to look up
+ * Parameter and return types are full pin types ("Actor", "float", "Array<Vector>") and are
+ * compared case-insensitively and regardless of order.
+ */
+struct BLUEPRINTANALYZER_API FBlueprintSignatureQuery
+{
+    /** Types of the input parameters */
+    TArray<FString> ParamTypes;
+
+    /** Types of the outputs */
+    TArray<FString> ReturnTypes;
+
+    /** Whether ParamTypes has to match (an empty list then means no inputs) */
+    bool bMatchParams = false;
+
+    /** Whether ReturnTypes has to match (an empty list then means no outputs) */
+    bool bMatchReturns = false;
+
+    /** Required pure flag, if any */
+    TOptional<bool> bPure;
+
+    /** Required event flag, if any */
+    TOptional<bool> bEvent;
+};
+
+/**
+ * Data structure representing one function whose signature matched
+ */
+struct BLUEPRINTANALYZER_API FBlueprintSignatureMatch
+{
+    /** Id of the document (catalog entry id) the function belongs to */
+    int32 DocumentId = INDEX_NONE;
+
+    /** Index of the function in the document's function list */
+    int32 FunctionIndex = INDEX_NONE;
+};
+
+/**
+ * Hash index from normalized function signatures to the functions that have them.
+ * Every function is filed under its input signature, its output signature and the
+ * combination of both, so a lookup by parameters, by return types or by both is a
+ * single hash lookup. Pure and event flags are checked on the few functions found.
+ */
+class BLUEPRINTANALYZER_API FBlueprintSignatureIndex
+{
+public:
+    /**
+     * Add the functions of a document to the index
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Functions All functions and events of the document
+     */
+    void AddDocument(int32 DocumentId, TConstArrayView<FBlueprintFunctionData> Functions);
+
+    /**
+     * Remove a document and all of its functions from the index
+     * @param DocumentId Id of the document (catalog entry id)
+     */
+    void RemoveDocument(int32 DocumentId);
+
+    /**
+     * Find all functions with a matching signature
+     * @param Query Signature to look up; at least one of bMatchParams and bMatchReturns must be set
+     * @param OutMatches Matching functions, sorted by document id and function index
+     */
+    void Find(const FBlueprintSignatureQuery& Query, TArray<FBlueprintSignatureMatch>& OutMatches) const;
+
+    /**
+     * Remove all documents from the index
+     */
+    void Reset();
+
+    /**
+     * Bring a type name to the form used in signature keys
+     * Lower-cases it, drops whitespace and maps common aliases ("boolean", "integer", "double") to pin type names.
+     * @param Type Full pin type or user-supplied type name
+     * @return Normalized type name
+     */
+    static FString NormalizeType(const FString& Type);
+
+    /**
+     * Split a comma-separated type list, keeping commas inside container types such as Map<Name,int>
+     * @param TypeList Text such as "Actor, float"
+     * @param OutTypes Array receiving the trimmed, non-empty types
+     */
+    static void ParseTypeList(const FString& TypeList, TArray<FString>& OutTypes);
+
+private:
+    /**
+     * Data structure representing one indexed function
+     */
+    struct FFunctionInfo
+    {
+        /** Index of the function in the document's function list */
+        int32 FunctionIndex;
+
+        /** Whether the function is pure */
+        bool bPure;
+
+        /** Whether the function is an event */
+        bool bEvent;
+    };
+
+    /**
+     * Build the key for a list of types, independent of their order
+     * @param Prefix Distinguishes input, output and combined keys
+     * @param Types Types to combine
+     * @return Signature key
+     */
+    static FString MakeKey(const TCHAR* Prefix, TConstArrayView<FString> Types);
+
+    /** Documents and function indices keyed by signature */
+    TMap<FString, TArray<TPair<int32, FFunctionInfo>>> Signatures;
+
+    /** Signature keys of every document, needed to remove it again */
+    TMap<int32, TArray<FString>> DocumentKeys;
+};
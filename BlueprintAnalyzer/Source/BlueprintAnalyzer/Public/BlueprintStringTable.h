@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Table of distinct strings, numbered in first-use order.
+ * Compact graph responses refer to node types, pin names, data types and property keys by their index
+ * here, so each distinct string is sent once per response no matter how many pins repeat it.
+ * Strings are compared case-sensitively and held as views: the text must outlive the table.
+ */
+class BLUEPRINTANALYZER_API FBlueprintStringTable
+{
+public:
+    /**
+     * Get the index of a string, adding it if it is new
+     * @param Text String to look up
+     * @return Index of the string in the table
+     */
+    int32 Add(FStringView Text);
+
+    /**
+     * Get the strings in index order
+     * @return All strings added so far
+     */
+    TConstArrayView<FStringView> GetStrings() const;
+
+    /**
+     * Get the number of distinct strings
+     * @return Number of strings in the table
+     */
+    int32 Num() const;
+
+private:
+    /** Case-sensitive hashing of string views */
+    struct FKeyFuncs : BaseKeyFuncs<TPair<FStringView, int32>, FStringView, false>
+    {
+        static FStringView GetSetKey(const TPair<FStringView, int32>& Element)
+        {
+            return Element.Key;
+        }
+
+        static bool Matches(FStringView A, FStringView B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(FStringView Key);
+    };
+
+    /** Index of each string */
+    TMap<FStringView, int32, FDefaultSetAllocator, FKeyFuncs> Indices;
+
+    /** Strings in index order */
+    TArray<FStringView> Strings;
+};
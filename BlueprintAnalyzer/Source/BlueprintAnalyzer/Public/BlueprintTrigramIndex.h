@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Enum defining the catalog fields that are covered by the trigram index
+ */
+enum class EBlueprintSearchField : uint8
+{
+    /** Blueprint asset name */
+    Name = 0,
+
+    /** Blueprint object path */
+    Path = 1,
+
+    /** Parent class name */
+    ParentClass = 2,
+
+    /** Function and event names */
+    Function = 3,
+
+    /** Variable names */
+    Variable = 4,
+
+    /** Variable types */
+    VariableType = 5,
+
+    /** Node titles, node comments, comment boxes and pin default values */
+    GraphText = 6
+};
+
+/**
+ * Inverted index from case-folded character trigrams to sorted posting lists of document ids.
+ * Used to answer case-insensitive substring queries without scanning every document:
+ * a string containing the needle must contain every trigram of the needle, so intersecting
+ * the posting lists yields a small candidate set that only needs to be verified.
+ */
+class BLUEPRINTANALYZER_API FBlueprintTrigramIndex
+{
+public:
+    /** Minimum needle length the index can serve (shorter needles need a full scan) */
+    static constexpr int32 MinQueryLength = 3;
+
+    /**
+     * Add a document to the index
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Field Field the texts belong to
+     * @param Texts All texts of this field for the document
+     */
+    void AddDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts);
+
+    /**
+     * Remove a document from the index
+     * @param DocumentId Id of the document (catalog entry id)
+     * @param Field Field the texts belong to
+     * @param Texts The exact texts that were passed to AddDocument
+     */
+    void RemoveDocument(int32 DocumentId, EBlueprintSearchField Field, TConstArrayView<FString> Texts);
+
+    /**
+     * Find candidate documents that may contain the needle in the given field
+     * @param Field Field to search
+     * @param Needle Substring to search for (case-insensitive)
+     * @param OutCandidates Sorted candidate document ids; callers must still verify each candidate
+     * @return False if the needle is too short to be served by the index
+     */
+    bool Query(EBlueprintSearchField Field, const FString& Needle, TArray<int32>& OutCandidates) const;
+
+    /**
+     * Estimate how many documents a query would return without intersecting posting lists
+     * @param Field Field to search
+     * @param Needle Substring to search for (case-insensitive)
+     * @return Length of the shortest posting list, or INDEX_NONE if the needle is too short
+     */
+    int32 EstimateCandidates(EBlueprintSearchField Field, const FString& Needle) const;
+
+    /**
+     * Remove all documents from the index
+     */
+    void Reset();
+
+private:
+    /**
+     * Collect the distinct trigram keys of a text for a field
+     * @param Field Field the text belongs to
+     * @param Text The text to split into trigrams
+     * @param OutKeys Set receiving the trigram keys
+     */
+    static void CollectKeys(EBlueprintSearchField Field, const FString& Text, TSet<uint64>& OutKeys);
+
+    /** Posting lists keyed by field and trigram, each sorted by document id */
+    TMap<uint64, TArray<int32>> Postings;
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Condensed JSON writer that emits UTF-8 bytes directly.
+ * Has the TJsonWriter interface used by FBlueprintDataSerializer, but instead of building a UTF-16
+ * FString that the HTTP layer transcodes and copies again, it escapes and transcodes each string
+ * once into a byte buffer that can be moved into the response. Strings are scanned eight characters
+ * at a time and copied as bytes while they stay printable ASCII, which nearly all blueprint data is.
+ */
+class BLUEPRINTANALYZER_API FBlueprintUtf8JsonWriter
+{
+public:
+    /**
+     * Create a writer
+     * @param InitialCapacity Number of bytes to reserve up front
+     */
+    explicit FBlueprintUtf8JsonWriter(int32 InitialCapacity = 4096);
+
+    /** Start and end objects and arrays, as a value or as the field named by Identifier */
+    void WriteObjectStart();
+    void WriteObjectStart(FStringView Identifier);
+    void WriteObjectEnd();
+    void WriteArrayStart();
+    void WriteArrayStart(FStringView Identifier);
+    void WriteArrayEnd();
+
+    /** Write array elements */
+    void WriteValue(FStringView Value);
+    void WriteValue(const FString& Value);
+    void WriteValue(const TCHAR* Value);
+    void WriteValue(bool Value);
+    void WriteValue(int32 Value);
+    void WriteValue(int64 Value);
+    void WriteValue(double Value);
+    void WriteNull();
+
+    /** Write object fields */
+    void WriteValue(FStringView Identifier, FStringView Value);
+    void WriteValue(FStringView Identifier, const FString& Value);
+    void WriteValue(FStringView Identifier, const TCHAR* Value);
+    void WriteValue(FStringView Identifier, bool Value);
+    void WriteValue(FStringView Identifier, int32 Value);
+    void WriteValue(FStringView Identifier, int64 Value);
+    void WriteValue(FStringView Identifier, double Value);
+    void WriteNull(FStringView Identifier);
+
+    /**
+     * Write an array element that is already encoded, e.g. a cached blueprint object
+     * @param Encoded One complete value in this writer's encoding
+     */
+    void WriteRawValue(TConstArrayView<uint8> Encoded);
+
+    /**
+     * Finish writing; checks that every object and array was closed
+     * @return True if the output is a complete JSON value
+     */
+    bool Close();
+
+    /**
+     * Take the written bytes, leaving the writer empty
+     * @return UTF-8 encoded JSON without a terminator
+     */
+    TArray<uint8> MoveBytes();
+
+    /**
+     * Append text as a quoted, escaped JSON string in UTF-8
+     * @param Out Buffer to append to
+     * @param Text Text to append
+     */
+    static void AppendJsonString(TArray<uint8>& Out, FStringView Text);
+
+    /**
+     * Append text transcoded to UTF-8 without any escaping, e.g. an already serialized JSON document
+     * @param Out Buffer to append to
+     * @param Text Text to append
+     */
+    static void AppendUtf8(TArray<uint8>& Out, FStringView Text);
+
+private:
+    /** Write the separator before a new value or field */
+    void WriteSeparator();
+
+    /** Write the separator and the quoted field name */
+    void WriteIdentifier(FStringView Identifier);
+
+    /** Write a container start character and open a new nesting level */
+    void OpenScope(uint8 StartChar);
+
+    /** Close the innermost nesting level with its end character */
+    void CloseScope(uint8 EndChar);
+
+    /** Append raw ASCII bytes */
+    void AppendAscii(const ANSICHAR* Text, int32 Length);
+
+    /** Append JSON literals for scalar values */
+    void AppendBool(bool Value);
+    void AppendInteger(int64 Value);
+    void AppendDouble(double Value);
+
+    /** Output buffer */
+    TArray<uint8> Bytes;
+
+    /** One flag per open object or array: whether a value was already written at that level */
+    TArray<bool, TInlineAllocator<32>> HasValue;
+};
@@ -2,12 +2,17 @@
 
 #include "CoreMinimal.h"
 #include "BlueprintData.h"
+#include "BlueprintDataSerializer.h"
+#include "BlueprintBinaryWriter.h"
+#include "BlueprintResponseCompression.h"
 #include "HttpServerModule.h"
 #include "HttpServerRequest.h"
 #include "HttpServerResponse.h"
 #include "IHttpRouter.h"
 #include "MCPDoc.h"
 
+class FJsonObject;
+
 /**
  * A HTTP server for handling MCP requests from external apps
  * Allows the Python MCP server to automatically fetch blueprint data
@@ -28,29 +33,125 @@ public:
     static void Shutdown();
     
 private:
+    /**
+     * Wrap a route handler so its responses are compressed as negotiated by Accept-Encoding
+     * @param Handler Route handler
+     * @return Delegate to bind to the route
+     */
+    static FHttpRequestHandler CreateHandler(bool (*Handler)(const FHttpServerRequest&, const FHttpResultCallback&));
+    
+    /**
+     * Send a response, compressing it on a worker thread first when it is large enough
+     * @param Response Response from a route handler
+     * @param Encoding Negotiated content encoding
+     * @param OnComplete Completion callback of the request, called on the game thread
+     */
+    static void CompleteWithEncoding(TUniquePtr<FHttpServerResponse>&& Response, EBlueprintContentEncoding Encoding, const FHttpResultCallback& OnComplete);
+    
     /** The HTTP router instance */
     static TSharedPtr<IHttpRouter> HttpRouter;
     
     /**
      * Handle GET /blueprints/all request to retrieve all blueprints
+     * Blueprints are copied from the fragment cache unless they changed since they were last served.
      * Query parameters:
      *   - detailLevel: (optional) Level of detail to extract (0=Basic, 1=Medium, 2=Full, 3=Graph, 4=Events), defaults to 0 (Basic)
      *   - limit: (optional) Maximum number of blueprints to return, defaults to all
      *   - offset: (optional) Starting index for pagination, defaults to 0
+     *   - compact: (optional) Write graphs as column arrays over a shared string table (true/false), defaults to false
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleListAllBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
     /**
      * Handle GET /blueprints/search request to search blueprints
      * Query parameters:
-     *   - query: (required) The search query string
-     *   - type: (optional) The search type (name, parentClass, function, variable), defaults to "name"
+     *   - query: (required except for type=signature) The search query string
+     *   - type: (optional) The search type (name, parentClass, function, variable, ranked), defaults to "name"
+     *           "ranked" returns the best matches first, tolerating typos, with a relevance score in each blueprint's metadata
+     *           "query" takes a compound query, e.g. parentClass:Character AND (function:Damage OR variable:Health) AND NOT tag:Key=Value
+     *           "signature" finds functions by parameter and return types, given as params/returns
+     *   - params: (optional) Comma-separated parameter types, e.g. Actor,float; positional for type=function, any order for type=signature
+     *   - returns: (optional) With type=signature, comma-separated output types, e.g. bool (empty for none)
+     *   - pure, event: (optional) With type=signature, only match pure functions or events (true/false)
+     *   - mode: (optional) "regex" matches the query as a case-insensitive regular expression against the field
+     *           named by type (name, path, parentClass, function or variable), e.g. ^BP_(Enemy|Boss)_.*
+     *   - explain: (optional) With type=query, return the chosen plan and estimated cost instead of results
      *   - detailLevel: (optional) Level of detail to extract (0=Basic, 1=Medium, 2=Full, 3=Graph, 4=Events), defaults to 0 (Basic)
      *   - limit: (optional) Maximum number of blueprints to return, defaults to all
      *   - offset: (optional) Starting index for pagination, defaults to 0
+     *   - exactCount: (optional) With false, function/variable searches stop once the page is filled and
+     *                 metadata.totalCount is an estimate (metadata.totalCountExact=false), defaults to true
+     *   - compact: (optional) Write graphs as column arrays over a shared string table (true/false), defaults to false
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleSearchBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
+    /**
+     * Handle GET /blueprints/grep request to search text inside all blueprint graphs
+     * Query parameters:
+     *   - query: (required) Text to search for in node titles, node comments, comment boxes and pin default values
+     *   - limit: (optional) Maximum number of matches to return, defaults to all
+     *   - offset: (optional) Starting index for pagination, defaults to 0
+     */
+    static bool HandleGrepBlueprints(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/pattern request to find structural patterns across all blueprint graphs
+     * Query parameters:
+     *   - pattern: (required) Chain of nodes and edges, e.g. Event[Tick] -exec-> DynamicCast or
+     *              MacroInstance[For Each Loop] -exec*-> CallFunction[Get All Actors Of Class]
+     *   - limit: (optional) Maximum number of matches to return, defaults to all
+     *   - offset: (optional) Starting index for pagination, defaults to 0
+     */
+    static bool HandlePatternSearch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/usages request to find the blueprints and graphs that use a node class or implement an event
+     * Query parameters (exactly one of nodeClass and event):
+     *   - nodeClass: Node class, with or without the K2Node_ prefix, e.g. K2Node_SpawnActorFromClass
+     *   - event: Event name, e.g. ReceiveTick, BeginPlay or the name of a custom event
+     *   - limit: (optional) Maximum number of blueprints to return, defaults to all
+     *   - offset: (optional) Starting index for pagination, defaults to 0
+     */
+    static bool HandleFindUsages(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/complete request for type-ahead completion
+     * Query parameters:
+     *   - prefix: (required) Text typed so far (case-insensitive)
+     *   - k: (optional) Number of completions to return, defaults to 10
+     *   - kind: (optional) Only complete names, paths, functions or events (name, path, function, event)
+     */
+    static bool HandleComplete(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/tree request to browse content folders
+     * Counts are kept up to date by the catalog, so a listing never scans the project.
+     * Query parameters:
+     *   - path: (optional) Folder to list, e.g. /Game/Characters, defaults to /Game; / lists the mount points
+     *   - limit: (optional) Maximum number of direct blueprints to return, defaults to all
+     *   - offset: (optional) Starting index into the direct blueprints, defaults to 0
+     */
+    static bool HandleGetTree(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/top request to rank blueprints by size, complexity or references
+     * Served from ordered indexes the catalog updates as blueprints change.
+     * Query parameters:
+     *   - metric: (optional) nodes, graphs, variables, references (other blueprints depending on it) or size (bytes on disk), defaults to nodes
+     *   - k: (optional) Number of blueprints to return, defaults to 50
+     */
+    static bool HandleGetTop(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
+    /**
+     * Handle GET /blueprints/cache/stats request to report the search result cache counters
+     * Search, grep, pattern and usages responses are cached per catalog generation.
+     */
+    static bool HandleGetCacheStats(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+    
     /**
      * Handle GET /blueprints/path request to get a specific blueprint
      * Query parameters:
@@ -60,6 +161,9 @@ private:
      *   - maxNodes: (optional) Maximum number of nodes to return per graph (for detail level 3)
      *   - maxGraphs: (optional) Maximum number of graphs to return (for detail level 3)
      *   - graphOffset: (optional) Starting index for graph pagination (for detail level 3)
+     *   - compact: (optional) Write graphs as column arrays over a shared string table (true/false), defaults to false
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleGetBlueprintByPath(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
@@ -68,6 +172,9 @@ private:
      * Query parameters:
      *   - path: (required) The asset path of the blueprint
      *   - function: (required) The name of the function to get graph data for
+     *   - compact: (optional) Write graphs as column arrays over a shared string table (true/false), defaults to false
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleGetFunctionGraph(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
@@ -76,6 +183,9 @@ private:
      * Query parameters:
      *   - path: (required) The asset path of the blueprint
      *   - nodeType: (required) The type of nodes to filter for (e.g. K2Node_CallFunction)
+     *   - compact: (optional) Write graphs as column arrays over a shared string table (true/false), defaults to false
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleGetNodesByType(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
@@ -100,6 +210,8 @@ private:
      *   - path: (required) The asset path of the blueprint
      *   - eventName: (required) The name of the event to get graph data for
      *   - maxNodes: (optional) Maximum number of nodes per graph to extract (0 = unlimited)
+     *   - omitDefaults: (optional) Leave out empty strings, false, 0 and empty arrays and objects (true/false),
+     *                   defaults to true with apiVersion=2 and false otherwise
      */
     static bool HandleGetEventGraph(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
     
@@ -117,9 +229,40 @@ private:
     static TUniquePtr<FHttpServerResponse> CreateJsonResponse(const FString& JsonContent);
     
     /**
-     * Create HTTP response with blueprint data array in JSON format
+     * Create HTTP response that takes ownership of an already UTF-8 encoded JSON body
      */
-    static TUniquePtr<FHttpServerResponse> CreateJsonResponse(const TArray<FBlueprintData>& BlueprintsData);
+    static TUniquePtr<FHttpServerResponse> CreateJsonResponse(TArray<uint8>&& JsonBytes);
+    
+    /**
+     * Create HTTP response with an encoded body in the given format
+     */
+    static TUniquePtr<FHttpServerResponse> CreateEncodedResponse(TArray<uint8>&& Body, EBlueprintWireFormat Format);
+    
+    /**
+     * Create HTTP response with blueprint data array in JSON format, or the binary format negotiated for the request
+     */
+    static TUniquePtr<FHttpServerResponse> CreateJsonResponse(
+        const TArray<FBlueprintData>& BlueprintsData,
+        EBlueprintWireFormat Format = EBlueprintWireFormat::Json,
+        const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions());
+    
+    /**
+     * Create HTTP response from a JSON object, in JSON or the binary format negotiated for the request
+     */
+    static TUniquePtr<FHttpServerResponse> CreateJsonResponse(const TSharedPtr<FJsonObject>& RootObject, EBlueprintWireFormat Format);
+    
+    /**
+     * Get the response format the request asks for through its Accept header
+     * Routes returning blueprint data or graphs, and the complete, tree, top and cache stats routes, honor application/cbor and application/msgpack; the rest always answer JSON.
+     */
+    static EBlueprintWireFormat GetResponseFormat(const FHttpServerRequest& Request);
+    
+    /**
+     * Get the layout options the request asks for through its query parameters
+     * compact=true writes graphs as column arrays over a shared string table. omitDefaults leaves out
+     * default-valued fields; it is on by default for apiVersion=2 clients.
+     */
+    static FBlueprintSerializationOptions GetSerializationOptions(const FHttpServerRequest& Request);
     
     /**
      * Create error response
@@ -133,5 +276,19 @@ private:
         const TArray<FBlueprintData>& BlueprintsData,
         int32 TotalCount,
         int32 Limit,
-        int32 Offset);
+        int32 Offset,
+        bool bTotalCountExact = true,
+        EBlueprintWireFormat Format = EBlueprintWireFormat::Json,
+        const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions());
+    
+    /**
+     * Serialize blueprint data with pagination metadata to UTF-8 encoded JSON
+     */
+    static TArray<uint8> SerializeWithMetadata(
+        const TArray<FBlueprintData>& BlueprintsData,
+        int32 TotalCount,
+        int32 Limit,
+        int32 Offset,
+        bool bTotalCountExact = true,
+        const FBlueprintSerializationOptions& Options = FBlueprintSerializationOptions());
 };
\ No newline at end of file
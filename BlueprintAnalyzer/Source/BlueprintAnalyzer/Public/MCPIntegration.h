@@ -114,12 +114,20 @@ private:
 
     
     /**
-     * Parse JSON to blueprint data
+     * Parse JSON to blueprint data, including graphs with their nodes, pins and connections
      * @param JSON The JSON string to parse
      * @return Blueprint data parsed from JSON
      */
     static FBlueprintData JSONToBlueprintData(const FString& JSON);
     
+    /**
+     * Parse the blueprints array of a response document
+     * @param JSON The JSON string to parse
+     * @param OutBlueprints Array the parsed blueprints are appended to
+     * @return Whether the document parsed completely
+     */
+    static bool JSONToBlueprints(const FString& JSON, TArray<FBlueprintData>& OutBlueprints);
+    
     /**
      * Handle HTTP response from the MCP server
      * @param HttpRequest The HTTP request
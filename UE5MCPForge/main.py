@@ -9,6 +9,11 @@ import requests
 from typing import Dict, List, Optional, Any
 import threading
 
+try:
+    import msgpack
+except ImportError:
+    msgpack = None
+
 # Configure logging
 logging.basicConfig(
     level=logging.INFO,
@@ -29,11 +34,24 @@ DEFAULT_DETAIL_LEVEL = 2  # Default detail level for blueprint data (0=Basic, 1=
 MAX_NODES_PER_GRAPH = 50  # Maximum number of nodes to fetch per graph
 MAX_GRAPHS = 10  # Maximum number of graphs to fetch
 
+# Ask for MessagePack on blueprint and graph routes when it can be decoded; it is much cheaper to parse than JSON
+WIRE_HEADERS = {"Accept": "application/msgpack, application/json;q=0.5"} if msgpack else {}
+
+# Plugin API version this client is written against; version 2 leaves out default-valued fields,
+# so blueprint data must be read with .get() and the type's default
+API_VERSION = 2
+
 # Flag to control background sync
 sync_running = False
 
 # ========== DATA ACCESS FUNCTIONALITY ==========
 
+def decode_response(response):
+    """Decode a plugin response in whichever encoding the plugin answered with"""
+    if msgpack and response.headers.get("Content-Type", "").startswith("application/msgpack"):
+        return msgpack.unpackb(response.content, raw=False)
+    return response.json()
+
 async def file_polling_task():
     """Background task to periodically check for blueprint data from HTTP server"""
     global sync_running
@@ -58,14 +76,14 @@ async def fetch_blueprints_from_http():
     logger.info(f"Fetching blueprints from UE5 plugin at {UE5_PLUGIN_URL}")
     
     # Use requests to fetch the data with detail level
-    response = requests.get(f"{UE5_PLUGIN_URL}/blueprints/all?detailLevel={DEFAULT_DETAIL_LEVEL}", timeout=10)
+    response = requests.get(f"{UE5_PLUGIN_URL}/blueprints/all?detailLevel={DEFAULT_DETAIL_LEVEL}&apiVersion={API_VERSION}", headers=WIRE_HEADERS, timeout=10)
     
     if response.status_code != 200:
         logger.error(f"Failed to fetch blueprints: HTTP {response.status_code}")
         return False
         
     try:
-        data = response.json()
+        data = decode_response(response)
         
         # Check if the response is an array or an object with a "blueprints" field
         blueprints = None
@@ -294,13 +312,13 @@ def sync_blueprints_sync():
     
     # Use requests to fetch the data with detail level
     try:
-        response = requests.get(f"{UE5_PLUGIN_URL}/blueprints/all?detailLevel={DEFAULT_DETAIL_LEVEL}", timeout=10)
+        response = requests.get(f"{UE5_PLUGIN_URL}/blueprints/all?detailLevel={DEFAULT_DETAIL_LEVEL}&apiVersion={API_VERSION}", headers=WIRE_HEADERS, timeout=10)
         
         if response.status_code != 200:
             logger.error(f"Failed to fetch blueprints: HTTP {response.status_code}")
             return False
             
-        data = response.json()
+        data = decode_response(response)
         
         # Check if the response is an array or an object with a "blueprints" field
         blueprints = None
@@ -385,12 +403,13 @@ def set_detail_level(level: int) -> str:
     return f"Detail level set to {level} ({['Basic', 'Medium', 'Full', 'Graph', 'Events', 'References'][level]})"
 
 @mcp.tool()
-def get_blueprint_with_detail(blueprint_path: str, detail_level: int = None) -> str:
+def get_blueprint_with_detail(blueprint_path: str, detail_level: int = None, compact: bool = False) -> str:
     """
     Get a blueprint with a specific detail level
     
     blueprint_path: Path to the blueprint
     detail_level: Detail level (0-5, see set_detail_level documentation)
+    compact: Return graphs as column arrays indexing a shared "strings" table (much smaller at detail level 3)
     """
     if detail_level is None:
         detail_level = DEFAULT_DETAIL_LEVEL
@@ -401,14 +420,15 @@ def get_blueprint_with_detail(blueprint_path: str, detail_level: int = None) ->
     try:
         # Fetch the blueprint with the specified detail level
         response = requests.get(
-            f"{UE5_PLUGIN_URL}/blueprints/path?path={blueprint_path}&detailLevel={detail_level}",
+            f"{UE5_PLUGIN_URL}/blueprints/path?path={blueprint_path}&detailLevel={detail_level}&compact={str(compact).lower()}&apiVersion={API_VERSION}",
+            headers=WIRE_HEADERS,
             timeout=10
         )
         
         if response.status_code != 200:
             return f"Error: Failed to fetch blueprint (HTTP {response.status_code})"
             
-        blueprint = response.json()
+        blueprint = decode_response(response)
         
         # Update storage with this detailed blueprint
         if "path" in blueprint:
@@ -429,13 +449,14 @@ def list_blueprint_events(blueprint_path: str) -> str:
         # Fetch events for the blueprint
         response = requests.get(
             f"{UE5_PLUGIN_URL}/blueprints/events?path={blueprint_path}",
+            headers=WIRE_HEADERS,
             timeout=10
         )
         
         if response.status_code != 200:
             return f"Error: Failed to fetch blueprint events (HTTP {response.status_code})"
             
-        events = response.json()
+        events = decode_response(response)
         return json.dumps(events, indent=2)
     except Exception as e:
         return f"Error fetching blueprint events: {str(e)}"
@@ -455,37 +476,40 @@ def get_event_graph(blueprint_path: str, event_name: str, max_nodes: int = None)
     try:
         # Fetch the event graph
         response = requests.get(
-            f"{UE5_PLUGIN_URL}/blueprints/event-graph?path={blueprint_path}&eventName={event_name}&maxNodes={max_nodes}",
+            f"{UE5_PLUGIN_URL}/blueprints/event-graph?path={blueprint_path}&eventName={event_name}&maxNodes={max_nodes}&apiVersion={API_VERSION}",
+            headers=WIRE_HEADERS,
             timeout=10
         )
         
         if response.status_code != 200:
             return f"Error: Failed to fetch event graph (HTTP {response.status_code})"
             
-        graph = response.json()
+        graph = decode_response(response)
         return json.dumps(graph, indent=2)
     except Exception as e:
         return f"Error fetching event graph: {str(e)}"
 
 @mcp.tool()
-def get_function_graph(blueprint_path: str, function_name: str) -> str:
+def get_function_graph(blueprint_path: str, function_name: str, compact: bool = False) -> str:
     """
     Get a specific function graph from a blueprint
     
     blueprint_path: Path to the blueprint
     function_name: Name of the function
+    compact: Return the graph as column arrays indexing a shared "strings" table
     """
     try:
         # Fetch the function graph
         response = requests.get(
-            f"{UE5_PLUGIN_URL}/blueprints/function?path={blueprint_path}&function={function_name}",
+            f"{UE5_PLUGIN_URL}/blueprints/function?path={blueprint_path}&function={function_name}&compact={str(compact).lower()}&apiVersion={API_VERSION}",
+            headers=WIRE_HEADERS,
             timeout=10
         )
         
         if response.status_code != 200:
             return f"Error: Failed to fetch function graph (HTTP {response.status_code})"
             
-        graph = response.json()
+        graph = decode_response(response)
         return json.dumps(graph, indent=2)
     except Exception as e:
         return f"Error fetching function graph: {str(e)}"
@@ -501,14 +525,15 @@ def get_nodes_by_type(blueprint_path: str, node_type: str) -> str:
     try:
         # Fetch nodes of the specified type
         response = requests.get(
-            f"{UE5_PLUGIN_URL}/blueprints/graph/nodes?path={blueprint_path}&nodeType={node_type}",
+            f"{UE5_PLUGIN_URL}/blueprints/graph/nodes?path={blueprint_path}&nodeType={node_type}&apiVersion={API_VERSION}",
+            headers=WIRE_HEADERS,
             timeout=10
         )
         
         if response.status_code != 200:
             return f"Error: Failed to fetch nodes (HTTP {response.status_code})"
             
-        nodes = response.json()
+        nodes = decode_response(response)
         return json.dumps(nodes, indent=2)
     except Exception as e:
         return f"Error fetching nodes: {str(e)}"
@@ -536,6 +561,279 @@ def get_blueprint_references(blueprint_path: str, include_indirect: bool = False
     except Exception as e:
         return f"Error fetching blueprint references: {str(e)}"
 
+@mcp.tool()
+def ranked_search_blueprints(query: str, limit: int = 20) -> str:
+    """
+    Search blueprints by relevance, best match first. Tolerates typos and matches
+    names, descriptions, function and variable names, and node comments.
+    
+    query: Free-text query (e.g., "PlayerCharcter health")
+    limit: Maximum number of results to return
+    """
+    try:
+        # Ask the plugin for the top results
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/search",
+            params={"query": query, "type": "ranked", "limit": limit, "apiVersion": API_VERSION},
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to search blueprints (HTTP {response.status_code})"
+            
+        results = response.json()
+        return json.dumps(results, indent=2)
+    except Exception as e:
+        return f"Error searching blueprints: {str(e)}"
+
+@mcp.tool()
+def grep_blueprints(query: str, limit: int = 50, offset: int = 0) -> str:
+    """
+    Search text inside all blueprint graphs: node titles, node comments,
+    comment boxes and literal pin default values (e.g., "0.35" or "TODO")
+    
+    query: Text to search for
+    limit: Maximum number of matches to return
+    offset: Starting index for pagination
+    """
+    try:
+        # Search the plugin's graph text index
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/grep",
+            params={"query": query, "limit": limit, "offset": offset},
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to search graphs (HTTP {response.status_code})"
+            
+        matches = response.json()
+        return json.dumps(matches, indent=2)
+    except Exception as e:
+        return f"Error searching graphs: {str(e)}"
+
+@mcp.tool()
+def find_functions_by_signature(params: str = None, returns: str = None, limit: int = 50) -> str:
+    """
+    Find blueprint functions by their signature (e.g., all functions taking an Actor and a float)
+    
+    params: Comma-separated parameter types in any order, e.g. "Actor,float" ("" for no parameters)
+    returns: Comma-separated output types, e.g. "bool" ("" for no outputs)
+    limit: Maximum number of blueprints to return
+    """
+    if params is None and returns is None:
+        return "Error: Specify params, returns, or both"
+    
+    try:
+        query_params = {"type": "signature", "limit": limit, "apiVersion": API_VERSION}
+        if params is not None:
+            query_params["params"] = params
+        if returns is not None:
+            query_params["returns"] = returns
+        
+        # Look the signature up in the plugin's signature index
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/search",
+            params=query_params,
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to search signatures (HTTP {response.status_code})"
+            
+        results = response.json()
+        return json.dumps(results, indent=2)
+    except Exception as e:
+        return f"Error searching signatures: {str(e)}"
+
+@mcp.tool()
+def find_graph_pattern(pattern: str, limit: int = 50, offset: int = 0) -> str:
+    """
+    Find structural patterns across all blueprint graphs, such as anti-patterns
+    
+    pattern: Chain of nodes joined by edges. A node is a node class (e.g. Event, CallFunction,
+             DynamicCast, MacroInstance, or * for any) with an optional [title substring].
+             Edges are -exec-> (directly wired), -exec*-> (runs anywhere after) and -data->.
+             Examples: "Event[Tick] -exec-> DynamicCast",
+                       "MacroInstance[For Each Loop] -exec*-> CallFunction[Get All Actors Of Class]"
+    limit: Maximum number of matches to return
+    offset: Starting index for pagination
+    """
+    try:
+        # Match the pattern against the plugin's graph summaries
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/pattern",
+            params={"pattern": pattern, "limit": limit, "offset": offset},
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to search patterns (HTTP {response.status_code}): {response.text}"
+            
+        matches = response.json()
+        return json.dumps(matches, indent=2)
+    except Exception as e:
+        return f"Error searching patterns: {str(e)}"
+
+@mcp.tool()
+def find_blueprint_usages(node_class: str = None, event: str = None, limit: int = 50, offset: int = 0) -> str:
+    """
+    Find every blueprint and graph that uses a node class or implements an event
+    
+    node_class: Node class, with or without the K2Node_ prefix (e.g. "K2Node_SpawnActorFromClass")
+    event: Event name (e.g. "ReceiveTick", "BeginPlay" or a custom event name)
+    limit: Maximum number of blueprints to return
+    offset: Starting index for pagination
+    
+    Give exactly one of node_class and event.
+    """
+    try:
+        params = {"limit": limit, "offset": offset}
+        if node_class:
+            params["nodeClass"] = node_class
+        if event:
+            params["event"] = event
+        
+        # Look the node class or event up in the plugin's project-wide postings
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/usages",
+            params=params,
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to find usages (HTTP {response.status_code}): {response.text}"
+            
+        usages = response.json()
+        return json.dumps(usages, indent=2)
+    except Exception as e:
+        return f"Error finding usages: {str(e)}"
+
+@mcp.tool()
+def regex_search_blueprints(pattern: str, field: str = "name", limit: int = 50, offset: int = 0) -> str:
+    """
+    Search blueprints with a case-insensitive regular expression
+    
+    pattern: Regular expression, e.g. "^BP_(Enemy|Boss)_.*"
+    field: One of "name", "path", "parentClass", "function" or "variable"
+    limit: Maximum number of blueprints to return
+    offset: Starting index for pagination
+    """
+    try:
+        # The plugin prefilters on the pattern's literals before evaluating it
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/search",
+            params={"query": pattern, "type": field, "mode": "regex", "limit": limit, "offset": offset, "apiVersion": API_VERSION},
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to run regex search (HTTP {response.status_code}): {response.text}"
+            
+        results = response.json()
+        return json.dumps(results, indent=2)
+    except Exception as e:
+        return f"Error running regex search: {str(e)}"
+
+@mcp.tool()
+def complete_blueprint_names(prefix: str, k: int = 10, kind: str = None) -> str:
+    """
+    Complete a prefix to blueprint names, asset paths, function names or event names
+    
+    prefix: Text typed so far, e.g. "BP_Ene" or "/Game/Characters/"
+    k: Number of completions to return
+    kind: Optionally restrict to "name", "path", "function" or "event"
+    """
+    try:
+        params = {"prefix": prefix, "k": k}
+        if kind:
+            params["kind"] = kind
+        
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/complete",
+            params=params,
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to complete prefix (HTTP {response.status_code}): {response.text}"
+            
+        completions = response.json()
+        return json.dumps(completions, indent=2)
+    except Exception as e:
+        return f"Error completing prefix: {str(e)}"
+
+@mcp.tool()
+def browse_blueprint_folders(path: str = "/Game", limit: int = 0, offset: int = 0) -> str:
+    """
+    List a content folder: its subfolders with recursive blueprint and node counts, and the blueprints directly inside it
+    
+    path: Folder to list, e.g. "/Game/Characters"; "/" lists the mount points
+    limit: Maximum number of direct blueprints to return (0 for all)
+    offset: Starting index into the direct blueprints
+    """
+    try:
+        params = {"path": path}
+        if limit > 0:
+            params["limit"] = limit
+        if offset > 0:
+            params["offset"] = offset
+        
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/tree",
+            params=params,
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to browse folder (HTTP {response.status_code}): {response.text}"
+            
+        tree = response.json()
+        return json.dumps(tree, indent=2)
+    except Exception as e:
+        return f"Error browsing folder: {str(e)}"
+
+@mcp.tool()
+def get_top_blueprints(metric: str = "nodes", k: int = 50) -> str:
+    """
+    Get the largest, most complex or most referenced blueprints in the project
+    
+    metric: "nodes", "graphs", "variables", "references" (number of other blueprints depending on it) or "size" (bytes on disk)
+    k: Number of blueprints to return
+    """
+    try:
+        response = requests.get(
+            f"{UE5_PLUGIN_URL}/blueprints/top",
+            params={"metric": metric, "k": k},
+            timeout=10
+        )
+        
+        if response.status_code != 200:
+            return f"Error: Failed to get top blueprints (HTTP {response.status_code}): {response.text}"
+            
+        top = response.json()
+        return json.dumps(top, indent=2)
+    except Exception as e:
+        return f"Error getting top blueprints: {str(e)}"
+
+@mcp.tool()
+def get_search_cache_stats() -> str:
+    """
+    Get the hit, miss and invalidation counters of the plugin's search result cache,
+    plus raw versus compressed response byte counts and the reuse of serialized blueprints
+    in blueprint listings
+    """
+    try:
+        response = requests.get(f"{UE5_PLUGIN_URL}/blueprints/cache/stats", timeout=10)
+        
+        if response.status_code != 200:
+            return f"Error: Failed to get cache stats (HTTP {response.status_code}): {response.text}"
+            
+        stats = response.json()
+        return json.dumps(stats, indent=2)
+    except Exception as e:
+        return f"Error getting cache stats: {str(e)}"
+
 # ========== RESOURCES ==========
 
 @mcp.resource("blueprints://all")
@@ -654,7 +952,7 @@ def get_blueprint_graphs(path: str) -> str:
         # Try to fetch with graph detail level
         try:
             response = requests.get(
-                f"{UE5_PLUGIN_URL}/blueprints/path?path={path}&detailLevel=3&maxGraphs={MAX_GRAPHS}&maxNodes={MAX_NODES_PER_GRAPH}",
+                f"{UE5_PLUGIN_URL}/blueprints/path?path={path}&detailLevel=3&maxGraphs={MAX_GRAPHS}&maxNodes={MAX_NODES_PER_GRAPH}&apiVersion={API_VERSION}",
                 timeout=15
             )
             